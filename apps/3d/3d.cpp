@@ -3,6 +3,7 @@
 #include <GLES/egl.h>
 #include <GLES3/gl3.h>
 
+#include <android/asset_manager.h>
 #include <android/input.h>
 #include <android/log.h>
 #include <android/native_activity.h>
@@ -12,37 +13,37 @@
 #include <stdlib.h>
 #include <string.h>
 
-#include "penger.h"
+#include "../common/vecmath.h"
+#include "instances.h"
+#include "mesh.h"
 
 #define LOG(...) ((void)__android_log_print(ANDROID_LOG_INFO, "ENGINE", __VA_ARGS__))
 #define LOGE(...) ((void)__android_log_print(ANDROID_LOG_ERROR, "ENGINE", __VA_ARGS__))
 
+// Number of pengers, drawn with one instanced draw call whatever the count;
+// the scene density tests build with e.g. `make INSTANCES=4096`.
+#ifndef SCENE_INSTANCES
+#define SCENE_INSTANCES 1
+#endif
+
 const char *vertex_shader_source = R"(#version 300 es
 precision mediump float;
 
 layout (location = 0) in vec3 position;
 layout (location = 1) in vec2 texcoord;
 layout (location = 2) in vec3 normal;
+layout (location = 3) in highp mat4 model;
 
 out vec2 TexCoords;
 out vec3 Normal;
 
-uniform float angle;
+uniform highp mat4 view_projection;
 
 void main() {
-    mat4 rotation_matrix = mat4(
-        cos(angle),  0.0, sin(angle), 0.0,
-        0.0,         1.0, 0.0,        0.0,
-       -sin(angle),  0.0, cos(angle), 0.0,
-        0.0,         0.0, 0.0,        1.0
-    );
-
-    vec3 rotated_position = (rotation_matrix * vec4(position, 1.0)).xyz;
-    vec3 translated_position = rotated_position + vec3(0.0, -0.60, 0.0);
     TexCoords = texcoord;
     Normal = normal;
 
-    gl_Position = vec4(translated_position, 1.0);
+    gl_Position = view_projection * (model * vec4(position, 1.0));
 }
 )";
 
@@ -66,6 +67,7 @@ void main() {
 typedef struct {
     ANativeWindow *window;
     AInputQueue *input;
+    AAssetManager *assets;
 
     int running;
     pthread_t thread;
@@ -103,7 +105,7 @@ void *run_main(void *arg) {
     EGLDisplay egl_display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
     eglInitialize(egl_display, NULL, NULL);
 
-    EGLint attributes[] = {EGL_SURFACE_TYPE, EGL_WINDOW_BIT, EGL_BLUE_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_RED_SIZE, 8, EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT, EGL_NONE};
+    EGLint attributes[] = {EGL_SURFACE_TYPE, EGL_WINDOW_BIT, EGL_BLUE_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_RED_SIZE, 8, EGL_DEPTH_SIZE, 24, EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT, EGL_NONE};
 
     EGLConfig egl_config;
     EGLint num_configs;
@@ -121,71 +123,123 @@ void *run_main(void *arg) {
     glGenVertexArrays(1, &VAO);
     glBindVertexArray(VAO);
 
-    GLuint VBO_vertices;
-    glGenBuffers(1, &VBO_vertices);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO_vertices);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GLfloat), (const void *)0);
-
-    GLuint VBO_texcoords;
-    glGenBuffers(1, &VBO_texcoords);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO_texcoords);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(texcoords), texcoords, GL_STATIC_DRAW);
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(GLfloat), (const void *)0);
-
-    GLuint VBO_normals;
-    glGenBuffers(1, &VBO_normals);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO_normals);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(normals), normals, GL_STATIC_DRAW);
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GLfloat), (const void *)0);
-
-    GLuint EBO;
-    glGenBuffers(1, &EBO);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(vertex_indices), vertex_indices, GL_STATIC_DRAW);
-
-    GLuint vertex_shader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertex_shader, 1, &vertex_shader_source, NULL);
-    glCompileShader(vertex_shader);
-    check_shader_compile_status(vertex_shader);
-
-    GLuint fragment_shader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragment_shader, 1, &fragment_shader_source, NULL);
-    glCompileShader(fragment_shader);
-    check_shader_compile_status(fragment_shader);
-
-    GLuint program = glCreateProgram();
-    glAttachShader(program, vertex_shader);
-    glAttachShader(program, fragment_shader);
-    glLinkProgram(program);
-    check_program_link_status(program);
-    glUseProgram(program);
-
-    GLint angle_location = glGetUniformLocation(program, "angle");
-    float i = 0;
-    AInputEvent *event = NULL;
-
-    while (app->running) {
-        while (AInputQueue_getEvent(app->input, &event) >= 0) {
-            if (AInputQueue_preDispatchEvent(app->input, event)) continue;
-            AInputQueue_finishEvent(app->input, event, 0);
-        }
+    // deleting the name 0 is a no-op, so the teardown runs the same from every
+    // point of the setup
+    GLuint VBO = 0, EBO = 0, instance_buffer = 0, program = 0;
+    MeshFileHeader mesh;
+    const MeshPackedVertex *mesh_vertices;
+    const void *mesh_indices;
+
+    // the mesh is compiled offline by meshc (see the Makefile) and stored
+    // uncompressed, so the buffer is mapped straight from the APK
+    AAsset *asset = AAssetManager_open(app->assets, "penger.mesh", AASSET_MODE_BUFFER);
+    if (!asset) {
+        LOGE("cannot open penger.mesh");
+        goto teardown;
+    }
 
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    if (!mesh_file_parse(AAsset_getBuffer(asset), AAsset_getLength(asset), &mesh, &mesh_vertices, &mesh_indices)) {
+        LOGE("penger.mesh is not a version %d mesh", MESH_FILE_VERSION);
+        AAsset_close(asset);
+        goto teardown;
+    }
 
-        glUniform1f(angle_location, 2 * i);
-        i += 0.010;
-        glDrawElements(GL_TRIANGLES, sizeof(vertex_indices), GL_UNSIGNED_INT, 0);
-        eglSwapBuffers(egl_display, egl_surface);
+    // scoped so the error paths above can jump past it to the teardown
+    {
+        LOG("mesh: %u vertices, %u %d-bit indices, %ld bytes", mesh.vertex_count, mesh.index_count, mesh.index_size * 8, (long)AAsset_getLength(asset));
+
+        glGenBuffers(1, &VBO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, mesh.vertex_count * sizeof(MeshPackedVertex), mesh_vertices, GL_STATIC_DRAW);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 3, GL_SHORT, GL_TRUE, sizeof(MeshPackedVertex), (const void *)offsetof(MeshPackedVertex, position));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(MeshPackedVertex), (const void *)offsetof(MeshPackedVertex, texcoord));
+        glEnableVertexAttribArray(2);
+        glVertexAttribPointer(2, 3, GL_BYTE, GL_TRUE, sizeof(MeshPackedVertex), (const void *)offsetof(MeshPackedVertex, normal));
+
+        glGenBuffers(1, &EBO);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.index_count * mesh.index_size, mesh_indices, GL_STATIC_DRAW);
+
+        // per-instance model matrices, a mat4 attribute takes four locations
+        glGenBuffers(1, &instance_buffer);
+        glBindBuffer(GL_ARRAY_BUFFER, instance_buffer);
+        glBufferData(GL_ARRAY_BUFFER, SCENE_INSTANCES * sizeof(Mat4), NULL, GL_STREAM_DRAW);
+        for (int column = 0; column < 4; column++) {
+            glEnableVertexAttribArray(3 + column);
+            glVertexAttribPointer(3 + column, 4, GL_FLOAT, GL_FALSE, sizeof(Mat4), (const void *)(column * 4 * sizeof(float)));
+            glVertexAttribDivisor(3 + column, 1);
+        }
+
+        GLsizei index_count = mesh.index_count;
+        GLenum index_type = mesh.index_size == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+        AAsset_close(asset);
+
+        GLuint vertex_shader = glCreateShader(GL_VERTEX_SHADER);
+        glShaderSource(vertex_shader, 1, &vertex_shader_source, NULL);
+        glCompileShader(vertex_shader);
+        check_shader_compile_status(vertex_shader);
+
+        GLuint fragment_shader = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(fragment_shader, 1, &fragment_shader_source, NULL);
+        glCompileShader(fragment_shader);
+        check_shader_compile_status(fragment_shader);
+
+        program = glCreateProgram();
+        glAttachShader(program, vertex_shader);
+        glAttachShader(program, fragment_shader);
+        glLinkProgram(program);
+        check_program_link_status(program);
+        glUseProgram(program);
+
+        EGLint width, height;
+        eglQuerySurface(egl_display, egl_surface, EGL_WIDTH, &width);
+        eglQuerySurface(egl_display, egl_surface, EGL_HEIGHT, &height);
+        glViewport(0, 0, width, height);
+
+        // the quantised positions are dequantised by the instance matrices; the
+        // camera backs off and looks down as the grid of instances grows
+        float extent = instances_extent(SCENE_INSTANCES);
+        Camera camera = {vec3(0.0f, 0.6f + 0.6f * extent, 3.5f + extent), vec3(0.0f, 0.6f, 0.0f), 45.0f * (float)M_PI / 180.0f, 0.1f, 100.0f + 2.0f * extent};
+        Mat4 view_projection = camera_view_projection(&camera, (float)width / height);
+        Mat4 offset = mat4_translate(vec3(mesh.position_offset[0], mesh.position_offset[1], mesh.position_offset[2]));
+        Mat4 scale = mat4_scale(vec3(mesh.position_scale[0], mesh.position_scale[1], mesh.position_scale[2]));
+        Mat4 dequantise = mat4_mul(&offset, &scale);
+
+        glUniformMatrix4fv(glGetUniformLocation(program, "view_projection"), 1, GL_FALSE, view_projection.m);
+        LOG("drawing %d instances, %zu bytes of transforms per frame", SCENE_INSTANCES, SCENE_INSTANCES * sizeof(Mat4));
+        float i = 0;
+        AInputEvent *event = NULL;
+
+        while (app->running) {
+            while (AInputQueue_getEvent(app->input, &event) >= 0) {
+                if (AInputQueue_preDispatchEvent(app->input, event)) continue;
+                AInputQueue_finishEvent(app->input, event, 0);
+            }
+
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+
+            // orphan last frame's storage so the driver hands out a fresh block
+            // instead of stalling until the GPU has finished reading it
+            glBufferData(GL_ARRAY_BUFFER, SCENE_INSTANCES * sizeof(Mat4), NULL, GL_STREAM_DRAW);
+            Mat4 *instances = (Mat4 *)glMapBufferRange(GL_ARRAY_BUFFER, 0, SCENE_INSTANCES * sizeof(Mat4), GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+            if (instances) {
+                instances_update(instances, SCENE_INSTANCES, i, &dequantise);
+                glUnmapBuffer(GL_ARRAY_BUFFER);
+            }
+            i += 0.010;
+            glDrawElementsInstanced(GL_TRIANGLES, index_count, index_type, 0, SCENE_INSTANCES);
+            eglSwapBuffers(egl_display, egl_surface);
+        }
     }
 
+teardown:
     glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO_vertices);
+    glDeleteBuffers(1, &VBO);
     glDeleteBuffers(1, &EBO);
+    glDeleteBuffers(1, &instance_buffer);
     glDeleteProgram(program);
 
     eglMakeCurrent(egl_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
@@ -233,6 +287,7 @@ JNIEXPORT void ANativeActivity_onCreate(ANativeActivity *activity, void *savedSt
 
     AndroidApp *app = (AndroidApp *)malloc(sizeof(AndroidApp));
     memset(app, 0, sizeof(AndroidApp));
+    app->assets = activity->assetManager;
 
     activity->callbacks->onNativeWindowCreated = on_window_init;
     activity->callbacks->onNativeWindowDestroyed = on_window_deinit;
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <math.h>
+
+#include "../common/vecmath.h"
+
+// Per-instance data of the instanced draw: one model matrix per instance,
+// uploaded as four vec4 attributes with a divisor of one. Shared by 3d.cpp and
+// the host benchmark (instbench.cpp) so both time the same code.
+
+#define INSTANCE_SPACING 1.5f
+
+static inline int instances_columns(int count) {
+    int columns = (int)ceilf(sqrtf((float)count));
+    return columns > 0 ? columns : 1;
+}
+
+// Width of the square grid the instances are laid out on, 0 for a single one.
+static inline float instances_extent(int count) { return (instances_columns(count) - 1) * INSTANCE_SPACING; }
+
+// Writes the model matrix of every instance to `out`: a square grid in the xz
+// plane centred on the origin, each instance spinning around y with its own
+// phase. `dequantise` is applied first so the vertex shader only multiplies by
+// the instance matrix and the view projection. `out` may be a mapped buffer;
+// it is only written, in order.
+static inline void instances_update(Mat4 *out, int count, float time, const Mat4 *dequantise) {
+    int columns = instances_columns(count);
+    int rows = (count + columns - 1) / columns;
+    float x0 = -(columns - 1) * INSTANCE_SPACING * 0.5f;
+    float z0 = (rows - 1) * INSTANCE_SPACING * 0.5f;
+
+    for (int i = 0; i < count; i++) {
+        Vec3 position = vec3(x0 + (i % columns) * INSTANCE_SPACING, 0.0f, z0 - (i / columns) * INSTANCE_SPACING);
+        // clockwise seen from above, as the old shader's rotation matrix turned
+        Quat rotation = quat_axis_angle(vec3(0.0f, 1.0f, 0.0f), -(2 * time + i * 0.61803f));
+        Mat4 model = mat4_transform(position, rotation, vec3(1.0f, 1.0f, 1.0f));
+        out[i] = mat4_mul(&model, dequantise);
+    }
+}
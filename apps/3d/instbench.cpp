@@ -0,0 +1,87 @@
+// Host tool: times the per-frame instance transform update of 3d.cpp for a
+// range of instance counts, writing straight into the destination as with a
+// mapped buffer and through a staging copy as glBufferSubData would, e.g.
+//
+//     ./instbench          # 1 to 65536 instances
+//     ./instbench 4096     # one count
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "instances.h"
+
+#define BENCH_FRAMES 200
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Average seconds per frame; `staging` is NULL to update `out` directly.
+static double bench(Mat4 *out, Mat4 *staging, int count, const Mat4 *dequantise) {
+    int frames = BENCH_FRAMES;
+    double start = now();
+    for (int frame = 0; frame < frames; frame++) {
+        float time = frame * 0.010f;
+        if (staging) {
+            instances_update(staging, count, time, dequantise);
+            memcpy(out, staging, count * sizeof(Mat4));
+        } else {
+            instances_update(out, count, time, dequantise);
+        }
+    }
+    return (now() - start) / frames;
+}
+
+int main(int argc, char **argv) {
+    int counts[] = {1, 64, 1024, 4096, 16384, 65536};
+    int counts_size = sizeof(counts) / sizeof(counts[0]);
+    if (argc > 1) {
+        counts[0] = atoi(argv[1]);
+        counts_size = 1;
+        if (counts[0] <= 0) {
+            fprintf(stderr, "usage: %s [instances]\n", argv[0]);
+            return 1;
+        }
+    }
+
+#if defined(__ARM_NEON)
+    const char *simd = "neon";
+#elif defined(__SSE__)
+    const char *simd = "sse";
+#else
+    const char *simd = "scalar";
+#endif
+    printf("mat4_mul: %s, %d frames per count\n", simd, BENCH_FRAMES);
+    printf("%9s %12s %12s %10s %12s\n", "instances", "direct us", "staged us", "ns/inst", "GB/s");
+
+    Mat4 offset = mat4_translate(vec3(0.0f, 0.6f, 0.0f));
+    Mat4 scale = mat4_scale(vec3(0.6f, 0.65f, 0.42f));
+    Mat4 dequantise = mat4_mul(&offset, &scale);
+
+    for (int c = 0; c < counts_size; c++) {
+        int count = counts[c];
+        Mat4 *out = (Mat4 *)aligned_alloc(16, count * sizeof(Mat4));
+        Mat4 *staging = (Mat4 *)aligned_alloc(16, count * sizeof(Mat4));
+        if (!out || !staging) {
+            fprintf(stderr, "cannot allocate %d instances\n", count);
+            return 1;
+        }
+
+        bench(out, NULL, count, &dequantise); // warm up
+        double direct = bench(out, NULL, count, &dequantise);
+        double staged = bench(out, staging, count, &dequantise);
+
+        // keeps the writes observable
+        float checksum = 0;
+        for (int i = 0; i < count; i++) checksum += out[i].m[12];
+
+        printf("%9d %12.2f %12.2f %10.2f %12.2f%s\n", count, direct * 1e6, staged * 1e6, direct * 1e9 / count, count * sizeof(Mat4) / direct / 1e9, checksum != checksum ? " nan" : "");
+        free(out);
+        free(staging);
+    }
+    return 0;
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// A mesh as the GPU wants it: one interleaved vertex per distinct OBJ
+// position/texcoord/normal triplet, and a single index stream into them.
+typedef struct {
+    float position[3];
+    float texcoord[2];
+    float normal[3];
+} MeshVertex;
+
+typedef struct {
+    MeshVertex *vertices;
+    uint32_t vertex_count;
+    uint32_t *indices;
+    uint32_t index_count;
+} Mesh;
+
+static inline void mesh_free(Mesh *mesh) {
+    free(mesh->vertices);
+    free(mesh->indices);
+    memset(mesh, 0, sizeof(Mesh));
+}
+
+// OBJ faces index positions, texcoords and normals separately. Every corner
+// whose (position, texcoord, normal) triplet was seen before reuses that vertex,
+// new triplets are appended in order of first use. Indices are 0-based. Returns
+// false when out of memory.
+static inline bool mesh_weld(Mesh *mesh, const float *positions, const float *texcoords, const float *normals, const unsigned int *position_indices, const unsigned int *texcoord_indices, const unsigned int *normal_indices, uint32_t corner_count) {
+    memset(mesh, 0, sizeof(Mesh));
+
+    // open addressing over vertex numbers, kept at most half full
+    uint32_t capacity = 16;
+    while (capacity < corner_count * 2) capacity <<= 1;
+
+    uint32_t *table = (uint32_t *)malloc(capacity * sizeof(uint32_t));
+    uint32_t *keys = (uint32_t *)malloc(corner_count * 3 * sizeof(uint32_t));
+    mesh->vertices = (MeshVertex *)malloc(corner_count * sizeof(MeshVertex));
+    mesh->indices = (uint32_t *)malloc(corner_count * sizeof(uint32_t));
+    if (!table || !keys || !mesh->vertices || !mesh->indices) {
+        free(table);
+        free(keys);
+        mesh_free(mesh);
+        return false;
+    }
+    memset(table, 0xff, capacity * sizeof(uint32_t));
+
+    for (uint32_t corner = 0; corner < corner_count; corner++) {
+        uint32_t p = position_indices[corner];
+        uint32_t t = texcoord_indices[corner];
+        uint32_t n = normal_indices[corner];
+
+        uint32_t slot = ((p * 73856093u) ^ (t * 19349663u) ^ (n * 83492791u)) & (capacity - 1);
+        for (;; slot = (slot + 1) & (capacity - 1)) {
+            uint32_t vertex = table[slot];
+            if (vertex == UINT32_MAX) {
+                vertex = mesh->vertex_count++;
+                table[slot] = vertex;
+                keys[vertex * 3 + 0] = p;
+                keys[vertex * 3 + 1] = t;
+                keys[vertex * 3 + 2] = n;
+
+                MeshVertex *v = &mesh->vertices[vertex];
+                memcpy(v->position, &positions[p * 3], sizeof(v->position));
+                memcpy(v->texcoord, &texcoords[t * 2], sizeof(v->texcoord));
+                memcpy(v->normal, &normals[n * 3], sizeof(v->normal));
+            } else if (keys[vertex * 3 + 0] != p || keys[vertex * 3 + 1] != t || keys[vertex * 3 + 2] != n) {
+                continue;
+            }
+
+            mesh->indices[mesh->index_count++] = vertex;
+            break;
+        }
+    }
+
+    free(table);
+    free(keys);
+
+    MeshVertex *vertices = (MeshVertex *)realloc(mesh->vertices, mesh->vertex_count * sizeof(MeshVertex));
+    if (vertices) mesh->vertices = vertices;
+    return true;
+}
+
+// Binary mesh blob written by meshc and mapped straight out of the APK. Little
+// endian, laid out as MeshFileHeader, then vertex_count MeshPackedVertex, then
+// index_count indices of index_size bytes, each section 4-byte aligned.
+#define MESH_FILE_MAGIC 0x4853454du // "MESH"
+#define MESH_FILE_VERSION 1
+
+// 16 bytes instead of 32: the position in snorm16 across the bounding box
+// (see MeshFileHeader), the texcoord in half floats, the normal in snorm8.
+typedef struct {
+    int16_t position[4]; // w unused
+    uint16_t texcoord[2];
+    int8_t normal[4]; // w unused
+} MeshPackedVertex;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t vertex_count;
+    uint32_t index_count;
+    uint32_t index_size;    // 2 when every vertex fits in 16 bits, else 4
+    uint32_t vertex_offset; // bytes from the start of the blob
+    uint32_t index_offset;
+    float position_scale[3]; // position = snorm * scale + offset
+    float position_offset[3];
+
+    // the first material of the MTL
+    float ambient[3];
+    float specular[3];
+    float emissive[3];
+    float shininess;
+    float ior;
+    float opacity;
+    int32_t illum;
+    char texture_map[64];
+} MeshFileHeader;
+
+// Checks that `data` holds a whole blob of this version and points `vertices`
+// and `indices` into it. Returns false on anything truncated or foreign.
+static inline bool mesh_file_parse(const void *data, size_t size, MeshFileHeader *header, const MeshPackedVertex **vertices, const void **indices) {
+    if (size < sizeof(MeshFileHeader)) return false;
+    memcpy(header, data, sizeof(MeshFileHeader));
+    if (header->magic != MESH_FILE_MAGIC || header->version != MESH_FILE_VERSION) return false;
+    if (header->index_size != 2 && header->index_size != 4) return false;
+
+    uint64_t vertex_end = (uint64_t)header->vertex_offset + (uint64_t)header->vertex_count * sizeof(MeshPackedVertex);
+    uint64_t index_end = (uint64_t)header->index_offset + (uint64_t)header->index_count * header->index_size;
+    if (header->vertex_offset < sizeof(MeshFileHeader) || vertex_end > size || header->index_offset < vertex_end || index_end > size) return false;
+
+    *vertices = (const MeshPackedVertex *)((const uint8_t *)data + header->vertex_offset);
+    *indices = (const uint8_t *)data + header->index_offset;
+    return true;
+}
@@ -0,0 +1,336 @@
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mesh.h"
+
+// Build time reordering of welded meshes, run by meshc in this order:
+//
+//   1. mesh_optimize_vertex_cache: triangle order that reuses recently
+//      transformed vertices (Forsyth, "Linear-Speed Vertex Cache Optimisation")
+//   2. mesh_optimize_overdraw: splits that order into clusters which cost
+//      little extra cache misses, and draws outward facing ones first so more
+//      fragments fail the depth test
+//   3. mesh_optimize_vertex_fetch: renumbers vertices in order of first use so
+//      the vertex buffer is read front to back
+//
+// Triangles are index triplets; every pass works in place.
+
+#define MESH_CACHE_SIZE 16 // FIFO the statistics simulate, a typical post-transform cache
+
+typedef struct {
+    uint32_t transformed; // cache misses, i.e. vertex shader invocations
+    float acmr;           // transformed per triangle: 0.5 is ideal for a regular grid, 3 is the worst
+    float atvr;           // transformed per vertex: 1 is ideal
+} MeshCacheStats;
+
+// FIFO of `cache_size` entries, `timestamps` holding when each vertex went in.
+static inline bool mesh_cache_touch(uint32_t *timestamps, uint32_t *time, uint32_t cache_size, uint32_t vertex) {
+    if (*time - timestamps[vertex] < cache_size) return false;
+    timestamps[vertex] = (*time)++;
+    return true;
+}
+
+static inline void mesh_cache_stats(const uint32_t *indices, uint32_t index_count, uint32_t vertex_count, uint32_t cache_size, MeshCacheStats *stats) {
+    memset(stats, 0, sizeof(MeshCacheStats));
+
+    uint32_t *timestamps = (uint32_t *)malloc((vertex_count ? vertex_count : 1) * sizeof(uint32_t));
+    if (!timestamps) return;
+
+    // start every vertex out of the cache
+    uint32_t time = cache_size + 1;
+    memset(timestamps, 0, vertex_count * sizeof(uint32_t));
+    for (uint32_t i = 0; i < index_count; i++) stats->transformed += mesh_cache_touch(timestamps, &time, cache_size, indices[i]);
+    free(timestamps);
+
+    uint32_t triangles = index_count / 3;
+    stats->acmr = triangles ? (float)stats->transformed / triangles : 0.0f;
+    stats->atvr = vertex_count ? (float)stats->transformed / vertex_count : 0.0f;
+}
+
+#define MESH_FORSYTH_CACHE 32
+#define MESH_FORSYTH_VALENCE 64 // valence scores above this share the last entry
+
+// Score of a vertex by its position in the simulated LRU cache (-1 when not
+// in it) and how many triangles still use it: recently used vertices keep
+// their triangles going, lonely vertices get finished before they are stranded.
+static inline float mesh_forsyth_score(int cache_position, uint32_t remaining) {
+    if (remaining == 0) return -1.0f;
+
+    float score = 0.0f;
+    if (cache_position >= 3) {
+        score = powf(1.0f - (float)(cache_position - 3) / (MESH_FORSYTH_CACHE - 3), 1.5f);
+    } else if (cache_position >= 0) {
+        score = 0.75f; // the last triangle's vertices: slightly discouraged, strips are no better than fans
+    }
+    return score + 2.0f * powf((float)(remaining < MESH_FORSYTH_VALENCE ? remaining : MESH_FORSYTH_VALENCE), -0.5f);
+}
+
+static inline bool mesh_optimize_vertex_cache(uint32_t *indices, uint32_t index_count, uint32_t vertex_count) {
+    uint32_t triangle_count = index_count / 3;
+    if (triangle_count == 0) return true;
+
+    uint32_t *offsets = (uint32_t *)calloc(vertex_count + 1, sizeof(uint32_t));
+    uint32_t *remaining = (uint32_t *)calloc(vertex_count, sizeof(uint32_t));
+    uint32_t *adjacency = (uint32_t *)malloc(index_count * sizeof(uint32_t));
+    float *vertex_score = (float *)malloc(vertex_count * sizeof(float));
+    float *triangle_score = (float *)malloc(triangle_count * sizeof(float));
+    bool *emitted = (bool *)calloc(triangle_count, sizeof(bool));
+    uint32_t *output = (uint32_t *)malloc(index_count * sizeof(uint32_t));
+    bool ok = offsets && remaining && adjacency && vertex_score && triangle_score && emitted && output;
+
+    if (ok) {
+        // triangles of each vertex; the first remaining[v] entries are the ones not emitted yet
+        for (uint32_t i = 0; i < index_count; i++) remaining[indices[i]]++;
+        for (uint32_t v = 0; v < vertex_count; v++) offsets[v + 1] = offsets[v] + remaining[v];
+        memset(remaining, 0, vertex_count * sizeof(uint32_t));
+        for (uint32_t i = 0; i < triangle_count * 3; i++) {
+            uint32_t v = indices[i];
+            adjacency[offsets[v] + remaining[v]++] = i / 3;
+        }
+
+        for (uint32_t v = 0; v < vertex_count; v++) vertex_score[v] = mesh_forsyth_score(-1, remaining[v]);
+        for (uint32_t t = 0; t < triangle_count; t++) {
+            const uint32_t *tri = &indices[t * 3];
+            triangle_score[t] = vertex_score[tri[0]] + vertex_score[tri[1]] + vertex_score[tri[2]];
+        }
+
+        uint32_t cache[MESH_FORSYTH_CACHE + 3];
+        uint32_t cache_count = 0;
+        uint32_t cursor = 0; // no triangle before it is left, for the fallback scan
+        int64_t best = -1;
+
+        for (uint32_t emitted_count = 0; emitted_count < triangle_count; emitted_count++) {
+            if (best < 0) {
+                // nothing in the cache touches a live triangle: take the best one anywhere
+                float best_score = -1.0f;
+                while (emitted[cursor]) cursor++;
+                for (uint32_t t = cursor; t < triangle_count; t++) {
+                    if (!emitted[t] && triangle_score[t] > best_score) {
+                        best_score = triangle_score[t];
+                        best = t;
+                    }
+                }
+            }
+
+            uint32_t t = (uint32_t)best;
+            const uint32_t *tri = &indices[t * 3];
+            memcpy(&output[emitted_count * 3], tri, 3 * sizeof(uint32_t));
+            emitted[t] = true;
+
+            // drop the triangle from its vertices' live lists
+            for (int k = 0; k < 3; k++) {
+                uint32_t v = tri[k];
+                uint32_t *list = &adjacency[offsets[v]];
+                for (uint32_t j = 0; j < remaining[v]; j++) {
+                    if (list[j] == t) {
+                        list[j] = list[--remaining[v]];
+                        break;
+                    }
+                }
+            }
+
+            // the triangle's vertices move to the front of the cache
+            uint32_t next[MESH_FORSYTH_CACHE + 3];
+            uint32_t next_count = 0;
+            for (int k = 0; k < 3; k++) next[next_count++] = tri[k];
+            for (uint32_t j = 0; j < cache_count; j++) {
+                uint32_t v = cache[j];
+                if (v != tri[0] && v != tri[1] && v != tri[2]) next[next_count++] = v;
+            }
+
+            // rescore everything that moved, including what fell out, and pick
+            // the best live triangle around them
+            best = -1;
+            float best_score = -1.0f;
+            for (uint32_t j = 0; j < next_count; j++) {
+                uint32_t v = next[j];
+                float score = mesh_forsyth_score(j < MESH_FORSYTH_CACHE ? (int)j : -1, remaining[v]);
+                float delta = score - vertex_score[v];
+                vertex_score[v] = score;
+
+                const uint32_t *list = &adjacency[offsets[v]];
+                for (uint32_t a = 0; a < remaining[v]; a++) {
+                    uint32_t other = list[a];
+                    triangle_score[other] += delta;
+                    if (triangle_score[other] > best_score) {
+                        best_score = triangle_score[other];
+                        best = other;
+                    }
+                }
+            }
+
+            cache_count = next_count < MESH_FORSYTH_CACHE ? next_count : MESH_FORSYTH_CACHE;
+            memcpy(cache, next, cache_count * sizeof(uint32_t));
+        }
+
+        memcpy(indices, output, triangle_count * 3 * sizeof(uint32_t));
+    }
+
+    free(offsets);
+    free(remaining);
+    free(adjacency);
+    free(vertex_score);
+    free(triangle_score);
+    free(emitted);
+    free(output);
+    return ok;
+}
+
+typedef struct {
+    uint32_t start; // first triangle
+    uint32_t count;
+    float centroid[3];
+    float normal[3];
+    float area;
+    float sort_key;
+} MeshCluster;
+
+static inline int mesh_cluster_compare(const void *a, const void *b) {
+    const MeshCluster *ca = (const MeshCluster *)a;
+    const MeshCluster *cb = (const MeshCluster *)b;
+    if (ca->sort_key != cb->sort_key) return ca->sort_key > cb->sort_key ? -1 : 1;
+    return ca->start < cb->start ? -1 : 1; // stable
+}
+
+// Needs a cache optimised order. Clusters start where the cache restarts from
+// cold (all three vertices of a triangle miss), and are split further wherever
+// the misses since the last split are within `threshold` (e.g. 1.05) of the
+// cluster's own ACMR. The threshold is per split, not for the mesh: the last
+// piece of every cluster takes whatever is left, however many misses that is,
+// so the ACMR of the whole mesh can rise by more (meshc prints it after this
+// pass; the penger model loses about 7% at 1.05). Clusters are then sorted by
+// how far out along their average normal they sit from the mesh centre: drawn
+// first, they occlude the rest.
+static inline bool mesh_optimize_overdraw(uint32_t *indices, uint32_t index_count, const MeshVertex *vertices, uint32_t vertex_count, float threshold) {
+    uint32_t triangle_count = index_count / 3;
+    if (triangle_count == 0) return true;
+
+    uint32_t *timestamps = (uint32_t *)calloc(vertex_count, sizeof(uint32_t));
+    uint8_t *misses = (uint8_t *)malloc(triangle_count);
+    MeshCluster *clusters = (MeshCluster *)malloc(triangle_count * sizeof(MeshCluster));
+    uint32_t *output = (uint32_t *)malloc(index_count * sizeof(uint32_t));
+    bool ok = timestamps && misses && clusters && output;
+
+    if (ok) {
+        uint32_t time = MESH_CACHE_SIZE + 1;
+        for (uint32_t t = 0; t < triangle_count; t++) {
+            misses[t] = 0;
+            for (int k = 0; k < 3; k++) misses[t] += mesh_cache_touch(timestamps, &time, MESH_CACHE_SIZE, indices[t * 3 + k]);
+        }
+
+        uint32_t cluster_count = 0;
+        for (uint32_t start = 0; start < triangle_count;) {
+            uint32_t end = start + 1;
+            while (end < triangle_count && misses[end] < 3) end++;
+
+            // split the hard cluster [start, end) where it is cheap to
+            uint32_t total = 0;
+            for (uint32_t t = start; t < end; t++) total += misses[t];
+            float limit = threshold * total / (end - start);
+
+            time += MESH_CACHE_SIZE + 1;
+            uint32_t sub_start = start;
+            uint32_t sub_misses = 0;
+            for (uint32_t t = start; t < end; t++) {
+                for (int k = 0; k < 3; k++) sub_misses += mesh_cache_touch(timestamps, &time, MESH_CACHE_SIZE, indices[t * 3 + k]);
+                if (t + 1 == end || (float)sub_misses / (t + 1 - sub_start) <= limit) {
+                    clusters[cluster_count].start = sub_start;
+                    clusters[cluster_count].count = t + 1 - sub_start;
+                    cluster_count++;
+                    sub_start = t + 1;
+                    sub_misses = 0;
+                    time += MESH_CACHE_SIZE + 1;
+                }
+            }
+            start = end;
+        }
+
+        // area weighted centroids and normals
+        float mesh_centroid[3] = {0};
+        float mesh_area = 0.0f;
+        for (uint32_t c = 0; c < cluster_count; c++) {
+            MeshCluster *cluster = &clusters[c];
+            memset(cluster->centroid, 0, sizeof(cluster->centroid));
+            memset(cluster->normal, 0, sizeof(cluster->normal));
+            cluster->area = 0.0f;
+
+            for (uint32_t t = cluster->start; t < cluster->start + cluster->count; t++) {
+                const float *a = vertices[indices[t * 3 + 0]].position;
+                const float *b = vertices[indices[t * 3 + 1]].position;
+                const float *d = vertices[indices[t * 3 + 2]].position;
+                float e1[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+                float e2[3] = {d[0] - a[0], d[1] - a[1], d[2] - a[2]};
+                float n[3] = {e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0]};
+                float area = sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]) * 0.5f;
+                for (int k = 0; k < 3; k++) {
+                    cluster->centroid[k] += (a[k] + b[k] + d[k]) / 3.0f * area;
+                    cluster->normal[k] += n[k];
+                }
+                cluster->area += area;
+            }
+
+            for (int k = 0; k < 3; k++) mesh_centroid[k] += cluster->centroid[k];
+            mesh_area += cluster->area;
+        }
+        for (int k = 0; k < 3; k++) mesh_centroid[k] = mesh_area > 0.0f ? mesh_centroid[k] / mesh_area : 0.0f;
+
+        for (uint32_t c = 0; c < cluster_count; c++) {
+            MeshCluster *cluster = &clusters[c];
+            float length = sqrtf(cluster->normal[0] * cluster->normal[0] + cluster->normal[1] * cluster->normal[1] + cluster->normal[2] * cluster->normal[2]);
+            cluster->sort_key = 0.0f;
+            for (int k = 0; k < 3; k++) {
+                float centroid = cluster->area > 0.0f ? cluster->centroid[k] / cluster->area : 0.0f;
+                float normal = length > 0.0f ? cluster->normal[k] / length : 0.0f;
+                cluster->sort_key += (centroid - mesh_centroid[k]) * normal;
+            }
+        }
+
+        qsort(clusters, cluster_count, sizeof(MeshCluster), mesh_cluster_compare);
+
+        uint32_t written = 0;
+        for (uint32_t c = 0; c < cluster_count; c++) {
+            memcpy(&output[written], &indices[clusters[c].start * 3], clusters[c].count * 3 * sizeof(uint32_t));
+            written += clusters[c].count * 3;
+        }
+        memcpy(indices, output, written * sizeof(uint32_t));
+    }
+
+    free(timestamps);
+    free(misses);
+    free(clusters);
+    free(output);
+    return ok;
+}
+
+// Renumbers vertices in order of first use and drops unreferenced ones.
+// Returns the new vertex count, or 0 when out of memory.
+static inline uint32_t mesh_optimize_vertex_fetch(MeshVertex *vertices, uint32_t vertex_count, uint32_t *indices, uint32_t index_count) {
+    uint32_t *remap = (uint32_t *)malloc((vertex_count ? vertex_count : 1) * sizeof(uint32_t));
+    MeshVertex *copy = (MeshVertex *)malloc((vertex_count ? vertex_count : 1) * sizeof(MeshVertex));
+    if (!remap || !copy) {
+        free(remap);
+        free(copy);
+        return 0;
+    }
+
+    memset(remap, 0xff, vertex_count * sizeof(uint32_t));
+    memcpy(copy, vertices, vertex_count * sizeof(MeshVertex));
+
+    uint32_t next = 0;
+    for (uint32_t i = 0; i < index_count; i++) {
+        uint32_t v = indices[i];
+        if (remap[v] == UINT32_MAX) {
+            remap[v] = next;
+            vertices[next++] = copy[v];
+        }
+        indices[i] = remap[v];
+    }
+
+    free(remap);
+    free(copy);
+    return next;
+}
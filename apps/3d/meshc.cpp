@@ -0,0 +1,339 @@
+// Host tool: compiles an OBJ (and the first material of its MTL) into the
+// binary blob described in mesh.h, reordered for the vertex cache, overdraw
+// and vertex fetch (mesh_optimize.h), and reports the cache efficiency of
+// each step, e.g.
+//
+//     ./meshc models/penger.obj assets/penger.mesh
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mesh.h"
+#include "mesh_optimize.h"
+
+#define LOG(...) fprintf(stderr, __VA_ARGS__)
+
+typedef struct {
+    float *data;
+    uint32_t count; // floats
+    uint32_t capacity;
+} FloatArray;
+
+typedef struct {
+    unsigned int *data;
+    uint32_t count;
+    uint32_t capacity;
+} IndexArray;
+
+static bool float_push(FloatArray *array, float value) {
+    if (array->count == array->capacity) {
+        uint32_t capacity = array->capacity ? array->capacity * 2 : 1024;
+        float *data = (float *)realloc(array->data, capacity * sizeof(float));
+        if (!data) return false;
+        array->data = data;
+        array->capacity = capacity;
+    }
+    array->data[array->count++] = value;
+    return true;
+}
+
+static bool index_push(IndexArray *array, unsigned int value) {
+    if (array->count == array->capacity) {
+        uint32_t capacity = array->capacity ? array->capacity * 2 : 1024;
+        unsigned int *data = (unsigned int *)realloc(array->data, capacity * sizeof(unsigned int));
+        if (!data) return false;
+        array->data = data;
+        array->capacity = capacity;
+    }
+    array->data[array->count++] = value;
+    return true;
+}
+
+typedef struct {
+    FloatArray positions;
+    FloatArray texcoords;
+    FloatArray normals;
+    IndexArray position_indices;
+    IndexArray texcoord_indices;
+    IndexArray normal_indices;
+    char mtllib[256];
+} Obj;
+
+// OBJ indices are 1-based, negative ones count back from the newest element.
+static bool obj_index(const char *token, uint32_t count, unsigned int *index) {
+    long value = strtol(token, NULL, 10);
+    if (value < 0) value += count + 1;
+    if (value < 1 || value > (long)count) return false;
+    *index = (unsigned int)(value - 1);
+    return true;
+}
+
+// Parses "p", "p/t", "p//n" or "p/t/n". A missing texcoord or normal maps to
+// the default appended at index `count`.
+static bool obj_corner(const Obj *obj, char *token, unsigned int corner[3]) {
+    char *t = strchr(token, '/');
+    char *n = t ? strchr(t + 1, '/') : NULL;
+
+    if (!obj_index(token, obj->positions.count / 3, &corner[0])) return false;
+    corner[1] = obj->texcoords.count / 2;
+    corner[2] = obj->normals.count / 3;
+    if (t && t[1] != '/' && t[1] != '\0' && !obj_index(t + 1, obj->texcoords.count / 2, &corner[1])) return false;
+    if (n && n[1] != '\0' && !obj_index(n + 1, obj->normals.count / 3, &corner[2])) return false;
+    return true;
+}
+
+static bool obj_load(Obj *obj, const char *path) {
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        LOG("cannot open %s\n", path);
+        return false;
+    }
+
+    char line[1024];
+    int number = 0;
+    bool ok = true;
+    while (ok && fgets(line, sizeof(line), file)) {
+        number++;
+        float x, y, z;
+
+        if (sscanf(line, "v %f %f %f", &x, &y, &z) == 3) {
+            ok = float_push(&obj->positions, x) && float_push(&obj->positions, y) && float_push(&obj->positions, z);
+        } else if (sscanf(line, "vt %f %f", &x, &y) == 2) {
+            ok = float_push(&obj->texcoords, x) && float_push(&obj->texcoords, y);
+        } else if (sscanf(line, "vn %f %f %f", &x, &y, &z) == 3) {
+            ok = float_push(&obj->normals, x) && float_push(&obj->normals, y) && float_push(&obj->normals, z);
+        } else if (strncmp(line, "mtllib ", 7) == 0) {
+            sscanf(line + 7, "%255s", obj->mtllib);
+        } else if (strncmp(line, "f ", 2) == 0) {
+            // polygons are triangulated as fans around their first corner
+            unsigned int first[3], previous[3], corner[3];
+            int corners = 0;
+            for (char *token = strtok(line + 2, " \t\r\n"); ok && token; token = strtok(NULL, " \t\r\n"), corners++) {
+                if (!obj_corner(obj, token, corner)) {
+                    LOG("%s:%d: bad face corner %s\n", path, number, token);
+                    ok = false;
+                    break;
+                }
+                if (corners == 0) memcpy(first, corner, sizeof(first));
+                if (corners >= 2) {
+                    const unsigned int *triangle[3] = {first, previous, corner};
+                    for (int i = 0; ok && i < 3; i++) {
+                        ok = index_push(&obj->position_indices, triangle[i][0]) && index_push(&obj->texcoord_indices, triangle[i][1]) && index_push(&obj->normal_indices, triangle[i][2]);
+                    }
+                }
+                memcpy(previous, corner, sizeof(previous));
+            }
+        }
+    }
+    fclose(file);
+
+    // defaults for corners without a texcoord or a normal
+    return ok && float_push(&obj->texcoords, 0.0f) && float_push(&obj->texcoords, 0.0f) && float_push(&obj->normals, 0.0f) && float_push(&obj->normals, 0.0f) && float_push(&obj->normals, 1.0f);
+}
+
+static void mtl_load(MeshFileHeader *header, const char *path) {
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        LOG("cannot open %s, using the default material\n", path);
+        return;
+    }
+
+    char line[1024];
+    int materials = 0;
+    while (fgets(line, sizeof(line), file)) {
+        if (strncmp(line, "newmtl ", 7) == 0 && ++materials > 1) break;
+        float *v;
+        if (sscanf(line, "Ns %f", &header->shininess) == 1) continue;
+        if (sscanf(line, "Ni %f", &header->ior) == 1) continue;
+        if (sscanf(line, "d %f", &header->opacity) == 1) continue;
+        if (sscanf(line, "illum %d", &header->illum) == 1) continue;
+        if (sscanf(line, "map_Kd %63s", header->texture_map) == 1) continue;
+        v = header->ambient;
+        if (sscanf(line, "Ka %f %f %f", &v[0], &v[1], &v[2]) == 3) continue;
+        v = header->specular;
+        if (sscanf(line, "Ks %f %f %f", &v[0], &v[1], &v[2]) == 3) continue;
+        v = header->emissive;
+        if (sscanf(line, "Ke %f %f %f", &v[0], &v[1], &v[2]) == 3) continue;
+    }
+    if (materials > 1) LOG("%s: only the first material is kept\n", path);
+    fclose(file);
+}
+
+// IEEE half, round to nearest even; out of range goes to infinity.
+static uint16_t half_from_float(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    uint32_t sign = (bits >> 16) & 0x8000;
+    int32_t exponent = (int32_t)((bits >> 23) & 0xff) - 127 + 15;
+    uint32_t mantissa = bits & 0x7fffff;
+
+    if (((bits >> 23) & 0xff) == 0xff) return sign | 0x7c00 | (mantissa ? 0x200 : 0);
+    if (exponent >= 31) return sign | 0x7c00;
+    if (exponent <= 0) {
+        if (exponent < -10) return sign;
+        mantissa |= 0x800000;
+        uint32_t shift = 14 - exponent;
+        uint32_t half = mantissa >> shift;
+        uint32_t rest = mantissa & ((1u << shift) - 1);
+        uint32_t middle = 1u << (shift - 1);
+        if (rest > middle || (rest == middle && (half & 1))) half++;
+        return sign | half;
+    }
+
+    uint32_t half = sign | (exponent << 10) | (mantissa >> 13);
+    uint32_t rest = mantissa & 0x1fff;
+    if (rest > 0x1000 || (rest == 0x1000 && (half & 1))) half++;
+    return half;
+}
+
+static int16_t snorm16(float value) {
+    if (value > 1.0f) value = 1.0f;
+    if (value < -1.0f) value = -1.0f;
+    return (int16_t)lrintf(value * 32767.0f);
+}
+
+static int8_t snorm8(float value) {
+    if (value > 1.0f) value = 1.0f;
+    if (value < -1.0f) value = -1.0f;
+    return (int8_t)lrintf(value * 127.0f);
+}
+
+static uint32_t align4(uint32_t size) {
+    return (size + 3) & ~3u;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        LOG("usage: %s model.obj model.mesh\n", argv[0]);
+        return 1;
+    }
+
+    Obj obj;
+    memset(&obj, 0, sizeof(obj));
+    if (!obj_load(&obj, argv[1])) return 1;
+
+    Mesh mesh;
+    if (!mesh_weld(&mesh, obj.positions.data, obj.texcoords.data, obj.normals.data, obj.position_indices.data, obj.texcoord_indices.data, obj.normal_indices.data, obj.position_indices.count)) {
+        LOG("out of memory\n");
+        return 1;
+    }
+
+    // ACMR/ATVR against a FIFO of MESH_CACHE_SIZE after every pass
+    MeshCacheStats stats;
+    mesh_cache_stats(mesh.indices, mesh.index_count, mesh.vertex_count, MESH_CACHE_SIZE, &stats);
+    LOG("%-12s acmr %.3f atvr %.3f\n", "obj order", stats.acmr, stats.atvr);
+
+    bool optimized = mesh_optimize_vertex_cache(mesh.indices, mesh.index_count, mesh.vertex_count);
+    mesh_cache_stats(mesh.indices, mesh.index_count, mesh.vertex_count, MESH_CACHE_SIZE, &stats);
+    LOG("%-12s acmr %.3f atvr %.3f\n", "cache", stats.acmr, stats.atvr);
+
+    optimized = optimized && mesh_optimize_overdraw(mesh.indices, mesh.index_count, mesh.vertices, mesh.vertex_count, 1.05f);
+    mesh_cache_stats(mesh.indices, mesh.index_count, mesh.vertex_count, MESH_CACHE_SIZE, &stats);
+    LOG("%-12s acmr %.3f atvr %.3f\n", "overdraw", stats.acmr, stats.atvr);
+
+    uint32_t vertex_count = optimized ? mesh_optimize_vertex_fetch(mesh.vertices, mesh.vertex_count, mesh.indices, mesh.index_count) : 0;
+    if (!vertex_count && mesh.vertex_count) {
+        LOG("out of memory\n");
+        return 1;
+    }
+    mesh.vertex_count = vertex_count;
+
+    MeshFileHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = MESH_FILE_MAGIC;
+    header.version = MESH_FILE_VERSION;
+    header.vertex_count = mesh.vertex_count;
+    header.index_count = mesh.index_count;
+    header.index_size = mesh.vertex_count <= 65536 ? 2 : 4;
+    header.vertex_offset = align4(sizeof(MeshFileHeader));
+    header.index_offset = align4(header.vertex_offset + mesh.vertex_count * sizeof(MeshPackedVertex));
+    header.ambient[0] = header.ambient[1] = header.ambient[2] = 1.0f;
+    header.opacity = 1.0f;
+
+    if (obj.mtllib[0]) {
+        char path[1024];
+        const char *slash = strrchr(argv[1], '/');
+        snprintf(path, sizeof(path), "%.*s%s", slash ? (int)(slash - argv[1] + 1) : 0, argv[1], obj.mtllib);
+        mtl_load(&header, path);
+    }
+
+    // positions are stored relative to the bounding box
+    float low[3] = {INFINITY, INFINITY, INFINITY};
+    float high[3] = {-INFINITY, -INFINITY, -INFINITY};
+    for (uint32_t i = 0; i < mesh.vertex_count; i++) {
+        for (int k = 0; k < 3; k++) {
+            low[k] = fminf(low[k], mesh.vertices[i].position[k]);
+            high[k] = fmaxf(high[k], mesh.vertices[i].position[k]);
+        }
+    }
+    for (int k = 0; k < 3; k++) {
+        header.position_offset[k] = mesh.vertex_count ? (low[k] + high[k]) * 0.5f : 0.0f;
+        header.position_scale[k] = mesh.vertex_count && high[k] > low[k] ? (high[k] - low[k]) * 0.5f : 1.0f;
+    }
+
+    MeshPackedVertex *packed = (MeshPackedVertex *)calloc(mesh.vertex_count ? mesh.vertex_count : 1, sizeof(MeshPackedVertex));
+    uint8_t *indices = (uint8_t *)malloc(mesh.index_count ? mesh.index_count * header.index_size : 1);
+    if (!packed || !indices) {
+        LOG("out of memory\n");
+        return 1;
+    }
+
+    float position_error = 0.0f;
+    for (uint32_t i = 0; i < mesh.vertex_count; i++) {
+        const MeshVertex *v = &mesh.vertices[i];
+        MeshPackedVertex *p = &packed[i];
+        for (int k = 0; k < 3; k++) {
+            p->position[k] = snorm16((v->position[k] - header.position_offset[k]) / header.position_scale[k]);
+            p->normal[k] = snorm8(v->normal[k]);
+            position_error = fmaxf(position_error, fabsf(p->position[k] / 32767.0f * header.position_scale[k] + header.position_offset[k] - v->position[k]));
+        }
+        p->texcoord[0] = half_from_float(v->texcoord[0]);
+        p->texcoord[1] = half_from_float(v->texcoord[1]);
+    }
+
+    for (uint32_t i = 0; i < mesh.index_count; i++) {
+        if (header.index_size == 2) {
+            uint16_t index = (uint16_t)mesh.indices[i];
+            memcpy(indices + i * 2, &index, 2);
+        } else {
+            memcpy(indices + i * 4, &mesh.indices[i], 4);
+        }
+    }
+
+    FILE *file = fopen(argv[2], "wb");
+    if (!file) {
+        LOG("cannot create %s\n", argv[2]);
+        return 1;
+    }
+
+    static const uint8_t zeros[4] = {0};
+    fwrite(&header, sizeof(header), 1, file);
+    fwrite(zeros, header.vertex_offset - sizeof(header), 1, file);
+    fwrite(packed, sizeof(MeshPackedVertex), mesh.vertex_count, file);
+    fwrite(zeros, header.index_offset - header.vertex_offset - mesh.vertex_count * sizeof(MeshPackedVertex), 1, file);
+    fwrite(indices, header.index_size, mesh.index_count, file);
+    bool failed = ferror(file) != 0;
+    failed |= fclose(file) != 0;
+    if (failed) {
+        LOG("cannot write %s\n", argv[2]);
+        return 1;
+    }
+
+    uint32_t size = header.index_offset + mesh.index_count * header.index_size;
+    LOG("%s: %u corners -> %u vertices, %u-bit indices, %u bytes (%u as floats), max position error %g\n", argv[2], obj.position_indices.count, mesh.vertex_count, header.index_size * 8, size,
+        (unsigned)(mesh.vertex_count * sizeof(MeshVertex) + mesh.index_count * 4), position_error);
+
+    free(packed);
+    free(indices);
+    mesh_free(&mesh);
+    free(obj.positions.data);
+    free(obj.texcoords.data);
+    free(obj.normals.data);
+    free(obj.position_indices.data);
+    free(obj.texcoord_indices.data);
+    free(obj.normal_indices.data);
+    return 0;
+}
@@ -1,5332 +0,0 @@
-#define VERTICES_COUNT 596
-#define NORMALS_COUNT 594
-#define TEXTURE_COORDS_COUNT 663
-#define MATERIAL_SHININESS 250.000000
-static const float MATERIAL_AMBIENT[3] = { 1.000000, 1.000000, 1.000000 };
-static const float MATERIAL_SPECULAR[3] = { 0.500000, 0.500000, 0.500000 };
-static const float MATERIAL_EMISSIVE[3] = { 0.000000, 0.000000, 0.000000 };
-#define MATERIAL_IOR 1.500000
-#define MATERIAL_OPACITY 1.000000
-#define MATERIAL_ILLUM 2
-static const char *MATERIAL_TEXTURE_MAP = "penger.png";
-static const float vertices[1788] = {
-     -0.086914, +0.777547, +0.400041,
-     -0.069555, +0.829698, +0.376422,
-     -0.125429, +0.805056, +0.175577,
-     -0.087431, +0.859323, +0.182228,
-     +0.086914, +0.777547, +0.400041,
-     +0.069555, +0.829698, +0.376422,
-     +0.125429, +0.805056, +0.175577,
-     +0.087431, +0.859323, +0.182228,
-     -0.162461, +0.831177, +0.163170,
-     -0.120032, +0.785356, +0.287080,
-     +0.000000, +0.816913, +0.150254,
-     +0.000000, +0.931152, +0.159026,
-     +0.162461, +0.831177, +0.163170,
-     +0.120032, +0.785356, +0.287080,
-     +0.038632, +0.851515, +0.295188,
-     +0.112575, +0.800152, +0.416327,
-     +0.000000, +0.783376, +0.423906,
-     +0.000000, +0.839429, +0.443461,
-     -0.038632, +0.851515, +0.295188,
-     +0.000000, +0.833645, +0.122512,
-     +0.151316, +0.813187, +0.289445,
-     +0.000000, +0.807518, +0.456379,
-     +0.000000, +0.799713, +0.285755,
-     +0.000000, +0.863275, +0.294437,
-     -0.112575, +0.800152, +0.416327,
-     +0.093738, +0.749308, +0.407523,
-     +0.080099, +0.856611, +0.384454,
-     +0.132657, +0.778000, +0.164820,
-     +0.105284, +0.882964, +0.177497,
-     -0.151316, +0.813187, +0.289445,
-     +0.000000, +0.790410, +0.136199,
-     +0.000000, +0.960646, +0.153539,
-     +0.188457, +0.829885, +0.148254,
-     +0.129281, +0.756856, +0.285586,
-     +0.051895, +0.877119, +0.303468,
-     +0.135150, +0.799588, +0.436077,
-     +0.000000, +0.755364, +0.434645,
-     +0.000000, +0.866105, +0.457187,
-     -0.093738, +0.749308, +0.407523,
-     +0.000000, +0.828010, +0.093046,
-     +0.180592, +0.816698, +0.294976,
-     +0.000000, +0.810560, +0.486224,
-     +0.000000, +0.769968, +0.281850,
-     +0.000000, +0.890575, +0.306875,
-     -0.080099, +0.856611, +0.384454,
-     -0.132657, +0.778000, +0.164820,
-     -0.105284, +0.882964, +0.177497,
-     -0.188457, +0.829885, +0.148254,
-     -0.129281, +0.756856, +0.285586,
-     -0.051895, +0.877119, +0.303468,
-     -0.135150, +0.799588, +0.436077,
-     -0.180592, +0.816698, +0.294976,
-     +0.118885, +0.899961, +0.192279,
-     +0.100036, +0.933856, +0.198983,
-     +0.102966, +0.896398, +0.165539,
-     +0.084118, +0.930293, +0.172243,
-     +0.176608, +0.939909, +0.152593,
-     +0.157760, +0.973804, +0.159297,
-     +0.160690, +0.936346, +0.125853,
-     +0.141841, +0.970241, +0.132557,
-     +0.106666, +0.890088, +0.182523,
-     +0.104880, +0.912922, +0.202910,
-     +0.083687, +0.931411, +0.190696,
-     +0.085473, +0.908578, +0.170310,
-     +0.132149, +0.912268, +0.142032,
-     +0.109170, +0.953590, +0.150205,
-     +0.155846, +0.957280, +0.121927,
-     +0.177039, +0.938791, +0.134140,
-     +0.154060, +0.980114, +0.142313,
-     +0.175253, +0.961624, +0.154527,
-     +0.151556, +0.916612, +0.174632,
-     +0.128577, +0.957934, +0.182805,
-     +0.081904, +0.901564, +0.195735,
-     +0.116999, +0.932110, +0.139970,
-     +0.178822, +0.968638, +0.129101,
-     +0.143727, +0.938092, +0.184867,
-     +0.146186, +0.906646, +0.156790,
-     +0.114539, +0.963556, +0.168046,
-     -0.118885, +0.899961, +0.192279,
-     -0.100036, +0.933856, +0.198983,
-     -0.102966, +0.896398, +0.165539,
-     -0.084118, +0.930293, +0.172243,
-     -0.176608, +0.939909, +0.152593,
-     -0.157760, +0.973804, +0.159297,
-     -0.160690, +0.936346, +0.125853,
-     -0.141841, +0.970241, +0.132557,
-     -0.106666, +0.890088, +0.182523,
-     -0.104880, +0.912922, +0.202910,
-     -0.083687, +0.931411, +0.190696,
-     -0.085473, +0.908578, +0.170310,
-     -0.132149, +0.912268, +0.142032,
-     -0.109170, +0.953590, +0.150205,
-     -0.155846, +0.957280, +0.121927,
-     -0.177039, +0.938791, +0.134140,
-     -0.154060, +0.980114, +0.142313,
-     -0.175253, +0.961624, +0.154527,
-     -0.151556, +0.916612, +0.174632,
-     -0.128577, +0.957934, +0.182805,
-     -0.081904, +0.901564, +0.195735,
-     -0.116999, +0.932110, +0.139970,
-     -0.178822, +0.968638, +0.129102,
-     -0.143727, +0.938092, +0.184867,
-     -0.146187, +0.906646, +0.156790,
-     -0.114539, +0.963556, +0.168046,
-     +0.116485, +1.100505, +0.141727,
-     +0.261417, +0.200098, +0.348366,
-     -0.116485, +1.100505, +0.141727,
-     -0.261417, +0.200098, +0.348366,
-     +0.112046, +1.157167, -0.052576,
-     +0.239249, +0.214387, -0.195621,
-     -0.112046, +1.157167, -0.052576,
-     -0.239249, +0.214387, -0.195621,
-     +0.182365, +0.086114, -0.130600,
-     -0.182365, +0.086114, -0.130600,
-     +0.185370, +0.088873, +0.285766,
-     -0.185370, +0.088873, +0.285766,
-     -0.000000, +0.219302, -0.288600,
-     +0.000000, +1.185597, -0.059119,
-     -0.000000, +0.197646, +0.418056,
-     +0.000000, +0.073265, -0.175525,
-     -0.000000, +1.116801, +0.172179,
-     +0.346767, +0.186055, +0.082211,
-     +0.134460, +1.152623, +0.053817,
-     +0.226383, +0.065407, +0.081386,
-     +0.000000, +0.093950, +0.064396,
-     -0.000000, +1.202832, +0.076074,
-     +0.148239, +0.999868, -0.129503,
-     +0.167399, +0.717376, -0.179106,
-     +0.000000, +1.010360, -0.177507,
-     +0.000000, +0.722228, -0.243510,
-     +0.000000, +0.078977, +0.303086,
-     -0.346767, +0.186055, +0.082211,
-     -0.134460, +1.152623, +0.053817,
-     +0.253877, +0.706739, -0.012612,
-     +0.214625, +0.979434, +0.003080,
-     +0.158129, +0.950290, +0.133907,
-     +0.188613, +0.688153, +0.148241,
-     +0.000000, +0.944652, +0.202967,
-     -0.000000, +0.689861, +0.237317,
-     -0.226383, +0.065407, +0.081386,
-     +0.228074, +0.440323, -0.205451,
-     +0.000000, +0.444399, -0.288645,
-     -0.000000, +0.422331, +0.380767,
-     -0.148239, +0.999868, -0.129503,
-     -0.167399, +0.717376, -0.179106,
-     +0.336477, +0.428624, +0.037431,
-     +0.258730, +0.418837, +0.294948,
-     -0.253877, +0.706739, -0.012612,
-     -0.214625, +0.979434, +0.003080,
-     -0.158129, +0.950290, +0.133907,
-     -0.188613, +0.688153, +0.148241,
-     -0.228074, +0.440323, -0.205451,
-     -0.336477, +0.428624, +0.037431,
-     -0.258730, +0.418837, +0.294948,
-     +0.066239, +1.177571, -0.057217,
-     +0.213490, +0.131626, -0.165516,
-     +0.128870, +0.219724, -0.267035,
-     +0.106735, +0.077250, -0.160566,
-     +0.000000, +0.126377, -0.249661,
-     +0.314673, +0.198293, -0.071136,
-     -0.314673, +0.198293, -0.071136,
-     +0.210922, +0.071390, -0.043983,
-     +0.000000, +0.076945, -0.065328,
-     -0.244201, +0.319222, -0.207684,
-     +0.126667, +1.163471, -0.006633,
-     -0.195294, +0.991192, -0.068821,
-     +0.000000, +1.211143, +0.010063,
-     -0.213490, +0.131626, -0.165516,
-     +0.071185, +1.191313, +0.070402,
-     -0.155241, +0.865055, -0.158770,
-     +0.303068, +0.103034, +0.087021,
-     -0.132112, +1.102600, -0.089009,
-     +0.120944, +0.077310, +0.070511,
-     +0.183037, +1.081878, +0.028539,
-     +0.132112, +1.102600, -0.089009,
-     +0.155241, +0.865055, -0.158770,
-     +0.244201, +0.319222, -0.207684,
-     +0.000000, +1.117590, -0.123992,
-     +0.000000, +0.872508, -0.215321,
-     +0.000000, +0.325970, -0.298421,
-     +0.103174, +0.687991, +0.210662,
-     +0.000000, +0.301556, +0.419635,
-     -0.294693, +0.565372, +0.007647,
-     -0.129550, +1.127979, +0.107967,
-     +0.294693, +0.565372, +0.007647,
-     +0.232020, +0.849539, -0.013046,
-     +0.000000, +0.823920, +0.208490,
-     +0.088589, +0.720688, -0.227407,
-     +0.079730, +1.007125, -0.165927,
-     -0.232020, +0.849539, -0.013046,
-     +0.195294, +0.991192, -0.068821,
-     +0.226314, +0.713436, -0.101955,
-     +0.170260, +0.826295, +0.126748,
-     -0.000000, +1.042220, +0.194351,
-     +0.138605, +1.045492, +0.141718,
-     -0.210922, +0.071390, -0.043983,
-     +0.224239, +0.127127, +0.324377,
-     -0.000000, +0.118600, +0.379001,
-     +0.107381, +0.082266, +0.299738,
-     +0.069123, +1.112108, +0.162110,
-     +0.144110, +0.200197, +0.404857,
-     +0.273464, +0.299769, +0.340419,
-     +0.086530, +0.945098, +0.182669,
-     -0.170260, +0.826295, +0.126748,
-     +0.000000, +1.170466, +0.131824,
-     -0.226314, +0.713436, -0.101955,
-     +0.129550, +1.127979, +0.107967,
-     -0.126667, +1.163471, -0.006633,
-     +0.240899, +0.696199, +0.072126,
-     +0.202094, +0.963683, +0.072293,
-     -0.224239, +0.127127, +0.324377,
-     +0.196495, +0.573973, -0.194947,
-     +0.000000, +0.577321, -0.268617,
-     -0.000000, +0.553716, +0.306623,
-     +0.356649, +0.298828, +0.064475,
-     +0.223708, +0.550083, +0.216822,
-     +0.302413, +0.435133, -0.098045,
-     -0.138605, +1.045492, +0.141718,
-     +0.143359, +0.420422, +0.361124,
-     -0.273464, +0.299769, +0.340419,
-     +0.122283, +0.443412, -0.268697,
-     +0.323489, +0.422181, +0.178606,
-     -0.183037, +1.081878, +0.028539,
-     +0.211567, +0.074486, +0.204949,
-     +0.329913, +0.190801, +0.232998,
-     -0.303068, +0.103034, +0.087021,
-     +0.000000, +0.083871, +0.193289,
-     -0.240899, +0.696199, +0.072126,
-     -0.202094, +0.963683, +0.072293,
-     -0.196495, +0.573973, -0.194947,
-     -0.356649, +0.298828, +0.064475,
-     -0.223708, +0.550083, +0.216822,
-     -0.302413, +0.435133, -0.098045,
-     -0.323489, +0.422181, +0.178606,
-     -0.211567, +0.074486, +0.204949,
-     -0.329913, +0.190801, +0.232998,
-     -0.120944, +0.077310, +0.070511,
-     -0.128870, +0.219724, -0.267035,
-     -0.106735, +0.077250, -0.160566,
-     -0.071185, +1.191312, +0.070402,
-     -0.103174, +0.687991, +0.210662,
-     -0.144110, +0.200197, +0.404857,
-     -0.066239, +1.177571, -0.057217,
-     -0.079730, +1.007125, -0.165927,
-     -0.088589, +0.720688, -0.227407,
-     -0.069123, +1.112108, +0.162110,
-     -0.107381, +0.082266, +0.299738,
-     -0.086530, +0.945098, +0.182669,
-     -0.143359, +0.420422, +0.361124,
-     -0.122283, +0.443412, -0.268697,
-     -0.116187, +0.130914, -0.229604,
-     -0.072661, +1.112795, -0.116367,
-     +0.116187, +0.130913, -0.229604,
-     +0.113112, +0.075394, +0.196042,
-     +0.218688, +0.836754, +0.060131,
-     -0.082517, +0.870222, -0.201199,
-     -0.342146, +0.297255, +0.218515,
-     -0.277483, +0.115220, -0.052960,
-     +0.342146, +0.297255, +0.218515,
-     -0.123321, +0.551288, +0.282574,
-     +0.104612, +0.576285, -0.250504,
-     -0.263362, +0.570961, -0.103638,
-     +0.072661, +1.112795, -0.116367,
-     +0.068288, +1.200296, +0.006932,
-     -0.218688, +0.836754, +0.060131,
-     -0.068288, +1.200296, +0.006932,
-     +0.092843, +0.823418, +0.183578,
-     +0.277483, +0.115220, -0.052960,
-     -0.092843, +0.823418, +0.183578,
-     +0.114344, +0.069341, -0.055794,
-     -0.069793, +1.161151, +0.124576,
-     +0.123321, +0.551288, +0.282574,
-     -0.113112, +0.075394, +0.196042,
-     +0.123369, +0.124214, +0.369703,
-     +0.069793, +1.161151, +0.124576,
-     -0.169024, +1.094663, -0.036361,
-     -0.151487, +0.301276, +0.403451,
-     +0.082517, +0.870222, -0.201199,
-     +0.284665, +0.113243, +0.223581,
-     -0.284665, +0.113243, +0.223581,
-     -0.077124, +1.041621, +0.179388,
-     -0.123369, +0.124214, +0.369703,
-     +0.322028, +0.308268, -0.086948,
-     -0.114344, +0.069341, -0.055794,
-     +0.169024, +1.094663, -0.036361,
-     +0.208363, +0.858708, -0.090994,
-     +0.077124, +1.041621, +0.179388,
-     -0.322028, +0.308268, -0.086948,
-     +0.173487, +1.062450, +0.090260,
-     +0.263362, +0.570961, -0.103638,
-     -0.173487, +1.062450, +0.090260,
-     -0.131368, +0.324783, -0.277201,
-     -0.208363, +0.858708, -0.090994,
-     +0.151487, +0.301276, +0.403451,
-     -0.282070, +0.556411, +0.120093,
-     +0.131368, +0.324783, -0.277201,
-     +0.282071, +0.556411, +0.120093,
-     -0.104612, +0.576285, -0.250504,
-     +0.139456, +1.115482, +0.170848,
-     +0.287271, +0.189966, +0.377156,
-     -0.139456, +1.115482, +0.170848,
-     -0.287271, +0.189966, +0.377156,
-     +0.133667, +1.185114, -0.071325,
-     +0.266366, +0.203725, -0.223025,
-     -0.133667, +1.185114, -0.071325,
-     -0.266366, +0.203726, -0.223025,
-     +0.195667, +0.051247, -0.144999,
-     -0.195667, +0.051247, -0.144999,
-     +0.194474, +0.052243, +0.299008,
-     -0.194474, +0.052243, +0.299008,
-     +0.000000, +0.209464, -0.327372,
-     +0.000000, +1.219137, -0.080914,
-     +0.000000, +0.188516, +0.457000,
-     -0.000000, +0.035680, -0.189215,
-     +0.000000, +1.134596, +0.208003,
-     +0.384990, +0.174395, +0.080468,
-     +0.162868, +1.179727, +0.061455,
-     +0.235551, +0.026472, +0.081467,
-     +0.000000, +0.053964, +0.065479,
-     -0.000000, +1.240713, +0.088920,
-     +0.173912, +1.011387, -0.157932,
-     +0.193708, +0.724703, -0.208332,
-     -0.000000, +1.024361, -0.214977,
-     +0.000000, +0.729344, -0.282872,
-     +0.000000, +0.040320, +0.313365,
-     -0.384990, +0.174395, +0.080468,
-     -0.162868, +1.179727, +0.061455,
-     +0.292852, +0.715413, -0.014998,
-     +0.253766, +0.987671, +0.002714,
-     +0.185951, +0.952824, +0.162535,
-     +0.215515, +0.701473, +0.174678,
-     +0.000000, +0.946738, +0.242913,
-     +0.000000, +0.703927, +0.274763,
-     -0.235551, +0.026472, +0.081467,
-     +0.255368, +0.446432, -0.234047,
-     -0.000000, +0.449117, -0.328366,
-     +0.000000, +0.439027, +0.417116,
-     -0.173912, +1.011387, -0.157932,
-     -0.193708, +0.724703, -0.208332,
-     +0.375424, +0.437400, +0.034948,
-     +0.284700, +0.435181, +0.320607,
-     -0.292852, +0.715413, -0.014998,
-     -0.253766, +0.987671, +0.002714,
-     -0.185951, +0.952824, +0.162535,
-     -0.215515, +0.701473, +0.174678,
-     -0.255368, +0.446432, -0.234047,
-     -0.375424, +0.437400, +0.034948,
-     -0.284700, +0.435181, +0.320607,
-     +0.076969, +1.209939, -0.078126,
-     +0.236028, +0.108130, -0.188755,
-     +0.142717, +0.209637, -0.303181,
-     +0.112677, +0.040335, -0.174778,
-     +0.000000, +0.101844, -0.281254,
-     +0.350053, +0.187057, -0.086034,
-     -0.350053, +0.187057, -0.086034,
-     +0.222273, +0.033577, -0.050412,
-     -0.000000, +0.036973, -0.063835,
-     -0.272234, +0.318950, -0.236216,
-     +0.153140, +1.192878, -0.012504,
-     -0.230594, +1.001151, -0.084781,
-     +0.000000, +1.250939, +0.006027,
-     -0.236028, +0.108130, -0.188755,
-     +0.085715, +1.226738, +0.081975,
-     -0.181373, +0.872182, -0.188204,
-     +0.331447, +0.074854, +0.086304,
-     -0.156519, +1.122257, -0.113866,
-     +0.117699, +0.037449, +0.071304,
-     +0.219507, +1.098061, +0.031380,
-     +0.156519, +1.122257, -0.113866,
-     +0.181373, +0.872182, -0.188204,
-     +0.272234, +0.318950, -0.236216,
-     -0.000000, +1.140332, -0.156898,
-     +0.000000, +0.881317, -0.254339,
-     +0.000000, +0.325735, -0.338420,
-     +0.118953, +0.701990, +0.244648,
-     +0.000000, +0.307976, +0.459117,
-     -0.332953, +0.576790, +0.005233,
-     -0.156442, +1.149940, +0.127831,
-     +0.332953, +0.576790, +0.005233,
-     +0.271568, +0.855224, -0.014936,
-     +0.000000, +0.828915, +0.248177,
-     +0.102444, +0.727876, -0.264236,
-     +0.092320, +1.020357, -0.201514,
-     -0.271568, +0.855224, -0.014936,
-     +0.230594, +1.001151, -0.084781,
-     +0.261398, +0.720992, -0.119618,
-     +0.198368, +0.831051, +0.154807,
-     +0.000000, +1.049056, +0.233763,
-     +0.164996, +1.052710, +0.170897,
-     -0.222273, +0.033577, -0.050412,
-     +0.243011, +0.100535, +0.347626,
-     +0.000000, +0.091090, +0.408039,
-     +0.110234, +0.044142, +0.311504,
-     +0.081739, +1.129230, +0.195987,
-     +0.154778, +0.190977, +0.442290,
-     +0.300922, +0.305702, +0.368894,
-     +0.102604, +0.946974, +0.219249,
-     -0.198368, +0.831051, +0.154807,
-     -0.000000, +1.200544, +0.158192,
-     -0.261398, +0.720992, -0.119618,
-     +0.156442, +1.149940, +0.127831,
-     -0.153139, +1.192878, -0.012504,
-     +0.276552, +0.707282, +0.086480,
-     +0.238355, +0.968905, +0.088351,
-     -0.243011, +0.100535, +0.347626,
-     +0.223019, +0.582269, -0.223716,
-     +0.000000, +0.583858, -0.308079,
-     +0.000000, +0.573428, +0.341429,
-     +0.396566, +0.299805, +0.062092,
-     +0.248899, +0.569216, +0.241302,
-     +0.338439, +0.442069, -0.113985,
-     -0.164996, +1.052710, +0.170897,
-     +0.155245, +0.437577, +0.395248,
-     -0.300922, +0.305702, +0.368894,
-     +0.136150, +0.448614, -0.305854,
-     +0.359578, +0.434799, +0.190369,
-     -0.219507, +1.098061, +0.031380,
-     +0.220460, +0.035971, +0.211073,
-     +0.365966, +0.179385, +0.246030,
-     -0.331447, +0.074854, +0.086304,
-     -0.000000, +0.043880, +0.192436,
-     -0.276552, +0.707282, +0.086480,
-     -0.238355, +0.968905, +0.088351,
-     -0.223019, +0.582269, -0.223716,
-     -0.396566, +0.299805, +0.062092,
-     -0.248899, +0.569216, +0.241302,
-     -0.338439, +0.442069, -0.113985,
-     -0.359578, +0.434799, +0.190369,
-     -0.220460, +0.035971, +0.211073,
-     -0.365966, +0.179384, +0.246030,
-     -0.117699, +0.037449, +0.071304,
-     -0.142717, +0.209637, -0.303181,
-     -0.112677, +0.040335, -0.174778,
-     -0.085715, +1.226738, +0.081975,
-     -0.118953, +0.701990, +0.244648,
-     -0.154778, +0.190977, +0.442290,
-     -0.076969, +1.209939, -0.078126,
-     -0.092320, +1.020357, -0.201514,
-     -0.102444, +0.727876, -0.264236,
-     -0.081739, +1.129230, +0.195987,
-     -0.110234, +0.044142, +0.311504,
-     -0.102604, +0.946974, +0.219249,
-     -0.155245, +0.437577, +0.395248,
-     -0.136150, +0.448614, -0.305854,
-     -0.127815, +0.107103, -0.259568,
-     -0.083673, +1.134534, -0.148087,
-     +0.127815, +0.107103, -0.259568,
-     +0.111491, +0.035439, +0.197029,
-     +0.255177, +0.841892, +0.075693,
-     -0.096035, +0.878509, -0.237922,
-     -0.380059, +0.300592, +0.230823,
-     -0.305465, +0.089413, -0.065249,
-     +0.380059, +0.300592, +0.230823,
-     -0.136479, +0.571296, +0.314614,
-     +0.118420, +0.583400, -0.287365,
-     -0.298474, +0.580339, -0.120346,
-     +0.083673, +1.134534, -0.148087,
-     +0.081319, +1.237915, +0.003058,
-     -0.255177, +0.841892, +0.075693,
-     -0.081319, +1.237915, +0.003058,
-     +0.109808, +0.828218, +0.219483,
-     +0.305465, +0.089413, -0.065249,
-     -0.109808, +0.828218, +0.219483,
-     +0.113657, +0.029350, -0.056297,
-     -0.083372, +1.189810, +0.148954,
-     +0.136479, +0.571296, +0.314614,
-     -0.111491, +0.035439, +0.197029,
-     +0.130968, +0.097527, +0.398513,
-     +0.083372, +1.189810, +0.148954,
-     -0.202781, +1.112807, -0.047817,
-     -0.163077, +0.307992, +0.441141,
-     +0.096035, +0.878509, -0.237922,
-     +0.310921, +0.085245, +0.234838,
-     -0.310921, +0.085245, +0.234838,
-     -0.091241, +1.047897, +0.216284,
-     -0.130968, +0.097527, +0.398513,
-     +0.358889, +0.308169, -0.102481,
-     -0.113657, +0.029350, -0.056297,
-     +0.202781, +1.112807, -0.047817,
-     +0.243685, +0.864892, -0.108716,
-     +0.091241, +1.047897, +0.216284,
-     -0.358889, +0.308169, -0.102481,
-     +0.207788, +1.074204, +0.107150,
-     +0.298474, +0.580339, -0.120346,
-     -0.207788, +1.074204, +0.107150,
-     -0.145457, +0.324547, -0.314637,
-     -0.243685, +0.864892, -0.108716,
-     +0.163077, +0.307992, +0.441141,
-     -0.316786, +0.571835, +0.132619,
-     +0.145457, +0.324547, -0.314637,
-     +0.316786, +0.571835, +0.132619,
-     -0.118420, +0.583400, -0.287365,
-     -0.508828, +0.011263, +0.156039,
-     -0.522541, +0.089935, +0.161508,
-     -0.282585, +0.011263, -0.115427,
-     -0.282585, +0.190227, -0.115427,
-     -0.361756, +0.011263, +0.278610,
-     -0.364664, +0.089935, +0.293084,
-     -0.135514, +0.011263, +0.007144,
-     -0.135514, +0.190227, +0.007144,
-     -0.411821, +0.004267, +0.006876,
-     -0.549731, +0.044418, +0.172353,
-     -0.411821, +0.211204, +0.006876,
-     -0.273911, +0.044418, -0.158601,
-     -0.184261, +0.004267, -0.083886,
-     -0.184261, +0.211204, -0.083886,
-     -0.094610, +0.044418, -0.009170,
-     -0.232520, +0.004267, +0.156307,
-     -0.232520, +0.211204, +0.156307,
-     -0.370430, +0.044418, +0.321783,
-     -0.460081, +0.004267, +0.247068,
-     -0.477521, +0.103880, +0.267995,
-     -0.445638, +0.044418, -0.021308,
-     -0.132239, +0.044418, -0.146306,
-     -0.198703, +0.044418, +0.184490,
-     -0.512102, +0.044418, +0.309488,
-     -0.322171, -0.010414, +0.081591,
-     -0.322171, +0.255226, +0.081591,
-     +0.508827, +0.011263, +0.156039,
-     +0.522541, +0.089935, +0.161508,
-     +0.282585, +0.011263, -0.115427,
-     +0.282585, +0.190227, -0.115427,
-     +0.361756, +0.011263, +0.278610,
-     +0.364664, +0.089935, +0.293084,
-     +0.135514, +0.011263, +0.007144,
-     +0.135514, +0.190227, +0.007144,
-     +0.411821, +0.004267, +0.006876,
-     +0.549731, +0.044418, +0.172353,
-     +0.411821, +0.211204, +0.006876,
-     +0.273911, +0.044418, -0.158601,
-     +0.184261, +0.004267, -0.083886,
-     +0.184261, +0.211204, -0.083886,
-     +0.094610, +0.044418, -0.009170,
-     +0.232520, +0.004267, +0.156307,
-     +0.232520, +0.211204, +0.156307,
-     +0.370430, +0.044418, +0.321783,
-     +0.460080, +0.004267, +0.247068,
-     +0.477521, +0.103880, +0.267995,
-     +0.445638, +0.044418, -0.021308,
-     +0.132239, +0.044418, -0.146306,
-     +0.198703, +0.044418, +0.184490,
-     +0.512102, +0.044418, +0.309488,
-     +0.322171, -0.010414, +0.081591,
-     +0.322171, +0.255226, +0.081591,
-     -0.526869, -0.024208, +0.152000,
-     -0.555296, +0.112752, +0.158961,
-     -0.289810, -0.024208, -0.132445,
-     -0.292530, +0.213963, -0.146049,
-     -0.354531, -0.024208, +0.295628,
-     -0.356255, +0.112752, +0.324844,
-     -0.117472, -0.024208, +0.011183,
-     -0.103601, +0.213963, +0.011407,
-     -0.425788, -0.031362, -0.004764,
-     -0.588868, +0.036314, +0.170732,
-     -0.436697, +0.238989, -0.007587,
-     -0.282718, +0.033088, -0.195938,
-     -0.175994, -0.033592, -0.093804,
-     -0.167515, +0.241468, -0.103978,
-     -0.056297, +0.033088, -0.007237,
-     -0.218553, -0.031362, +0.167947,
-     -0.213811, +0.238989, +0.178169,
-     -0.361782, +0.036314, +0.359987,
-     -0.468347, -0.033592, +0.256987,
-     -0.494838, +0.133348, +0.288774,
-     -0.475820, +0.034779, -0.045724,
-     -0.107523, +0.033947, -0.175962,
-     -0.169247, +0.034779, +0.209777,
-     -0.537439, +0.038600, +0.339889,
-     -0.322171, -0.050414, +0.081591,
-     -0.326703, +0.294595, +0.087030,
-     +0.526869, -0.024208, +0.152000,
-     +0.555296, +0.112752, +0.158961,
-     +0.289810, -0.024208, -0.132445,
-     +0.292530, +0.213963, -0.146049,
-     +0.354531, -0.024208, +0.295628,
-     +0.356255, +0.112752, +0.324844,
-     +0.117472, -0.024208, +0.011183,
-     +0.103601, +0.213963, +0.011407,
-     +0.425788, -0.031362, -0.004764,
-     +0.588867, +0.036314, +0.170732,
-     +0.436697, +0.238989, -0.007587,
-     +0.282718, +0.033088, -0.195938,
-     +0.175994, -0.033592, -0.093804,
-     +0.167515, +0.241468, -0.103978,
-     +0.056297, +0.033088, -0.007237,
-     +0.218553, -0.031362, +0.167947,
-     +0.213811, +0.238989, +0.178169,
-     +0.361782, +0.036314, +0.359987,
-     +0.468347, -0.033592, +0.256987,
-     +0.494838, +0.133348, +0.288774,
-     +0.475820, +0.034779, -0.045724,
-     +0.107523, +0.033947, -0.175962,
-     +0.169247, +0.034779, +0.209777,
-     +0.537439, +0.038600, +0.339889,
-     +0.322171, -0.050414, +0.081591,
-     +0.326703, +0.294595, +0.087030,
-};
-static const float normals[1782] = {
-     -0.229800, -0.938200, +0.258900,
-     -0.332100, +0.907400, +0.257700,
-     -0.253300, -0.885000, -0.390600,
-     -0.396000, +0.898300, -0.190300,
-     +0.229800, -0.938200, +0.258900,
-     +0.332100, +0.907400, +0.257700,
-     +0.253300, -0.885000, -0.390600,
-     +0.396000, +0.898300, -0.190300,
-     -0.853500, +0.130300, -0.504500,
-     -0.321800, -0.944800, -0.061600,
-     -0.000000, -0.934700, -0.355400,
-     -0.000000, +0.935600, -0.353000,
-     +0.853500, +0.130300, -0.504500,
-     +0.321800, -0.944800, -0.061600,
-     +0.299700, +0.939500, +0.165900,
-     +0.736200, +0.042700, +0.675400,
-     -0.000000, -0.947600, +0.319500,
-     -0.000000, +0.700000, +0.714200,
-     -0.299700, +0.939500, +0.165900,
-     -0.000000, -0.206000, -0.978500,
-     +0.975100, +0.137700, +0.173700,
-     -0.000000, -0.100500, +0.994900,
-     -0.000000, -0.991500, -0.130400,
-     -0.000000, +0.972000, +0.234800,
-     -0.736200, +0.042700, +0.675400,
-     -0.295800, +0.903800, -0.309400,
-     -0.403500, -0.864300, -0.300200,
-     -0.330900, +0.847800, +0.414400,
-     -0.486800, -0.836100, +0.253100,
-     -0.975100, +0.137700, +0.173700,
-     -0.000000, +0.891600, +0.452700,
-     -0.000000, -0.930100, +0.367300,
-     -0.849300, -0.099300, +0.518400,
-     -0.397200, +0.916700, +0.044200,
-     -0.361800, -0.906900, -0.216000,
-     -0.734700, -0.023800, -0.678000,
-     -0.000000, +0.904600, -0.426300,
-     -0.000000, -0.735200, -0.677900,
-     +0.295800, +0.903800, -0.309400,
-     -0.000000, +0.108200, +0.994100,
-     -0.974800, -0.141000, -0.172900,
-     -0.000000, -0.004100, -1.000000,
-     -0.000000, +0.992100, +0.125100,
-     -0.000000, -0.956700, -0.290900,
-     +0.403500, -0.864300, -0.300200,
-     +0.330900, +0.847800, +0.414400,
-     +0.486800, -0.836100, +0.253100,
-     +0.849300, -0.099300, +0.518400,
-     +0.397200, +0.916700, +0.044200,
-     +0.361800, -0.906900, -0.216000,
-     +0.734700, -0.023800, -0.678000,
-     +0.974800, -0.141000, -0.172900,
-     +0.392400, -0.623200, +0.676500,
-     -0.191300, +0.426400, +0.884100,
-     -0.325200, -0.783800, -0.529000,
-     -0.908900, +0.265800, -0.321400,
-     +0.908900, -0.265800, +0.321400,
-     +0.325200, +0.783800, +0.529000,
-     +0.191300, -0.426400, -0.884100,
-     -0.392400, +0.623200, -0.676500,
-     -0.039100, -0.987200, +0.154800,
-     +0.055900, -0.163700, +0.984900,
-     -0.810200, +0.399500, +0.429100,
-     -0.808700, -0.357300, -0.467400,
-     -0.069000, -0.651200, -0.755800,
-     -0.697700, +0.479600, -0.532100,
-     -0.055900, +0.163700, -0.984900,
-     +0.810200, -0.399500, -0.429100,
-     +0.039100, +0.987200, -0.154800,
-     +0.808700, +0.357300, +0.467400,
-     +0.697700, -0.479600, +0.532100,
-     +0.069000, +0.651200, +0.755800,
-     -0.715800, -0.495400, +0.492100,
-     -0.508200, -0.113800, -0.853700,
-     +0.715800, +0.495400, -0.492100,
-     +0.508200, +0.113800, +0.853700,
-     +0.478900, -0.861200, -0.170300,
-     -0.478900, +0.861200, +0.170300,
-     -0.392400, -0.623200, +0.676500,
-     +0.191300, +0.426400, +0.884100,
-     +0.325200, -0.783800, -0.529000,
-     +0.908900, +0.265800, -0.321400,
-     -0.908900, -0.265800, +0.321400,
-     -0.325200, +0.783800, +0.529000,
-     -0.191300, -0.426400, -0.884100,
-     +0.392400, +0.623200, -0.676500,
-     +0.039100, -0.987200, +0.154800,
-     -0.055900, -0.163700, +0.984900,
-     +0.810200, +0.399500, +0.429100,
-     +0.808700, -0.357300, -0.467400,
-     +0.069000, -0.651200, -0.755800,
-     +0.697700, +0.479600, -0.532100,
-     +0.055900, +0.163700, -0.984900,
-     -0.810200, -0.399500, -0.429100,
-     -0.039100, +0.987200, -0.154800,
-     -0.808700, +0.357300, +0.467400,
-     -0.697700, -0.479600, +0.532100,
-     -0.069000, +0.651200, +0.755800,
-     +0.715800, -0.495400, +0.492100,
-     +0.508200, -0.113800, -0.853700,
-     -0.715800, +0.495400, -0.492100,
-     -0.508200, +0.113800, +0.853700,
-     -0.478900, -0.861200, -0.170300,
-     +0.478900, +0.861200, +0.170300,
-     +0.574700, +0.377200, +0.726300,
-     +0.645400, -0.259800, +0.718300,
-     -0.574700, +0.377200, +0.726300,
-     -0.645400, -0.259800, +0.718300,
-     +0.533200, +0.714100, -0.453600,
-     +0.679000, -0.266800, -0.684000,
-     -0.533200, +0.714100, -0.453600,
-     -0.679000, -0.266800, -0.684000,
-     +0.333300, -0.860900, -0.384400,
-     -0.333300, -0.860900, -0.384400,
-     +0.233400, -0.912800, +0.335100,
-     -0.233400, -0.912800, +0.335100,
-     -0.000000, -0.244800, -0.969600,
-     -0.000000, +0.840200, -0.542200,
-     -0.000000, -0.233700, +0.972300,
-     -0.000000, -0.947900, -0.318600,
-     -0.000000, +0.449600, +0.893200,
-     +0.955600, -0.292000, -0.040100,
-     +0.709000, +0.677900, +0.194500,
-     +0.210300, -0.977600, -0.013000,
-     -0.000000, -0.999900, +0.013000,
-     -0.000000, +0.947500, +0.319700,
-     +0.638200, +0.281200, -0.716700,
-     +0.658100, +0.182700, -0.730400,
-     -0.000000, +0.351900, -0.936000,
-     -0.000000, +0.175900, -0.984400,
-     -0.000000, -0.975400, +0.220300,
-     -0.955600, -0.292000, -0.040100,
-     -0.709000, +0.677900, +0.194500,
-     +0.974800, +0.216000, -0.056700,
-     +0.979000, +0.203500, -0.009100,
-     +0.698500, +0.060900, +0.713100,
-     +0.675600, +0.336000, +0.656200,
-     -0.000000, +0.057900, +0.998300,
-     -0.000000, +0.352700, +0.935700,
-     -0.210300, -0.977600, -0.013000,
-     +0.678500, +0.157300, -0.717500,
-     -0.000000, +0.117700, -0.993000,
-     -0.000000, +0.398500, +0.917200,
-     -0.638200, +0.281200, -0.716700,
-     -0.658100, +0.182700, -0.730400,
-     +0.974300, +0.217100, -0.059500,
-     +0.653300, +0.414800, +0.633400,
-     -0.974800, +0.216000, -0.056700,
-     -0.979000, +0.203500, -0.009100,
-     -0.698500, +0.060900, +0.713100,
-     -0.675600, +0.336000, +0.656200,
-     -0.678500, +0.157300, -0.717500,
-     -0.974300, +0.217100, -0.059500,
-     -0.653300, +0.414800, +0.633400,
-     +0.259200, +0.814400, -0.519200,
-     +0.567600, -0.575000, -0.589200,
-     +0.342600, -0.251700, -0.905100,
-     +0.156800, -0.923700, -0.349600,
-     -0.000000, -0.613400, -0.789800,
-     +0.884900, -0.280800, -0.371600,
-     -0.884900, -0.280800, -0.371600,
-     +0.279200, -0.949800, -0.141100,
-     -0.000000, -0.998600, +0.052400,
-     -0.700200, -0.004900, -0.713900,
-     +0.661300, +0.738200, -0.133000,
-     -0.883000, +0.242800, -0.401600,
-     -0.000000, +0.994700, -0.103000,
-     -0.567600, -0.575000, -0.589200,
-     +0.363000, +0.885600, +0.289600,
-     -0.651800, +0.179100, -0.736900,
-     +0.705100, -0.708900, -0.015500,
-     -0.611200, +0.480600, -0.628800,
-     -0.101700, -0.994800, -0.000000,
-     +0.910600, +0.406300, +0.076100,
-     +0.611200, +0.480600, -0.628800,
-     +0.651800, +0.179100, -0.736900,
-     +0.700200, -0.004900, -0.713900,
-     -0.000000, +0.571300, -0.820700,
-     -0.000000, +0.220400, -0.975400,
-     -0.000000, -0.003800, -1.000000,
-     +0.401900, +0.355300, +0.843900,
-     -0.000000, +0.158200, +0.987400,
-     -0.957300, +0.283400, -0.057300,
-     -0.675700, +0.555700, +0.484400,
-     +0.957300, +0.283400, -0.057300,
-     +0.988600, +0.143000, -0.047000,
-     -0.000000, +0.124300, +0.992200,
-     +0.349400, +0.177800, -0.920000,
-     +0.316200, +0.328000, -0.890200,
-     -0.988600, +0.143000, -0.047000,
-     +0.883000, +0.242800, -0.401600,
-     +0.875800, +0.190200, -0.443600,
-     +0.704200, +0.114300, +0.700800,
-     -0.000000, +0.178900, +0.983900,
-     +0.664600, +0.168100, +0.728100,
-     -0.279200, -0.949800, -0.141100,
-     +0.481100, -0.647700, +0.590700,
-     -0.000000, -0.690100, +0.723700,
-     +0.072300, -0.958100, +0.277100,
-     +0.298700, +0.429500, +0.852300,
-     +0.263300, -0.234000, +0.935900,
-     +0.688600, +0.152400, +0.709000,
-     +0.400900, +0.046800, +0.914900,
-     -0.704200, +0.114300, +0.700800,
-     -0.000000, +0.749700, +0.661800,
-     -0.875800, +0.190200, -0.443600,
-     +0.675700, +0.555700, +0.484400,
-     -0.661300, +0.738200, -0.133000,
-     +0.889600, +0.274800, +0.364800,
-     +0.906000, +0.131100, +0.402500,
-     -0.481100, -0.647700, +0.590700,
-     +0.659700, +0.210300, -0.721500,
-     -0.000000, +0.161600, -0.986900,
-     -0.000000, +0.485500, +0.874200,
-     +0.997900, +0.024400, -0.059200,
-     +0.634700, +0.483300, +0.603000,
-     +0.900800, +0.173400, -0.398200,
-     -0.664600, +0.168100, +0.728100,
-     +0.292100, +0.424900, +0.856800,
-     -0.688600, +0.152400, +0.709000,
-     +0.343800, +0.132800, -0.929600,
-     +0.902500, +0.317000, +0.291700,
-     -0.910600, +0.406300, +0.076100,
-     +0.215300, -0.962700, +0.163900,
-     +0.899000, -0.294500, +0.324200,
-     -0.705100, -0.708900, -0.015500,
-     -0.000000, -0.999800, -0.020800,
-     -0.889600, +0.274800, +0.364800,
-     -0.906000, +0.131100, +0.402500,
-     -0.659700, +0.210300, -0.721500,
-     -0.997900, +0.024400, -0.059200,
-     -0.634700, +0.483300, +0.603000,
-     -0.900800, +0.173400, -0.398200,
-     -0.902500, +0.317000, +0.291700,
-     -0.215300, -0.962700, +0.163900,
-     -0.899000, -0.294500, +0.324200,
-     +0.101700, -0.994800, -0.000000,
-     -0.342600, -0.251700, -0.905100,
-     -0.156800, -0.923700, -0.349600,
-     -0.363000, +0.885600, +0.289600,
-     -0.401900, +0.355300, +0.843900,
-     -0.263300, -0.234000, +0.935900,
-     -0.259200, +0.814400, -0.519200,
-     -0.316200, +0.328000, -0.890200,
-     -0.349400, +0.177800, -0.920000,
-     -0.298700, +0.429500, +0.852300,
-     -0.072300, -0.958100, +0.277100,
-     -0.400900, +0.046800, +0.914900,
-     -0.292100, +0.424900, +0.856800,
-     -0.343800, +0.132800, -0.929600,
-     -0.292300, -0.599400, -0.745200,
-     -0.273800, +0.543500, -0.793500,
-     +0.292300, -0.599400, -0.745200,
-     -0.044400, -0.997900, +0.047600,
-     +0.910400, +0.125100, +0.394300,
-     -0.341200, +0.208900, -0.916500,
-     -0.948400, +0.086100, +0.305200,
-     -0.700900, -0.647500, -0.299100,
-     +0.948400, +0.086100, +0.305200,
-     -0.332000, +0.502400, +0.798400,
-     +0.344700, +0.178200, -0.921700,
-     -0.876800, +0.235700, -0.419100,
-     +0.273800, +0.543500, -0.793500,
-     +0.328100, +0.939300, -0.099900,
-     -0.910400, +0.125100, +0.394300,
-     -0.328100, +0.939300, -0.099900,
-     +0.429000, +0.117200, +0.895700,
-     +0.700900, -0.647500, -0.299100,
-     -0.429000, +0.117200, +0.895700,
-     -0.013800, -0.999800, -0.013500,
-     -0.335700, +0.715200, +0.613000,
-     +0.332000, +0.502400, +0.798400,
-     +0.044400, -0.997900, +0.047600,
-     +0.190000, -0.665600, +0.721700,
-     +0.335700, +0.715200, +0.613000,
-     -0.844700, +0.452100, -0.286500,
-     -0.282700, +0.169200, +0.944200,
-     +0.341200, +0.208900, -0.916500,
-     +0.657100, -0.698400, +0.283700,
-     -0.657100, -0.698400, +0.283700,
-     -0.349000, +0.158100, +0.923700,
-     -0.190000, -0.665600, +0.721700,
-     +0.922300, -0.004200, -0.386500,
-     +0.013800, -0.999800, -0.013500,
-     +0.844700, +0.452100, -0.286500,
-     +0.882600, +0.154800, -0.443800,
-     +0.349000, +0.158100, +0.923700,
-     -0.922300, -0.004200, -0.386500,
-     +0.858000, +0.293100, +0.421900,
-     +0.876800, +0.235700, -0.419100,
-     -0.858000, +0.293100, +0.421900,
-     -0.349800, -0.002400, -0.936800,
-     -0.882600, +0.154800, -0.443800,
-     +0.282700, +0.169200, +0.944200,
-     -0.867900, +0.385800, +0.313100,
-     +0.349800, -0.002400, -0.936800,
-     +0.867900, +0.385800, +0.313100,
-     -0.344700, +0.178200, -0.921700,
-     -0.574400, -0.379700, -0.725200,
-     -0.646100, +0.259500, -0.717800,
-     +0.574400, -0.379700, -0.725200,
-     +0.646100, +0.259500, -0.717800,
-     -0.539000, -0.704000, +0.462400,
-     -0.678200, +0.268600, +0.684100,
-     +0.539000, -0.704000, +0.462400,
-     +0.678200, +0.268600, +0.684100,
-     -0.341500, +0.864800, +0.368100,
-     +0.341500, +0.864800, +0.368100,
-     -0.237900, +0.910000, -0.339600,
-     +0.237900, +0.910000, -0.339600,
-     -0.000000, +0.249000, +0.968500,
-     -0.000000, -0.842400, +0.538900,
-     -0.000000, +0.237100, -0.971500,
-     -0.000000, +0.944700, +0.327900,
-     -0.000000, -0.451800, -0.892100,
-     -0.954200, +0.296800, +0.038800,
-     -0.707500, -0.679800, -0.193400,
-     -0.222900, +0.974800, +0.012700,
-     -0.000000, +0.999900, -0.011600,
-     -0.000000, -0.948100, -0.317800,
-     -0.638800, -0.282600, +0.715600,
-     -0.657200, -0.182900, +0.731200,
-     -0.000000, -0.352900, +0.935600,
-     -0.000000, -0.176000, +0.984400,
-     -0.000000, +0.966500, -0.256500,
-     +0.954200, +0.296800, +0.038800,
-     +0.707500, -0.679800, -0.193400,
-     -0.974700, -0.216200, +0.056700,
-     -0.978800, -0.204400, +0.008700,
-     -0.700100, -0.061500, -0.711400,
-     -0.678000, -0.335800, -0.653800,
-     -0.000000, -0.057900, -0.998300,
-     -0.000000, -0.352000, -0.936000,
-     +0.222900, +0.974800, +0.012700,
-     -0.678800, -0.156100, +0.717600,
-     -0.000000, -0.117000, +0.993100,
-     -0.000000, -0.405100, -0.914300,
-     +0.638800, -0.282600, +0.715600,
-     +0.657200, -0.182900, +0.731200,
-     -0.974600, -0.216100, +0.058100,
-     -0.654100, -0.412500, -0.634000,
-     +0.974700, -0.216200, +0.056700,
-     +0.978800, -0.204400, +0.008700,
-     +0.700100, -0.061500, -0.711400,
-     +0.678000, -0.335800, -0.653800,
-     +0.678800, -0.156100, +0.717600,
-     +0.974600, -0.216100, +0.058100,
-     +0.654100, -0.412500, -0.634000,
-     -0.253100, -0.814600, +0.521800,
-     -0.573800, +0.571400, +0.586700,
-     -0.343700, +0.254700, +0.903900,
-     -0.145200, +0.925400, +0.350100,
-     -0.000000, +0.616400, +0.787400,
-     -0.883900, +0.283800, +0.371700,
-     +0.883900, +0.283800, +0.371700,
-     -0.286200, +0.947500, +0.142800,
-     -0.000000, +0.999200, -0.040600,
-     +0.700100, +0.006800, +0.714000,
-     -0.665400, -0.735300, +0.128600,
-     +0.883200, -0.243800, +0.400700,
-     -0.000000, -0.994600, +0.103900,
-     +0.573800, +0.571400, +0.586700,
-     -0.364100, -0.886000, -0.287200,
-     +0.651600, -0.179700, +0.737000,
-     -0.705100, +0.709000, +0.015700,
-     +0.611400, -0.482200, +0.627400,
-     +0.092200, +0.995700, +0.001200,
-     -0.909500, -0.408600, -0.076900,
-     -0.611400, -0.482200, +0.627400,
-     -0.651600, -0.179700, +0.737000,
-     -0.700100, +0.006800, +0.714000,
-     -0.000000, -0.574600, +0.818400,
-     -0.000000, -0.220900, +0.975300,
-     -0.000000, +0.005800, +1.000000,
-     -0.399100, -0.355400, -0.845200,
-     -0.000000, -0.148000, -0.989000,
-     +0.957500, -0.283100, +0.056100,
-     +0.674400, -0.557100, -0.484600,
-     -0.957500, -0.283100, +0.056100,
-     -0.988500, -0.143600, +0.047500,
-     -0.000000, -0.122400, -0.992500,
-     -0.348600, -0.177900, +0.920200,
-     -0.318300, -0.329200, +0.889000,
-     +0.988500, -0.143600, +0.047500,
-     -0.883200, -0.243800, +0.400700,
-     -0.876100, -0.190600, +0.442800,
-     -0.706600, -0.113100, -0.698500,
-     -0.000000, -0.181900, -0.983300,
-     -0.665600, -0.170900, -0.726500,
-     +0.286200, +0.947500, +0.142800,
-     -0.483600, +0.645300, -0.591400,
-     -0.000000, +0.688600, -0.725200,
-     -0.089200, +0.950400, -0.298000,
-     -0.298900, -0.432500, -0.850700,
-     -0.266800, +0.235500, -0.934500,
-     -0.689100, -0.148700, -0.709200,
-     -0.399200, -0.046600, -0.915700,
-     +0.706600, -0.113100, -0.698500,
-     -0.000000, -0.750400, -0.661000,
-     +0.876100, -0.190600, +0.442800,
-     -0.674400, -0.557100, -0.484600,
-     +0.665400, -0.735300, +0.128600,
-     -0.891500, -0.274700, -0.360100,
-     -0.907100, -0.132700, -0.399500,
-     +0.483600, +0.645300, -0.591400,
-     -0.659500, -0.210000, +0.721800,
-     -0.000000, -0.161400, +0.986900,
-     -0.000000, -0.485500, -0.874200,
-     -0.998100, -0.022200, +0.057600,
-     -0.635800, -0.483300, -0.601800,
-     -0.900700, -0.172300, +0.398800,
-     +0.665600, -0.170900, -0.726500,
-     -0.299500, -0.426300, -0.853600,
-     +0.689100, -0.148700, -0.709200,
-     -0.345400, -0.131900, +0.929100,
-     -0.902200, -0.315200, -0.294300,
-     +0.909500, -0.408600, -0.076900,
-     -0.223300, +0.960700, -0.165100,
-     -0.897700, +0.295600, -0.326600,
-     +0.705100, +0.709000, +0.015700,
-     -0.000000, +0.999200, +0.039100,
-     +0.891500, -0.274700, -0.360100,
-     +0.907100, -0.132700, -0.399500,
-     +0.659500, -0.210000, +0.721800,
-     +0.998100, -0.022200, +0.057600,
-     +0.635800, -0.483300, -0.601800,
-     +0.900700, -0.172300, +0.398800,
-     +0.902200, -0.315200, -0.294300,
-     +0.223300, +0.960700, -0.165100,
-     +0.897700, +0.295600, -0.326600,
-     -0.092200, +0.995700, +0.001200,
-     +0.343700, +0.254700, +0.903900,
-     +0.145200, +0.925400, +0.350100,
-     +0.364100, -0.886000, -0.287200,
-     +0.399100, -0.355400, -0.845200,
-     +0.266800, +0.235500, -0.934500,
-     +0.253100, -0.814600, +0.521800,
-     +0.318300, -0.329200, +0.889000,
-     +0.348600, -0.177900, +0.920200,
-     +0.298900, -0.432500, -0.850700,
-     +0.089200, +0.950400, -0.298000,
-     +0.399200, -0.046600, -0.915700,
-     +0.299500, -0.426300, -0.853600,
-     +0.345400, -0.131900, +0.929100,
-     +0.288200, +0.597300, +0.748400,
-     +0.276500, -0.546100, +0.790700,
-     -0.288200, +0.597300, +0.748400,
-     +0.026800, +0.998900, -0.038000,
-     -0.912800, -0.125300, -0.388800,
-     +0.341400, -0.209500, +0.916300,
-     +0.947400, -0.083200, -0.309000,
-     +0.699900, +0.648700, +0.299000,
-     -0.947400, -0.083200, -0.309000,
-     +0.332300, -0.502400, -0.798200,
-     -0.345300, -0.178000, +0.921500,
-     +0.876900, -0.235500, +0.419100,
-     -0.276500, -0.546100, +0.790700,
-     -0.325200, -0.940800, +0.095900,
-     +0.912800, -0.125300, -0.388800,
-     +0.325200, -0.940800, +0.095900,
-     -0.425700, -0.115400, -0.897500,
-     -0.699900, +0.648700, +0.299000,
-     +0.425700, -0.115400, -0.897500,
-     +0.008000, +0.999800, +0.019400,
-     +0.336200, -0.716500, -0.611200,
-     -0.332300, -0.502400, -0.798200,
-     -0.026800, +0.998900, -0.038000,
-     -0.193100, +0.662600, -0.723700,
-     -0.336200, -0.716500, -0.611200,
-     +0.843300, -0.454800, +0.286400,
-     +0.291200, -0.161600, -0.942900,
-     -0.341400, -0.209500, +0.916300,
-     -0.659600, +0.695600, -0.284900,
-     +0.659600, +0.695600, -0.284900,
-     +0.348200, -0.160900, -0.923500,
-     +0.193100, +0.662600, -0.723700,
-     -0.921900, +0.006000, +0.387400,
-     -0.008000, +0.999800, +0.019400,
-     -0.843300, -0.454800, +0.286400,
-     -0.883300, -0.155300, +0.442300,
-     -0.348200, -0.160900, -0.923500,
-     +0.921900, +0.006000, +0.387400,
-     -0.857600, -0.295900, -0.420600,
-     -0.876900, -0.235500, +0.419100,
-     +0.857600, -0.295900, -0.420600,
-     +0.351400, +0.004400, +0.936200,
-     +0.883300, -0.155300, +0.442300,
-     -0.291200, -0.161600, -0.942900,
-     +0.868000, -0.385500, -0.313000,
-     -0.351400, +0.004400, +0.936200,
-     -0.868000, -0.385500, -0.313000,
-     +0.345300, -0.178000, +0.921500,
-     -0.480600, -0.873000, -0.083100,
-     -0.810500, +0.582600, -0.061200,
-     -0.168300, -0.873000, -0.457800,
-     -0.211400, +0.586400, -0.781900,
-     +0.168300, -0.873000, +0.457800,
-     +0.206300, +0.582600, +0.786200,
-     +0.480600, -0.873000, +0.083100,
-     +0.807200, +0.586400, +0.067000,
-     -0.333700, -0.900700, -0.278100,
-     -0.986500, -0.161700, -0.026900,
-     -0.634400, +0.693300, -0.341900,
-     -0.209000, -0.270700, -0.939700,
-     +0.203600, -0.948100, -0.244300,
-     +0.428000, +0.743700, -0.513500,
-     +0.962000, -0.270700, +0.036200,
-     +0.333700, -0.900700, +0.278100,
-     +0.450600, +0.693300, +0.562300,
-     +0.204300, -0.161700, +0.965500,
-     -0.203600, -0.948100, +0.244300,
-     -0.426800, +0.745300, +0.512200,
-     -0.752200, -0.259900, -0.605400,
-     +0.617400, -0.264700, -0.740800,
-     +0.731100, -0.259900, +0.630800,
-     -0.633100, -0.148400, +0.759700,
-     -0.000000, -1.000000, -0.000000,
-     -0.118700, +0.982700, +0.142500,
-     +0.480600, -0.873000, -0.083100,
-     +0.810500, +0.582600, -0.061200,
-     +0.168300, -0.873000, -0.457800,
-     +0.211400, +0.586400, -0.781900,
-     -0.168300, -0.873000, +0.457800,
-     -0.206300, +0.582600, +0.786200,
-     -0.480600, -0.873000, +0.083100,
-     -0.807200, +0.586400, +0.067000,
-     +0.333700, -0.900700, -0.278100,
-     +0.986500, -0.161700, -0.026900,
-     +0.634400, +0.693300, -0.341900,
-     +0.209000, -0.270700, -0.939700,
-     -0.203600, -0.948100, -0.244300,
-     -0.428000, +0.743700, -0.513500,
-     -0.962000, -0.270700, +0.036200,
-     -0.333700, -0.900700, +0.278100,
-     -0.450600, +0.693300, +0.562300,
-     -0.204300, -0.161700, +0.965500,
-     +0.203600, -0.948100, +0.244300,
-     +0.426800, +0.745300, +0.512200,
-     +0.752200, -0.259900, -0.605400,
-     -0.617400, -0.264700, -0.740800,
-     -0.731100, -0.259900, +0.630800,
-     +0.633100, -0.148400, +0.759700,
-     +0.118700, +0.982700, +0.142500,
-     +0.523400, +0.849800, +0.062800,
-     +0.845300, -0.533100, +0.035400,
-     +0.157900, +0.855000, +0.494000,
-     +0.228100, -0.589700, +0.774700,
-     -0.156100, +0.849800, -0.503500,
-     -0.187200, -0.533100, -0.825100,
-     -0.514400, +0.855000, -0.066300,
-     -0.803200, -0.589700, -0.084700,
-     +0.359200, +0.883800, +0.299700,
-     +0.984600, +0.173500, +0.023200,
-     +0.632300, -0.692200, +0.348100,
-     +0.215500, +0.264100, +0.940100,
-     -0.240500, +0.926700, +0.288600,
-     -0.419800, -0.755000, +0.503800,
-     -0.963600, +0.264100, -0.042500,
-     -0.359500, +0.883800, -0.299300,
-     -0.456300, -0.692200, -0.559200,
-     -0.200300, +0.173500, -0.964300,
-     +0.249200, +0.921100, -0.299000,
-     +0.458200, -0.698500, -0.549700,
-     +0.755100, +0.233900, +0.612500,
-     -0.618200, +0.259900, +0.741800,
-     -0.738600, +0.233900, -0.632300,
-     +0.633400, +0.145900, -0.760000,
-     -0.000000, +1.000000, -0.000000,
-     +0.114800, -0.983800, -0.137700,
-     -0.523400, +0.849800, +0.062800,
-     -0.845300, -0.533100, +0.035400,
-     -0.157900, +0.855000, +0.494000,
-     -0.228100, -0.589700, +0.774700,
-     +0.156100, +0.849800, -0.503500,
-     +0.187200, -0.533100, -0.825100,
-     +0.514400, +0.855000, -0.066300,
-     +0.803200, -0.589700, -0.084700,
-     -0.359200, +0.883800, +0.299700,
-     -0.984600, +0.173500, +0.023200,
-     -0.632300, -0.692200, +0.348100,
-     -0.215500, +0.264100, +0.940100,
-     +0.240500, +0.926700, +0.288600,
-     +0.419800, -0.755000, +0.503800,
-     +0.963600, +0.264100, -0.042500,
-     +0.359500, +0.883800, -0.299300,
-     +0.456300, -0.692200, -0.559200,
-     +0.200300, +0.173500, -0.964300,
-     -0.249200, +0.921100, -0.299000,
-     -0.458200, -0.698500, -0.549700,
-     -0.755100, +0.233900, +0.612500,
-     +0.618200, +0.259900, +0.741800,
-     +0.738600, +0.233900, -0.632300,
-     -0.633400, +0.145900, -0.760000,
-     -0.114800, -0.983800, -0.137700,
-};
-static const float texcoords[1326] = {
-     +0.009831, +0.035651,
-     +0.022569, +0.022913,
-     +0.022569, +0.010176,
-     +0.027346, +0.058473,
-     +0.048045, +0.048389,
-     +0.030000, +0.048389,
-     +0.048045, +0.022913,
-     +0.060783, +0.035651,
-     +0.048045, +0.035651,
-     +0.030000, +0.035651,
-     +0.030000, +0.022913,
-     +0.022569, +0.048389,
-     +0.060783, +0.022913,
-     +0.027346, +0.012829,
-     +0.022569, +0.035651,
-     +0.058552, +0.058052,
-     +0.009831, +0.048389,
-     +0.042069, +0.919810,
-     +0.025357, +0.936523,
-     +0.042069, +0.903098,
-     +0.075494, +0.953235,
-     +0.048336, +0.966466,
-     +0.051818, +0.953235,
-     +0.075494, +0.936523,
-     +0.092207, +0.919810,
-     +0.075494, +0.919810,
-     +0.051818, +0.936523,
-     +0.042069, +0.936523,
-     +0.042069, +0.953235,
-     +0.025357, +0.953235,
-     +0.092207, +0.936523,
-     +0.089279, +0.965914,
-     +0.048336, +0.906579,
-     +0.051818, +0.919810,
-     +0.044493, +0.911901,
-     +0.049930, +0.920258,
-     +0.041425, +0.922613,
-     +0.049566, +0.930222,
-     +0.029819, +0.983012,
-     +0.041206, +0.973418,
-     +0.031998, +0.988770,
-     +0.041206, +0.955516,
-     +0.031242, +0.955880,
-     +0.033597, +0.947375,
-     +0.022885, +0.950443,
-     +0.025064, +0.956202,
-     +0.041206, +0.928736,
-     +0.029819, +0.938329,
-     +0.034570, +0.926898,
-     +0.013677, +0.965795,
-     +0.068954, +0.965795,
-     +0.057567, +0.956202,
-     +0.059746, +0.950443,
-     +0.027441, +0.969607,
-     +0.023641, +0.983334,
-     +0.041425, +0.973418,
-     +0.046256, +0.959334,
-     +0.048061, +0.971581,
-     +0.018508, +0.979880,
-     +0.055189, +0.969607,
-     +0.051388, +0.955880,
-     +0.020313, +0.967633,
-     +0.082820, +0.921014,
-     +0.077383, +0.912657,
-     +0.085888, +0.910302,
-     +0.077747, +0.902693,
-     +0.073930, +0.907524,
-     +0.021286, +0.991838,
-     +0.077061, +0.918835,
-     +0.067468, +0.930222,
-     +0.065630, +0.923586,
-     +0.027441, +0.924925,
-     +0.036375, +0.914651,
-     +0.059845, +0.902693,
-     +0.061683, +0.909329,
-     +0.052812, +0.983012,
-     +0.050633, +0.988770,
-     +0.062318, +0.967633,
-     +0.041425, +0.955516,
-     +0.025064, +0.911520,
-     +0.031242, +0.911198,
-     +0.064123, +0.979880,
-     +0.058990, +0.983334,
-     +0.022885, +0.905761,
-     +0.013677, +0.921113,
-     +0.020313, +0.922951,
-     +0.041206, +0.910834,
-     +0.033597, +0.902693,
-     +0.018508, +0.935198,
-     +0.023641, +0.938651,
-     +0.013677, +0.939015,
-     +0.036375, +0.959334,
-     +0.068954, +0.983697,
-     +0.061345, +0.991838,
-     +0.021286, +0.947156,
-     +0.053383, +0.925391,
-     +0.063656, +0.916457,
-     +0.031998, +0.944088,
-     +0.050252, +0.914080,
-     +0.034570, +0.971581,
-     +0.013677, +0.983697,
-     +0.229068, +0.283003,
-     +0.171021, +0.368583,
-     +0.235716, +0.372905,
-     +0.104567, +0.291799,
-     +0.161402, +0.287784,
-     +0.118691, +0.365651,
-     +0.177081, +0.436390,
-     +0.237434, +0.450190,
-     +0.772487, +0.244608,
-     +0.830885, +0.291437,
-     +0.831241, +0.240456,
-     +0.773900, +0.300420,
-     +0.829115, +0.333252,
-     +0.858218, +0.317125,
-     +0.866299, +0.284431,
-     +0.869054, +0.237785,
-     +0.159565, +0.206435,
-     +0.213843, +0.116300,
-     +0.223009, +0.193059,
-     +0.156030, +0.138449,
-     +0.108167, +0.216695,
-     +0.868437, +0.835431,
-     +0.916164, +0.782980,
-     +0.891119, +0.855846,
-     +0.877245, +0.780118,
-     +0.924195, +0.701498,
-     +0.957286, +0.796000,
-     +0.930059, +0.894764,
-     +0.249114, +0.893652,
-     +0.328855, +0.924338,
-     +0.225876, +0.926457,
-     +0.257535, +0.859491,
-     +0.339356, +0.898423,
-     +0.344655, +0.861842,
-     +0.438835, +0.906224,
-     +0.431835, +0.922219,
-     +0.580003, +0.258208,
-     +0.686235, +0.308569,
-     +0.683794, +0.250874,
-     +0.583296, +0.320100,
-     +0.686303, +0.359562,
-     +0.691504, +0.441139,
-     +0.602015, +0.493654,
-     +0.594643, +0.454895,
-     +0.788365, +0.427384,
-     +0.689209, +0.474676,
-     +0.765689, +0.476993,
-     +0.690181, +0.526260,
-     +0.607823, +0.542411,
-     +0.227666, +0.508117,
-     +0.136648, +0.417420,
-     +0.165829, +0.485511,
-     +0.086053, +0.486788,
-     +0.143284, +0.527760,
-     +0.200515, +0.568731,
-     +0.634440, +0.952577,
-     +0.730424, +0.991987,
-     +0.632591, +0.991987,
-     +0.633335, +0.903487,
-     +0.723436, +0.959106,
-     +0.717145, +0.907898,
-     +0.798831, +0.946058,
-     +0.828257, +0.991987,
-     +0.526463, +0.729599,
-     +0.612405, +0.622994,
-     +0.618141, +0.723122,
-     +0.431463, +0.736311,
-     +0.522077, +0.643428,
-     +0.427681, +0.664226,
-     +0.517969, +0.573320,
-     +0.386138, +0.271905,
-     +0.473008, +0.192406,
-     +0.379420, +0.186626,
-     +0.478888, +0.265352,
-     +0.574560, +0.196467,
-     +0.568364, +0.141638,
-     +0.466865, +0.128406,
-     +0.372049, +0.112959,
-     +0.583189, +0.443916,
-     +0.487880, +0.452057,
-     +0.488713, +0.492568,
-     +0.585318, +0.418038,
-     +0.486240, +0.402628,
-     +0.394538, +0.431253,
-     +0.394863, +0.487115,
-     +0.394237, +0.541219,
-     +0.823720, +0.190033,
-     +0.766038, +0.189151,
-     +0.859768, +0.191989,
-     +0.847170, +0.160757,
-     +0.816088, +0.148881,
-     +0.758302, +0.141655,
-     +0.894025, +0.128798,
-     +0.887748, +0.188080,
-     +0.915920, +0.180862,
-     +0.861783, +0.148124,
-     +0.899896, +0.235606,
-     +0.937815, +0.232927,
-     +0.303437, +0.564580,
-     +0.228802, +0.606173,
-     +0.201183, +0.576962,
-     +0.405691, +0.552198,
-     +0.317477, +0.588761,
-     +0.414871, +0.567050,
-     +0.327867, +0.624233,
-     +0.241943, +0.638810,
-     +0.909101, +0.342178,
-     +0.894551, +0.284367,
-     +0.874462, +0.327577,
-     +0.923458, +0.287552,
-     +0.437854, +0.808212,
-     +0.337918, +0.742921,
-     +0.441953, +0.867838,
-     +0.342845, +0.807680,
-     +0.257628, +0.809274,
-     +0.253673, +0.748873,
-     +0.196028, +0.060322,
-     +0.160623, +0.004128,
-     +0.137983, +0.091398,
-     +0.058820, +0.101351,
-     +0.095632, +0.140872,
-     +0.118666, +0.162916,
-     +0.249096, +0.688515,
-     +0.333691, +0.678111,
-     +0.423355, +0.604616,
-     +0.068431, +0.212573,
-     +0.031594, +0.200115,
-     +0.004367, +0.298879,
-     +0.059852, +0.294958,
-     +0.117239, +0.666316,
-     +0.065422, +0.708562,
-     +0.079778, +0.653937,
-     +0.139178, +0.675275,
-     +0.097441, +0.710472,
-     +0.133417, +0.708896,
-     +0.093800, +0.760168,
-     +0.051065, +0.763188,
-     +0.626541, +0.823061,
-     +0.534236, +0.815531,
-     +0.540027, +0.885520,
-     +0.850159, +0.576735,
-     +0.904787, +0.621954,
-     +0.866657, +0.630260,
-     +0.902827, +0.509326,
-     +0.869745, +0.553333,
-     +0.943670, +0.603281,
-     +0.880327, +0.704597,
-     +0.774922, +0.712044,
-     +0.834344, +0.794361,
-     +0.780248, +0.812728,
-     +0.832905, +0.707948,
-     +0.836519, +0.864944,
-     +0.786100, +0.894578,
-     +0.072960, +0.815252,
-     +0.130202, +0.849793,
-     +0.094854, +0.867316,
-     +0.104392, +0.808859,
-     +0.140233, +0.805362,
-     +0.150664, +0.837838,
-     +0.848399, +0.380665,
-     +0.835276, +0.360419,
-     +0.774076, +0.384184,
-     +0.787697, +0.419153,
-     +0.702416, +0.717167,
-     +0.766038, +0.611612,
-     +0.695143, +0.611448,
-     +0.760323, +0.529752,
-     +0.678098, +0.193410,
-     +0.670996, +0.142913,
-     +0.852630, +0.909631,
-     +0.879158, +0.943376,
-     +0.814409, +0.552003,
-     +0.824076, +0.505494,
-     +0.845596, +0.468355,
-     +0.182207, +0.699838,
-     +0.185592, +0.753683,
-     +0.176475, +0.657128,
-     +0.822179, +0.622190,
-     +0.356289, +0.004127,
-     +0.274120, +0.050504,
-     +0.364516, +0.057606,
-     +0.258456, +0.004127,
-     +0.286751, +0.107677,
-     +0.079930, +0.375319,
-     +0.116942, +0.442483,
-     +0.045210, +0.392834,
-     +0.828514, +0.099228,
-     +0.763004, +0.069658,
-     +0.818368, +0.121118,
-     +0.754435, +0.106194,
-     +0.664745, +0.103857,
-     +0.660024, +0.071777,
-     +0.562792, +0.099218,
-     +0.189812, +0.807469,
-     +0.190142, +0.850561,
-     +0.133550, +0.757360,
-     +0.306364, +0.506857,
-     +0.297376, +0.554975,
-     +0.310830, +0.448476,
-     +0.179066, +0.877522,
-     +0.160365, +0.896887,
-     +0.557045, +0.073896,
-     +0.461538, +0.079237,
-     +0.456667, +0.039012,
-     +0.161718, +0.631992,
-     +0.140481, +0.615449,
-     +0.309148, +0.369469,
-     +0.303499, +0.277744,
-     +0.391478, +0.357281,
-     +0.685605, +0.399110,
-     +0.685443, +0.431535,
-     +0.772919, +0.348532,
-     +0.584870, +0.375255,
-     +0.710080, +0.822858,
-     +0.500167, +0.503547,
-     +0.510231, +0.530285,
-     +0.296194, +0.186135,
-     +0.532213, +0.957103,
-     +0.538417, +0.929215,
-     +0.483323, +0.338399,
-     +0.038332, +0.914438,
-     +0.032492, +0.923049,
-     +0.031524, +0.914919,
-     +0.025805, +0.915324,
-     +0.029033, +0.927963,
-     +0.027226, +0.922754,
-     +0.039174, +0.931260,
-     +0.039001, +0.923484,
-     +0.093009, +0.910575,
-     +0.098885, +0.915287,
-     +0.093152, +0.916191,
-     +0.098707, +0.919494,
-     +0.093053, +0.921032,
-     +0.101635, +0.917872,
-     +0.098921, +0.910158,
-     +0.102449, +0.914582,
-     +0.031339, +0.906734,
-     +0.037723, +0.905389,
-     +0.036800, +0.897665,
-     +0.027224, +0.902356,
-     +0.030983, +0.899894,
-     +0.102664, +0.970022,
-     +0.107466, +0.964745,
-     +0.103550, +0.964457,
-     +0.103860, +0.956858,
-     +0.111603, +0.966055,
-     +0.108274, +0.956546,
-     +0.108864, +0.975992,
-     +0.104946, +0.972076,
-     +0.048373, +0.978968,
-     +0.040349, +0.975880,
-     +0.038011, +0.979181,
-     +0.049429, +0.976360,
-     +0.041197, +0.972443,
-     +0.059438, +0.977145,
-     +0.049962, +0.972680,
-     +0.058734, +0.978754,
-     +0.073642, +0.911944,
-     +0.084331, +0.917011,
-     +0.073974, +0.918171,
-     +0.084338, +0.922142,
-     +0.074132, +0.923721,
-     +0.084085, +0.911206,
-     +0.075857, +0.935634,
-     +0.084861, +0.930350,
-     +0.075115, +0.931734,
-     +0.084630, +0.933724,
-     +0.094607, +0.928966,
-     +0.084728, +0.938914,
-     +0.092326, +0.933957,
-     +0.076441, +0.940539,
-     +0.038191, +0.937089,
-     +0.033101, +0.929872,
-     +0.031969, +0.934814,
-     +0.023943, +0.934943,
-     +0.027050, +0.930485,
-     +0.035459, +0.943188,
-     +0.088777, +0.985774,
-     +0.079120, +0.981809,
-     +0.078934, +0.985774,
-     +0.088074, +0.982466,
-     +0.079008, +0.976870,
-     +0.095660, +0.981153,
-     +0.087441, +0.977314,
-     +0.098621, +0.985774,
-     +0.076903, +0.948647,
-     +0.068255, +0.959374,
-     +0.077480, +0.958722,
-     +0.067814, +0.950703,
-     +0.058697, +0.960049,
-     +0.067401, +0.943649,
-     +0.058316, +0.952796,
-     +0.054136, +0.913322,
-     +0.062877, +0.905323,
-     +0.063468, +0.912662,
-     +0.073095, +0.905731,
-     +0.072471, +0.900215,
-     +0.053460, +0.904741,
-     +0.062259, +0.898883,
-     +0.073963, +0.930629,
-     +0.064373, +0.931448,
-     +0.074177, +0.928025,
-     +0.064208, +0.926475,
-     +0.054981, +0.929355,
-     +0.064457, +0.935524,
-     +0.055014, +0.934976,
-     +0.098164, +0.905084,
-     +0.101791, +0.905281,
-     +0.102726, +0.909889,
-     +0.100524, +0.902138,
-     +0.092361, +0.904995,
-     +0.097397, +0.900944,
-     +0.105238, +0.898923,
-     +0.104607, +0.904888,
-     +0.101994, +0.900867,
-     +0.107441, +0.904161,
-     +0.105829, +0.909670,
-     +0.038306, +0.946955,
-     +0.045815, +0.942770,
-     +0.035527, +0.944016,
-     +0.047228, +0.945203,
-     +0.056104, +0.941524,
-     +0.048273, +0.948772,
-     +0.057027, +0.943018,
-     +0.039628, +0.950239,
-     +0.106755, +0.920392,
-     +0.105291, +0.914576,
-     +0.108200, +0.914896,
-     +0.109644, +0.909400,
-     +0.103270, +0.918923,
-     +0.049284, +0.960714,
-     +0.059340, +0.967283,
-     +0.049780, +0.967230,
-     +0.059752, +0.973283,
-     +0.041206, +0.967390,
-     +0.035008, +0.892033,
-     +0.029168, +0.895160,
-     +0.031446, +0.886379,
-     +0.021202, +0.896161,
-     +0.026324, +0.891270,
-     +0.040347, +0.955240,
-     +0.040808, +0.961313,
-     +0.048859, +0.954193,
-     +0.057881, +0.946798,
-     +0.022169, +0.907352,
-     +0.024906, +0.900138,
-     +0.018463, +0.906098,
-     +0.015724, +0.916036,
-     +0.026168, +0.907767,
-     +0.021306, +0.915641,
-     +0.021867, +0.957257,
-     +0.027080, +0.953006,
-     +0.023311, +0.951761,
-     +0.025088, +0.957449,
-     +0.029288, +0.953908,
-     +0.024722, +0.962449,
-     +0.028708, +0.957291,
-     +0.020422, +0.962753,
-     +0.078325, +0.968778,
-     +0.069037, +0.968020,
-     +0.069620, +0.975062,
-     +0.100825, +0.943993,
-     +0.106321, +0.948543,
-     +0.102795, +0.941638,
-     +0.106124, +0.937210,
-     +0.110233, +0.946664,
-     +0.102485, +0.949378,
-     +0.093255, +0.957607,
-     +0.099233, +0.965890,
-     +0.099089, +0.957195,
-     +0.093790, +0.967738,
-     +0.099452, +0.972992,
-     +0.028385, +0.971467,
-     +0.022625, +0.967992,
-     +0.024828, +0.973230,
-     +0.025788, +0.967349,
-     +0.029394, +0.966997,
-     +0.030443, +0.970264,
-     +0.100648, +0.924265,
-     +0.099327, +0.922228,
-     +0.093169, +0.924619,
-     +0.094540, +0.928137,
-     +0.092361, +0.947502,
-     +0.085959, +0.958123,
-     +0.085227, +0.947486,
-     +0.091786, +0.939266,
-     +0.083512, +0.905424,
-     +0.082798, +0.900343,
-     +0.094379, +0.975973,
-     +0.101073, +0.977488,
-     +0.103742, +0.980883,
-     +0.097228, +0.941504,
-     +0.098200, +0.936825,
-     +0.100365, +0.933088,
-     +0.033617, +0.956379,
-     +0.033958, +0.961797,
-     +0.028722, +0.962167,
-     +0.033041, +0.952082,
-     +0.098009, +0.948566,
-     +0.051133, +0.886379,
-     +0.042865, +0.891045,
-     +0.041289, +0.886379,
-     +0.051961, +0.891760,
-     +0.044136, +0.896798,
-     +0.023326, +0.923727,
-     +0.019833, +0.925489,
-     +0.098647, +0.895948,
-     +0.097626, +0.898150,
-     +0.092055, +0.892972,
-     +0.091193, +0.896648,
-     +0.082169, +0.896413,
-     +0.081694, +0.893185,
-     +0.071911, +0.895947,
-     +0.071332, +0.893399,
-     +0.091582, +0.900216,
-     +0.034382, +0.967209,
-     +0.034416, +0.971545,
-     +0.054951, +0.940419,
-     +0.046110, +0.936962,
-     +0.046559, +0.931088,
-     +0.045205, +0.941803,
-     +0.033301, +0.974257,
-     +0.031420, +0.976206,
-     +0.061723, +0.893936,
-     +0.061233, +0.889889,
-     +0.052719, +0.897329,
-     +0.031556, +0.949553,
-     +0.029419, +0.947888,
-     +0.046390, +0.923138,
-     +0.045821, +0.913909,
-     +0.054673, +0.921912,
-     +0.084268, +0.926121,
-     +0.084251, +0.929383,
-     +0.086730, +0.968757,
-     +0.065609, +0.936629,
-     +0.066622, +0.939319,
-     +0.045086, +0.904692,
-     +0.068834, +0.982264,
-     +0.069458, +0.979458,
-     +0.063915, +0.920012,
-     +0.026495, +0.015853,
-     +0.033128, +0.022486,
-     +0.026495, +0.022486,
-     +0.037537, +0.015853,
-     +0.033128, +0.015853,
-     +0.039761, +0.029119,
-     +0.033128, +0.029119,
-     +0.026495, +0.029119,
-     +0.026495, +0.035752,
-     +0.039761, +0.035752,
-     +0.033128, +0.035752,
-     +0.033128, +0.042386,
-     +0.026495, +0.042386,
-     +0.033128, +0.049019,
-     +0.026495, +0.049019,
-     +0.039761, +0.042386,
-     +0.037537, +0.055652,
-     +0.033128, +0.055652,
-     +0.026495, +0.055652,
-     +0.026495, +0.062285,
-     +0.037537, +0.062285,
-     +0.033128, +0.062285,
-     +0.033128, +0.068918,
-     +0.026495, +0.068918,
-     +0.013229, +0.042386,
-     +0.019862, +0.049019,
-     +0.013229, +0.049019,
-     +0.019862, +0.042386,
-     +0.019862, +0.055652,
-     +0.013229, +0.055652,
-     +0.046394, +0.049019,
-     +0.039761, +0.049019,
-     +0.053027, +0.042386,
-     +0.046394, +0.042386,
-     +0.053748, +0.056327,
-     +0.046394, +0.056875,
-     +0.039761, +0.022486,
-     +0.053027, +0.049019,
-     +0.043345, +0.873754,
-     +0.057804, +0.888212,
-     +0.057804, +0.873754,
-     +0.067415, +0.873754,
-     +0.072262, +0.902670,
-     +0.072262, +0.888212,
-     +0.043345, +0.902670,
-     +0.043345, +0.888212,
-     +0.043345, +0.917128,
-     +0.057804, +0.902670,
-     +0.057804, +0.917128,
-     +0.072262, +0.931587,
-     +0.072262, +0.917128,
-     +0.057804, +0.931587,
-     +0.043345, +0.931587,
-     +0.057804, +0.946045,
-     +0.067415, +0.960503,
-     +0.072262, +0.946045,
-     +0.043345, +0.960503,
-     +0.043345, +0.946045,
-     +0.043345, +0.974962,
-     +0.057804, +0.960503,
-     +0.067415, +0.974962,
-     +0.057804, +0.989420,
-     +0.057804, +0.974962,
-     +0.014429, +0.931587,
-     +0.028887, +0.946045,
-     +0.028887, +0.931587,
-     +0.014429, +0.960503,
-     +0.014429, +0.946045,
-     +0.086720, +0.946045,
-     +0.086720, +0.931587,
-     +0.101178, +0.931587,
-     +0.102750, +0.961976,
-     +0.101178, +0.946045,
-     +0.033214, +0.908776,
-     +0.043601, +0.919163,
-     +0.033214, +0.919163,
-     +0.050505, +0.908776,
-     +0.043601, +0.908776,
-     +0.053988, +0.929550,
-     +0.043601, +0.929550,
-     +0.033214, +0.929550,
-     +0.033214, +0.939937,
-     +0.043601, +0.939937,
-     +0.053988, +0.950323,
-     +0.043601, +0.950323,
-     +0.033214, +0.950323,
-     +0.043601, +0.960710,
-     +0.033214, +0.960710,
-     +0.050505, +0.971097,
-     +0.043601, +0.971097,
-     +0.033214, +0.971097,
-     +0.033214, +0.981484,
-     +0.050505, +0.981484,
-     +0.043601, +0.981484,
-     +0.043601, +0.991871,
-     +0.033214, +0.991871,
-     +0.012440, +0.950323,
-     +0.022827, +0.960710,
-     +0.012440, +0.960710,
-     +0.022827, +0.950323,
-     +0.022827, +0.971097,
-     +0.012440, +0.971097,
-     +0.064375, +0.960710,
-     +0.053988, +0.960710,
-     +0.074761, +0.950323,
-     +0.064375, +0.950323,
-     +0.075890, +0.972155,
-     +0.064375, +0.973013,
-     +0.049034, +0.947375,
-     +0.984513, +0.697236,
-     +0.109722, +0.052739,
-     +0.114343, +0.956117,
-     +0.029701, +0.939065,
-     +0.037537, +0.068918,
-     +0.067415, +0.989420,
-     +0.043345, +0.989420,
-     +0.028887, +0.960503,
-     +0.086720, +0.963170,
-     +0.053988, +0.919163,
-     +0.053988, +0.939937,
-     +0.050505, +0.991871,
-     +0.074761, +0.960710,
-};
-static const unsigned int vertex_indices[3456] = {
-      22,   2,  10,
-      21,   1,  24,
-       7,  23,  14,
-       2,  29,   8,
-       0,  21,  24,
-       1,  23,  18,
-       3,  23,  11,
-       2,  19,  10,
-      19,   7,  12,
-       6,  19,  12,
-      22,   0,   9,
-      20,   5,  15,
-      13,  15,   4,
-       7,  20,  12,
-       5,  23,  17,
-      29,   1,  18,
-      22,   4,  16,
-       6,  22,  10,
-      19,   3,  11,
-      24,   9,   0,
-       4,  21,  16,
-       5,  21,  15,
-      29,   3,   8,
-       6,  20,  13,
-      45,  42,  30,
-      44,  41,  50,
-      34,  31,  28,
-      45,  51,  48,
-      38,  41,  36,
-      44,  43,  37,
-      31,  49,  46,
-      45,  39,  47,
-      39,  28,  31,
-      27,  39,  30,
-      42,  38,  36,
-      40,  26,  34,
-      25,  40,  33,
-      40,  28,  32,
-      26,  43,  34,
-      51,  44,  50,
-      42,  25,  33,
-      42,  27,  30,
-      39,  46,  47,
-      38,  51,  50,
-      25,  41,  35,
-      41,  26,  35,
-      46,  51,  47,
-      27,  40,  32,
-      60,  61,  72,
-      61,  62,  72,
-      59,  77,  68,
-      62,  63,  72,
-      60,  63,  54,
-     102,  84,  90,
-      54,  76,  60,
-     103,  79,  88,
-      73,  59,  66,
-     102,  78,  96,
-      58,  73,  66,
-     101,  78,  87,
-      54,  73,  64,
-      68,  69,  74,
-      67,  69,  56,
-      66,  68,  74,
-      57,  77,  71,
-      99,  80,  90,
-      76,  56,  70,
-      58,  76,  64,
-     102,  82,  93,
-     101,  79,  97,
-      86,  87,  78,
-      99,  81,  89,
-      87,  88,  79,
-     101,  83,  95,
-      88,  89,  81,
-     103,  81,  91,
-      86,  89,  98,
-     102,  80,  86,
-      85,  99,  92,
-     103,  85,  94,
-      99,  84,  92,
-      55,  73,  63,
-      94,  95,  83,
-     103,  83,  97,
-      93,  95, 100,
-      94,  92, 100,
-      53,  75,  71,
-     101,  82,  96,
-      93,  92,  84,
-      52,  76,  70,
-      75,  52,  70,
-      55,  77,  65,
-      56,  75,  70,
-      57,  75,  69,
-      77,  53,  71,
-      66,  67,  58,
-     116, 250, 237,
-     119, 250, 158,
-     238, 167, 250,
-     250, 111, 237,
-     128, 251, 177,
-     243, 171, 251,
-     251, 110, 242,
-     177, 242, 117,
-     116, 252, 158,
-     109, 252, 156,
-     155, 157, 252,
-     252, 119, 158,
-     114, 253, 223,
-     198, 226, 253,
-     226, 172, 253,
-     253, 123, 223,
-     209, 185, 134,
-     135, 254, 209,
-     192, 208, 254,
-     254, 133, 185,
-     129, 255, 178,
-     244, 169, 255,
-     169, 243, 255,
-     178, 243, 128,
-     230, 233, 152,
-     131, 256, 230,
-     235, 219, 256,
-     256, 153, 233,
-     167, 160, 111,
-     113, 257, 167,
-     257, 139, 225,
-     257, 131, 160,
-     221, 214, 145,
-     146, 258, 221,
-     201, 224, 258,
-     258, 121, 214,
-     213, 248, 142,
-     138, 259, 213,
-     240, 231, 259,
-     259, 153, 248,
-     141, 260, 220,
-     212, 187, 260,
-     260, 127, 211,
-     220, 211, 140,
-     147, 261, 182,
-     205, 229, 261,
-     261, 151, 232,
-     182, 232, 152,
-     128, 262, 188,
-     177, 154, 262,
-     262, 108, 174,
-     188, 174, 126,
-     122, 263, 168,
-     164, 154, 263,
-     263, 117, 166,
-     168, 166, 125,
-     189, 228, 148,
-     147, 264, 189,
-     227, 203, 264,
-     264, 149, 228,
-     132, 265, 207,
-     239, 166, 265,
-     265, 117, 242,
-     207, 242, 110,
-     180, 186, 138,
-     136, 266, 180,
-     266, 135, 202,
-     186, 202, 137,
-     159, 155, 109,
-     121, 267, 159,
-     267, 123, 161,
-     267, 112, 155,
-     186, 240, 138,
-     186, 247, 268,
-     268, 149, 203,
-     268, 150, 240,
-     112, 269, 157,
-     161, 172, 269,
-     269, 124, 162,
-     157, 162, 119,
-     183, 239, 132,
-     106, 270, 183,
-     245, 204, 270,
-     270, 125, 239,
-     218, 213, 142,
-     146, 271, 218,
-     215, 180, 271,
-     271, 138, 213,
-     115, 272, 246,
-     139, 272, 234,
-     236, 226, 272,
-     246, 226, 130,
-     118, 273, 200,
-     197, 198, 273,
-     273, 114, 196,
-     200, 196, 105,
-     168, 206, 122,
-     125, 274, 168,
-     204, 199, 274,
-     274, 104, 206,
-     207, 222, 132,
-     110, 275, 207,
-     171, 165, 275,
-     275, 148, 222,
-     181, 241, 118,
-     181, 248, 276,
-     248, 219, 276,
-     276, 107, 241,
-     129, 277, 187,
-     178, 188, 277,
-     188, 175, 277,
-     187, 175, 127,
-     196, 224, 105,
-     114, 278, 196,
-     223, 170, 278,
-     278, 121, 224,
-     235, 210, 107,
-     131, 279, 235,
-     225, 234, 279,
-     279, 115, 210,
-     137, 280, 247,
-     193, 245, 280,
-     280, 106, 217,
-     247, 217, 149,
-     118, 281, 197,
-     241, 210, 281,
-     281, 115, 246,
-     197, 246, 130,
-     145, 282, 216,
-     214, 159, 282,
-     282, 109, 176,
-     216, 176, 140,
-     113, 283, 195,
-     238, 162, 283,
-     283, 124, 236,
-     195, 236, 139,
-     173, 164, 122,
-     134, 284, 173,
-     190, 174, 284,
-     284, 108, 164,
-     134, 285, 190,
-     185, 191, 285,
-     285, 127, 175,
-     285, 126, 190,
-     137, 286, 193,
-     202, 194, 286,
-     286, 104, 199,
-     193, 199, 120,
-     152, 287, 230,
-     232, 163, 287,
-     287, 111, 160,
-     230, 160, 131,
-     122, 288, 173,
-     104, 288, 206,
-     288, 135, 209,
-     288, 134, 173,
-     133, 289, 191,
-     184, 216, 289,
-     289, 140, 211,
-     191, 211, 127,
-     132, 290, 183,
-     148, 290, 222,
-     290, 149, 217,
-     290, 106, 183,
-     116, 291, 179,
-     237, 163, 291,
-     291, 151, 249,
-     179, 249, 141,
-     148, 292, 189,
-     143, 292, 165,
-     292, 144, 205,
-     189, 205, 147,
-     200, 181, 118,
-     105, 293, 200,
-     201, 218, 293,
-     181, 218, 142,
-     182, 227, 147,
-     152, 294, 182,
-     233, 231, 294,
-     294, 150, 227,
-     116, 295, 156,
-     179, 220, 295,
-     295, 140, 176,
-     156, 176, 109,
-     208, 184, 133,
-     136, 296, 208,
-     215, 221, 296,
-     296, 145, 184,
-     141, 297, 212,
-     249, 229, 297,
-     297, 144, 244,
-     212, 244, 129,
-     310, 444, 352,
-     444, 313, 352,
-     444, 307, 432,
-     305, 444, 431,
-     322, 445, 437,
-     437, 365, 337,
-     445, 304, 365,
-     371, 436, 445,
-     310, 446, 350,
-     446, 303, 350,
-     446, 306, 349,
-     313, 446, 352,
-     308, 447, 392,
-     447, 324, 392,
-     366, 420, 447,
-     317, 447, 417,
-     379, 403, 328,
-     448, 329, 403,
-     402, 386, 448,
-     327, 448, 379,
-     323, 449, 438,
-     438, 363, 338,
-     437, 363, 449,
-     372, 437, 449,
-     427, 424, 346,
-     450, 325, 424,
-     413, 429, 450,
-     347, 450, 427,
-     354, 361, 305,
-     451, 307, 361,
-     451, 333, 389,
-     325, 451, 354,
-     408, 415, 339,
-     452, 340, 415,
-     418, 395, 452,
-     315, 452, 408,
-     442, 407, 336,
-     453, 332, 407,
-     425, 434, 453,
-     347, 453, 442,
-     335, 454, 406,
-     406, 381, 323,
-     454, 321, 381,
-     414, 405, 454,
-     341, 455, 399,
-     399, 423, 338,
-     455, 345, 423,
-     376, 426, 455,
-     322, 456, 371,
-     371, 348, 311,
-     456, 302, 348,
-     382, 368, 456,
-     316, 457, 358,
-     457, 302, 358,
-     457, 311, 348,
-     362, 360, 457,
-     422, 383, 342,
-     458, 341, 383,
-     397, 421, 458,
-     343, 458, 422,
-     326, 459, 433,
-     433, 360, 319,
-     459, 311, 360,
-     304, 459, 401,
-     380, 374, 332,
-     460, 330, 374,
-     460, 329, 386,
-     380, 396, 460,
-     349, 353, 303,
-     461, 315, 353,
-     461, 317, 364,
-     306, 461, 349,
-     434, 380, 332,
-     380, 441, 331,
-     462, 343, 441,
-     344, 462, 434,
-     306, 463, 355,
-     355, 366, 317,
-     463, 318, 366,
-     351, 356, 463,
-     433, 377, 326,
-     464, 300, 377,
-     398, 439, 464,
-     319, 464, 433,
-     407, 412, 336,
-     465, 340, 412,
-     374, 409, 465,
-     332, 465, 407,
-     309, 466, 428,
-     466, 333, 428,
-     420, 430, 466,
-     324, 466, 440,
-     312, 467, 391,
-     391, 392, 324,
-     467, 308, 392,
-     394, 390, 467,
-     400, 362, 316,
-     468, 319, 362,
-     393, 398, 468,
-     298, 468, 400,
-     416, 401, 326,
-     469, 304, 401,
-     359, 365, 469,
-     342, 469, 416,
-     435, 375, 312,
-     470, 336, 375,
-     413, 442, 470,
-     301, 470, 435,
-     323, 471, 372,
-     372, 382, 322,
-     369, 382, 471,
-     381, 369, 471,
-     418, 390, 299,
-     472, 308, 390,
-     364, 417, 472,
-     315, 472, 418,
-     404, 429, 301,
-     473, 325, 429,
-     428, 419, 473,
-     309, 473, 404,
-     331, 474, 387,
-     387, 439, 314,
-     474, 300, 439,
-     441, 411, 474,
-     312, 475, 435,
-     435, 404, 301,
-     475, 309, 404,
-     391, 440, 475,
-     339, 476, 408,
-     408, 353, 315,
-     476, 303, 353,
-     410, 370, 476,
-     307, 477, 432,
-     432, 356, 313,
-     477, 318, 356,
-     389, 430, 477,
-     358, 367, 316,
-     478, 328, 367,
-     368, 384, 478,
-     302, 478, 358,
-     328, 479, 379,
-     379, 385, 327,
-     479, 321, 385,
-     320, 479, 384,
-     331, 480, 396,
-     396, 388, 329,
-     480, 298, 388,
-     387, 393, 480,
-     346, 481, 426,
-     426, 357, 345,
-     481, 305, 357,
-     424, 354, 481,
-     316, 482, 400,
-     482, 298, 400,
-     482, 329, 388,
-     367, 403, 482,
-     327, 483, 378,
-     378, 410, 339,
-     483, 334, 410,
-     385, 405, 483,
-     326, 484, 416,
-     416, 422, 342,
-     484, 343, 422,
-     300, 484, 377,
-     310, 485, 431,
-     431, 357, 305,
-     485, 345, 357,
-     373, 443, 485,
-     342, 486, 359,
-     486, 337, 359,
-     486, 338, 363,
-     383, 399, 486,
-     375, 394, 312,
-     487, 299, 394,
-     412, 395, 487,
-     336, 487, 375,
-     421, 376, 341,
-     488, 346, 376,
-     425, 427, 488,
-     344, 488, 421,
-     310, 489, 373,
-     373, 414, 335,
-     489, 334, 414,
-     350, 370, 489,
-     378, 402, 327,
-     490, 330, 402,
-     415, 409, 490,
-     339, 490, 378,
-     335, 491, 443,
-     443, 423, 345,
-     491, 338, 423,
-     406, 438, 491,
-     492, 512, 500,
-     493, 512, 501,
-     512, 495, 503,
-     512, 494, 500,
-     503, 504, 494,
-     503, 505, 513,
-     505, 506, 513,
-     504, 506, 498,
-     498, 514, 507,
-     499, 514, 506,
-     514, 497, 509,
-     514, 496, 507,
-     509, 510, 496,
-     509, 511, 515,
-     511, 501, 515,
-     510, 501, 492,
-     494, 516, 500,
-     498, 516, 504,
-     516, 496, 510,
-     516, 492, 500,
-     499, 517, 508,
-     495, 517, 505,
-     517, 493, 511,
-     517, 497, 508,
-     518, 538, 527,
-     538, 519, 527,
-     538, 521, 528,
-     520, 538, 526,
-     530, 529, 520,
-     529, 531, 521,
-     532, 531, 539,
-     530, 532, 539,
-     524, 540, 532,
-     540, 525, 532,
-     540, 523, 534,
-     522, 540, 533,
-     536, 535, 522,
-     535, 537, 523,
-     527, 537, 541,
-     536, 527, 541,
-     520, 542, 530,
-     542, 524, 530,
-     542, 522, 533,
-     518, 542, 526,
-     525, 543, 531,
-     543, 521, 531,
-     543, 519, 528,
-     523, 543, 534,
-     544, 564, 553,
-     564, 545, 553,
-     564, 547, 554,
-     546, 564, 552,
-     556, 555, 546,
-     565, 547, 555,
-     565, 551, 557,
-     556, 558, 565,
-     550, 566, 558,
-     566, 551, 558,
-     566, 549, 560,
-     548, 566, 559,
-     562, 561, 548,
-     561, 563, 549,
-     553, 563, 567,
-     562, 553, 567,
-     546, 568, 556,
-     568, 550, 556,
-     568, 548, 559,
-     544, 568, 552,
-     551, 569, 557,
-     569, 547, 557,
-     569, 545, 554,
-     549, 569, 560,
-     570, 590, 578,
-     571, 590, 579,
-     590, 573, 581,
-     590, 572, 578,
-     581, 582, 572,
-     573, 591, 581,
-     591, 577, 584,
-     582, 584, 576,
-     576, 592, 585,
-     577, 592, 584,
-     592, 575, 587,
-     592, 574, 585,
-     587, 588, 574,
-     587, 589, 593,
-     589, 579, 593,
-     588, 579, 570,
-     572, 594, 578,
-     576, 594, 582,
-     594, 574, 588,
-     594, 570, 578,
-     577, 595, 586,
-     573, 595, 583,
-     595, 571, 589,
-     595, 575, 586,
-      22,   9,   2,
-      21,  17,   1,
-       7,  11,  23,
-       2,   9,  29,
-       0,  16,  21,
-       1,  17,  23,
-       3,  18,  23,
-       2,   8,  19,
-      19,  11,   7,
-       6,  10,  19,
-      22,  16,   0,
-      20,  14,   5,
-      13,  20,  15,
-       7,  14,  20,
-       5,  14,  23,
-      29,  24,   1,
-      22,  13,   4,
-       6,  13,  22,
-      19,   8,   3,
-      24,  29,   9,
-       4,  15,  21,
-       5,  17,  21,
-      29,  18,   3,
-       6,  12,  20,
-      45,  48,  42,
-      44,  37,  41,
-      34,  43,  31,
-      45,  47,  51,
-      38,  50,  41,
-      44,  49,  43,
-      31,  43,  49,
-      45,  30,  39,
-      39,  32,  28,
-      27,  32,  39,
-      42,  48,  38,
-      40,  35,  26,
-      25,  35,  40,
-      40,  34,  28,
-      26,  37,  43,
-      51,  49,  44,
-      42,  36,  25,
-      42,  33,  27,
-      39,  31,  46,
-      38,  48,  51,
-      25,  36,  41,
-      41,  37,  26,
-      46,  49,  51,
-      27,  33,  40,
-      60,  52,  61,
-      61,  53,  62,
-      59,  65,  77,
-      62,  55,  63,
-      60,  72,  63,
-     102,  93,  84,
-      54,  64,  76,
-     103,  97,  79,
-      73,  65,  59,
-     102,  86,  78,
-      58,  64,  73,
-     101,  96,  78,
-      54,  63,  73,
-      68,  57,  69,
-      67,  74,  69,
-      66,  59,  68,
-      57,  68,  77,
-      99,  89,  80,
-      76,  67,  56,
-      58,  67,  76,
-     102,  96,  82,
-     101,  87,  79,
-      86,  98,  87,
-      99,  91,  81,
-      87,  98,  88,
-     101,  97,  83,
-      88,  98,  89,
-     103,  88,  81,
-      86,  80,  89,
-     102,  90,  80,
-      85,  91,  99,
-     103,  91,  85,
-      99,  90,  84,
-      55,  65,  73,
-      94, 100,  95,
-     103,  94,  83,
-      93,  82,  95,
-      94,  85,  92,
-      53,  61,  75,
-     101,  95,  82,
-      93, 100,  92,
-      52,  60,  76,
-      75,  61,  52,
-      55,  62,  77,
-      56,  69,  75,
-      57,  71,  75,
-      77,  62,  53,
-      66,  74,  67,
-     116, 158, 250,
-     119, 238, 250,
-     238, 113, 167,
-     250, 167, 111,
-     128, 243, 251,
-     243, 143, 171,
-     251, 171, 110,
-     177, 251, 242,
-     116, 156, 252,
-     109, 155, 252,
-     155, 112, 157,
-     252, 157, 119,
-     114, 198, 253,
-     198, 130, 226,
-     226, 124, 172,
-     253, 172, 123,
-     209, 254, 185,
-     135, 192, 254,
-     192, 136, 208,
-     254, 208, 133,
-     129, 244, 255,
-     244, 144, 169,
-     169, 143, 243,
-     178, 255, 243,
-     230, 256, 233,
-     131, 235, 256,
-     235, 107, 219,
-     256, 219, 153,
-     167, 257, 160,
-     113, 195, 257,
-     257, 195, 139,
-     257, 225, 131,
-     221, 258, 214,
-     146, 201, 258,
-     201, 105, 224,
-     258, 224, 121,
-     213, 259, 248,
-     138, 240, 259,
-     240, 150, 231,
-     259, 231, 153,
-     141, 212, 260,
-     212, 129, 187,
-     260, 187, 127,
-     220, 260, 211,
-     147, 205, 261,
-     205, 144, 229,
-     261, 229, 151,
-     182, 261, 232,
-     128, 177, 262,
-     177, 117, 154,
-     262, 154, 108,
-     188, 262, 174,
-     122, 164, 263,
-     164, 108, 154,
-     263, 154, 117,
-     168, 263, 166,
-     189, 264, 228,
-     147, 227, 264,
-     227, 150, 203,
-     264, 203, 149,
-     132, 239, 265,
-     239, 125, 166,
-     265, 166, 117,
-     207, 265, 242,
-     180, 266, 186,
-     136, 192, 266,
-     266, 192, 135,
-     186, 266, 202,
-     159, 267, 155,
-     121, 170, 267,
-     267, 170, 123,
-     267, 161, 112,
-     186, 268, 240,
-     186, 137, 247,
-     268, 247, 149,
-     268, 203, 150,
-     112, 161, 269,
-     161, 123, 172,
-     269, 172, 124,
-     157, 269, 162,
-     183, 270, 239,
-     106, 245, 270,
-     245, 120, 204,
-     270, 204, 125,
-     218, 271, 213,
-     146, 215, 271,
-     215, 136, 180,
-     271, 180, 138,
-     115, 234, 272,
-     139, 236, 272,
-     236, 124, 226,
-     246, 272, 226,
-     118, 197, 273,
-     197, 130, 198,
-     273, 198, 114,
-     200, 273, 196,
-     168, 274, 206,
-     125, 204, 274,
-     204, 120, 199,
-     274, 199, 104,
-     207, 275, 222,
-     110, 171, 275,
-     171, 143, 165,
-     275, 165, 148,
-     181, 276, 241,
-     181, 142, 248,
-     248, 153, 219,
-     276, 219, 107,
-     129, 178, 277,
-     178, 128, 188,
-     188, 126, 175,
-     187, 277, 175,
-     196, 278, 224,
-     114, 223, 278,
-     223, 123, 170,
-     278, 170, 121,
-     235, 279, 210,
-     131, 225, 279,
-     225, 139, 234,
-     279, 234, 115,
-     137, 193, 280,
-     193, 120, 245,
-     280, 245, 106,
-     247, 280, 217,
-     118, 241, 281,
-     241, 107, 210,
-     281, 210, 115,
-     197, 281, 246,
-     145, 214, 282,
-     214, 121, 159,
-     282, 159, 109,
-     216, 282, 176,
-     113, 238, 283,
-     238, 119, 162,
-     283, 162, 124,
-     195, 283, 236,
-     173, 284, 164,
-     134, 190, 284,
-     190, 126, 174,
-     284, 174, 108,
-     134, 185, 285,
-     185, 133, 191,
-     285, 191, 127,
-     285, 175, 126,
-     137, 202, 286,
-     202, 135, 194,
-     286, 194, 104,
-     193, 286, 199,
-     152, 232, 287,
-     232, 151, 163,
-     287, 163, 111,
-     230, 287, 160,
-     122, 206, 288,
-     104, 194, 288,
-     288, 194, 135,
-     288, 209, 134,
-     133, 184, 289,
-     184, 145, 216,
-     289, 216, 140,
-     191, 289, 211,
-     132, 222, 290,
-     148, 228, 290,
-     290, 228, 149,
-     290, 217, 106,
-     116, 237, 291,
-     237, 111, 163,
-     291, 163, 151,
-     179, 291, 249,
-     148, 165, 292,
-     143, 169, 292,
-     292, 169, 144,
-     189, 292, 205,
-     200, 293, 181,
-     105, 201, 293,
-     201, 146, 218,
-     181, 293, 218,
-     182, 294, 227,
-     152, 233, 294,
-     233, 153, 231,
-     294, 231, 150,
-     116, 179, 295,
-     179, 141, 220,
-     295, 220, 140,
-     156, 295, 176,
-     208, 296, 184,
-     136, 215, 296,
-     215, 146, 221,
-     296, 221, 145,
-     141, 249, 297,
-     249, 151, 229,
-     297, 229, 144,
-     212, 297, 244,
-     310, 431, 444,
-     444, 432, 313,
-     444, 361, 307,
-     305, 361, 444,
-     322, 371, 445,
-     437, 445, 365,
-     445, 436, 304,
-     371, 311, 436,
-     310, 352, 446,
-     446, 349, 303,
-     446, 351, 306,
-     313, 351, 446,
-     308, 417, 447,
-     447, 420, 324,
-     366, 318, 420,
-     317, 366, 447,
-     379, 448, 403,
-     448, 386, 329,
-     402, 330, 386,
-     327, 402, 448,
-     323, 372, 449,
-     438, 449, 363,
-     437, 337, 363,
-     372, 322, 437,
-     427, 450, 424,
-     450, 429, 325,
-     413, 301, 429,
-     347, 413, 450,
-     354, 451, 361,
-     451, 389, 307,
-     451, 419, 333,
-     325, 419, 451,
-     408, 452, 415,
-     452, 395, 340,
-     418, 299, 395,
-     315, 418, 452,
-     442, 453, 407,
-     453, 434, 332,
-     425, 344, 434,
-     347, 425, 453,
-     335, 414, 454,
-     406, 454, 381,
-     454, 405, 321,
-     414, 334, 405,
-     341, 376, 455,
-     399, 455, 423,
-     455, 426, 345,
-     376, 346, 426,
-     322, 382, 456,
-     371, 456, 348,
-     456, 368, 302,
-     382, 320, 368,
-     316, 362, 457,
-     457, 348, 302,
-     457, 360, 311,
-     362, 319, 360,
-     422, 458, 383,
-     458, 421, 341,
-     397, 344, 421,
-     343, 397, 458,
-     326, 401, 459,
-     433, 459, 360,
-     459, 436, 311,
-     304, 436, 459,
-     380, 460, 374,
-     460, 386, 330,
-     460, 396, 329,
-     380, 331, 396,
-     349, 461, 353,
-     461, 364, 315,
-     461, 355, 317,
-     306, 355, 461,
-     434, 462, 380,
-     380, 462, 441,
-     462, 397, 343,
-     344, 397, 462,
-     306, 351, 463,
-     355, 463, 366,
-     463, 356, 318,
-     351, 313, 356,
-     433, 464, 377,
-     464, 439, 300,
-     398, 314, 439,
-     319, 398, 464,
-     407, 465, 412,
-     465, 409, 340,
-     374, 330, 409,
-     332, 374, 465,
-     309, 440, 466,
-     466, 430, 333,
-     420, 318, 430,
-     324, 420, 466,
-     312, 394, 467,
-     391, 467, 392,
-     467, 390, 308,
-     394, 299, 390,
-     400, 468, 362,
-     468, 398, 319,
-     393, 314, 398,
-     298, 393, 468,
-     416, 469, 401,
-     469, 365, 304,
-     359, 337, 365,
-     342, 359, 469,
-     435, 470, 375,
-     470, 442, 336,
-     413, 347, 442,
-     301, 413, 470,
-     323, 381, 471,
-     372, 471, 382,
-     369, 320, 382,
-     381, 321, 369,
-     418, 472, 390,
-     472, 417, 308,
-     364, 317, 417,
-     315, 364, 472,
-     404, 473, 429,
-     473, 419, 325,
-     428, 333, 419,
-     309, 428, 473,
-     331, 441, 474,
-     387, 474, 439,
-     474, 411, 300,
-     441, 343, 411,
-     312, 391, 475,
-     435, 475, 404,
-     475, 440, 309,
-     391, 324, 440,
-     339, 410, 476,
-     408, 476, 353,
-     476, 370, 303,
-     410, 334, 370,
-     307, 389, 477,
-     432, 477, 356,
-     477, 430, 318,
-     389, 333, 430,
-     358, 478, 367,
-     478, 384, 328,
-     368, 320, 384,
-     302, 368, 478,
-     328, 384, 479,
-     379, 479, 385,
-     479, 369, 321,
-     320, 369, 479,
-     331, 387, 480,
-     396, 480, 388,
-     480, 393, 298,
-     387, 314, 393,
-     346, 424, 481,
-     426, 481, 357,
-     481, 354, 305,
-     424, 325, 354,
-     316, 367, 482,
-     482, 388, 298,
-     482, 403, 329,
-     367, 328, 403,
-     327, 385, 483,
-     378, 483, 410,
-     483, 405, 334,
-     385, 321, 405,
-     326, 377, 484,
-     416, 484, 422,
-     484, 411, 343,
-     300, 411, 484,
-     310, 373, 485,
-     431, 485, 357,
-     485, 443, 345,
-     373, 335, 443,
-     342, 383, 486,
-     486, 363, 337,
-     486, 399, 338,
-     383, 341, 399,
-     375, 487, 394,
-     487, 395, 299,
-     412, 340, 395,
-     336, 412, 487,
-     421, 488, 376,
-     488, 427, 346,
-     425, 347, 427,
-     344, 425, 488,
-     310, 350, 489,
-     373, 489, 414,
-     489, 370, 334,
-     350, 303, 370,
-     378, 490, 402,
-     490, 409, 330,
-     415, 340, 409,
-     339, 415, 490,
-     335, 406, 491,
-     443, 491, 423,
-     491, 438, 338,
-     406, 323, 438,
-     492, 501, 512,
-     493, 502, 512,
-     512, 502, 495,
-     512, 503, 494,
-     503, 513, 504,
-     503, 495, 505,
-     505, 499, 506,
-     504, 513, 506,
-     498, 506, 514,
-     499, 508, 514,
-     514, 508, 497,
-     514, 509, 496,
-     509, 515, 510,
-     509, 497, 511,
-     511, 493, 501,
-     510, 515, 501,
-     494, 504, 516,
-     498, 507, 516,
-     516, 507, 496,
-     516, 510, 492,
-     499, 505, 517,
-     495, 502, 517,
-     517, 502, 493,
-     517, 511, 497,
-     518, 526, 538,
-     538, 528, 519,
-     538, 529, 521,
-     520, 529, 538,
-     530, 539, 529,
-     529, 539, 531,
-     532, 525, 531,
-     530, 524, 532,
-     524, 533, 540,
-     540, 534, 525,
-     540, 535, 523,
-     522, 535, 540,
-     536, 541, 535,
-     535, 541, 537,
-     527, 519, 537,
-     536, 518, 527,
-     520, 526, 542,
-     542, 533, 524,
-     542, 536, 522,
-     518, 536, 542,
-     525, 534, 543,
-     543, 528, 521,
-     543, 537, 519,
-     523, 537, 543,
-     544, 552, 564,
-     564, 554, 545,
-     564, 555, 547,
-     546, 555, 564,
-     556, 565, 555,
-     565, 557, 547,
-     565, 558, 551,
-     556, 550, 558,
-     550, 559, 566,
-     566, 560, 551,
-     566, 561, 549,
-     548, 561, 566,
-     562, 567, 561,
-     561, 567, 563,
-     553, 545, 563,
-     562, 544, 553,
-     546, 552, 568,
-     568, 559, 550,
-     568, 562, 548,
-     544, 562, 568,
-     551, 560, 569,
-     569, 554, 547,
-     569, 563, 545,
-     549, 563, 569,
-     570, 579, 590,
-     571, 580, 590,
-     590, 580, 573,
-     590, 581, 572,
-     581, 591, 582,
-     573, 583, 591,
-     591, 583, 577,
-     582, 591, 584,
-     576, 584, 592,
-     577, 586, 592,
-     592, 586, 575,
-     592, 587, 574,
-     587, 593, 588,
-     587, 575, 589,
-     589, 571, 579,
-     588, 593, 579,
-     572, 582, 594,
-     576, 585, 594,
-     594, 585, 574,
-     594, 588, 570,
-     577, 583, 595,
-     573, 580, 595,
-     595, 580, 571,
-     595, 589, 575,
-};
-static const unsigned int tex_indices[3456] = {
-       0,   1,   2,
-       3,   4,   5,
-       6,   7,   8,
-       1,   9,  10,
-      11,   3,   5,
-       4,   7,   8,
-       6,   7,  12,
-       1,  13,   2,
-      13,   6,  10,
-       1,  13,  10,
-       0,  11,  14,
-       9,   4,   5,
-      14,   5,  11,
-       6,   9,  10,
-       4,   7,  15,
-       9,   4,   8,
-       0,  11,  16,
-       1,   0,   2,
-      13,   6,  12,
-       5,  14,  11,
-      11,   3,  16,
-       4,   3,   5,
-       9,   6,  10,
-       1,   9,  14,
-      17,  18,  19,
-      20,  21,  22,
-      23,  24,  25,
-      17,  26,  27,
-      28,  21,  29,
-      20,  30,  31,
-      24,  23,  25,
-      17,  32,  33,
-      32,  25,  24,
-      17,  32,  19,
-      18,  28,  29,
-      26,  20,  23,
-      28,  26,  27,
-      26,  25,  33,
-      20,  30,  23,
-      26,  20,  22,
-      18,  28,  27,
-      18,  17,  19,
-      32,  25,  33,
-      28,  26,  22,
-      28,  21,  22,
-      21,  20,  22,
-      25,  26,  33,
-      17,  26,  33,
-      34,  35,  36,
-      35,  37,  36,
-      38,  39,  40,
-      41,  42,  43,
-      44,  42,  45,
-      46,  47,  48,
-      45,  49,  44,
-      50,  51,  52,
-      53,  38,  54,
-      55,  56,  57,
-      58,  53,  54,
-      59,  56,  60,
-      45,  53,  61,
-      62,  63,  64,
-      65,  63,  66,
-      54,  40,  67,
-      68,  69,  70,
-      71,  72,  48,
-      73,  66,  74,
-      58,  49,  61,
-      55,  75,  76,
-      59,  51,  77,
-      78,  60,  56,
-      71,  79,  80,
-      60,  52,  51,
-      59,  81,  82,
-      83,  80,  79,
-      84,  79,  85,
-      86,  80,  87,
-      46,  72,  86,
-      88,  71,  89,
-      84,  88,  90,
-      71,  47,  89,
-      91,  53,  42,
-      92,  82,  81,
-      50,  81,  77,
-      76,  82,  93,
-      90,  89,  94,
-      95,  96,  70,
-      59,  75,  57,
-      97,  89,  47,
-      98,  73,  74,
-      96,  98,  74,
-      91,  39,  99,
-      66,  96,  74,
-      68,  96,  63,
-      69,  95,  70,
-      54, 100,  58,
-     101, 102, 103,
-     104, 102, 105,
-     106, 107, 102,
-     102, 108, 103,
-     109, 110, 111,
-     112, 113, 110,
-     110, 114, 115,
-     111, 115, 116,
-     101, 117, 105,
-     118, 117, 119,
-     120, 121, 117,
-     117, 104, 105,
-     122, 123, 124,
-     125, 126, 123,
-     126, 127, 123,
-     123, 128, 124,
-     129, 130, 131,
-     132, 133, 129,
-     134, 135, 133,
-     133, 136, 130,
-     137, 138, 139,
-     140, 141, 138,
-     141, 112, 138,
-     139, 112, 109,
-     142, 143, 144,
-     145, 146, 142,
-     147, 148, 146,
-     146, 149, 143,
-     107, 150, 108,
-     151, 152, 107,
-     152, 153, 154,
-     152, 155, 150,
-     156, 157, 158,
-     159, 160, 156,
-     161, 162, 160,
-     160, 163, 157,
-     164, 165, 166,
-     167, 168, 164,
-     169, 170, 168,
-     168, 149, 165,
-     171, 172, 173,
-     174, 175, 172,
-     172, 176, 177,
-     173, 177, 178,
-     179, 180, 181,
-     182, 183, 180,
-     180, 184, 185,
-     181, 185, 186,
-     109, 187, 188,
-     111, 189, 187,
-     187, 190, 191,
-     188, 191, 192,
-     193, 194, 195,
-     196, 189, 194,
-     194, 116, 197,
-     195, 197, 198,
-     199, 200, 201,
-     202, 203, 199,
-     204, 205, 203,
-     203, 206, 200,
-     207, 208, 209,
-     210, 197, 208,
-     208, 116, 115,
-     209, 115, 114,
-     211, 212, 167,
-     213, 214, 211,
-     214, 132, 215,
-     212, 215, 216,
-     217, 120, 118,
-     218, 219, 217,
-     219, 220, 221,
-     219, 222, 120,
-     212, 169, 167,
-     212, 223, 224,
-     224, 206, 205,
-     224, 225, 169,
-     222, 226, 121,
-     221, 227, 226,
-     226, 228, 229,
-     121, 229, 104,
-     230, 231, 232,
-     233, 234, 230,
-     235, 236, 234,
-     234, 237, 231,
-     238, 164, 166,
-     159, 239, 238,
-     240, 211, 239,
-     239, 167, 164,
-     241, 242, 243,
-     244, 242, 245,
-     246, 126, 242,
-     243, 126, 247,
-     248, 249, 250,
-     251, 125, 249,
-     249, 122, 252,
-     250, 252, 253,
-     254, 255, 256,
-     237, 257, 254,
-     236, 258, 257,
-     257, 259, 255,
-     209, 260, 207,
-     114, 261, 209,
-     113, 262, 261,
-     261, 263, 260,
-     264, 265, 248,
-     264, 165, 266,
-     165, 148, 266,
-     266, 267, 265,
-     137, 268, 175,
-     139, 188, 268,
-     188, 269, 268,
-     175, 269, 176,
-     252, 162, 253,
-     122, 270, 252,
-     124, 271, 270,
-     270, 163, 162,
-     147, 272, 267,
-     145, 273, 147,
-     274, 245, 273,
-     273, 241, 272,
-     216, 275, 223,
-     276, 235, 275,
-     275, 233, 277,
-     223, 277, 206,
-     248, 278, 251,
-     265, 272, 278,
-     278, 241, 243,
-     251, 243, 247,
-     279, 280, 281,
-     282, 217, 280,
-     280, 118, 283,
-     281, 283, 178,
-     151, 284, 285,
-     106, 229, 284,
-     284, 228, 286,
-     285, 286, 153,
-     287, 196, 193,
-     288, 289, 287,
-     290, 191, 289,
-     289, 190, 196,
-     288, 291, 290,
-     292, 293, 291,
-     291, 176, 269,
-     291, 192, 290,
-     216, 294, 276,
-     215, 295, 294,
-     294, 259, 258,
-     276, 258, 296,
-     186, 297, 298,
-     185, 299, 297,
-     297, 108, 150,
-     298, 150, 155,
-     256, 300, 301,
-     259, 300, 255,
-     300, 132, 129,
-     300, 131, 301,
-     302, 303, 293,
-     304, 281, 303,
-     303, 178, 177,
-     293, 177, 176,
-     232, 305, 230,
-     201, 305, 306,
-     305, 206, 277,
-     305, 233, 230,
-     101, 307, 308,
-     103, 299, 307,
-     307, 184, 309,
-     308, 309, 171,
-     263, 310, 311,
-     312, 310, 262,
-     310, 313, 182,
-     311, 182, 179,
-     250, 264, 248,
-     253, 314, 250,
-     161, 238, 314,
-     264, 238, 166,
-     315, 204, 202,
-     144, 316, 315,
-     143, 170, 316,
-     316, 225, 204,
-     101, 317, 119,
-     308, 173, 317,
-     317, 178, 283,
-     119, 283, 118,
-     135, 318, 136,
-     213, 319, 135,
-     240, 156, 319,
-     319, 158, 318,
-     171, 320, 174,
-     309, 183, 320,
-     320, 313, 140,
-     174, 140, 137,
-     321, 322, 323,
-     322, 324, 323,
-     322, 325, 326,
-     327, 322, 328,
-     329, 330, 331,
-     331, 332, 333,
-     330, 334, 332,
-     335, 336, 330,
-     321, 337, 338,
-     337, 339, 338,
-     337, 340, 341,
-     324, 337, 323,
-     342, 343, 344,
-     343, 345, 344,
-     346, 347, 343,
-     348, 343, 349,
-     350, 351, 352,
-     353, 354, 351,
-     355, 356, 353,
-     357, 353, 350,
-     358, 359, 360,
-     360, 361, 362,
-     331, 361, 359,
-     363, 331, 359,
-     364, 365, 366,
-     367, 368, 365,
-     369, 370, 367,
-     371, 367, 364,
-     372, 373, 327,
-     374, 325, 373,
-     374, 375, 376,
-     377, 374, 372,
-     378, 379, 380,
-     381, 382, 379,
-     383, 384, 381,
-     385, 381, 378,
-     386, 387, 388,
-     389, 390, 387,
-     391, 392, 389,
-     371, 389, 386,
-     393, 394, 395,
-     395, 396, 358,
-     394, 397, 396,
-     398, 399, 394,
-     400, 401, 402,
-     402, 403, 362,
-     401, 404, 403,
-     405, 406, 401,
-     329, 407, 335,
-     335, 408, 409,
-     407, 410, 408,
-     411, 412, 407,
-     413, 414, 415,
-     414, 410, 415,
-     414, 409, 408,
-     416, 417, 414,
-     418, 419, 420,
-     421, 422, 419,
-     423, 424, 421,
-     425, 421, 418,
-     426, 427, 428,
-     428, 417, 429,
-     427, 409, 417,
-     334, 427, 430,
-     431, 432, 390,
-     433, 434, 432,
-     433, 354, 356,
-     431, 435, 433,
-     341, 436, 339,
-     437, 438, 436,
-     437, 439, 440,
-     340, 437, 341,
-     392, 431, 390,
-     431, 441, 442,
-     443, 425, 441,
-     444, 443, 392,
-     340, 445, 446,
-     446, 447, 439,
-     445, 448, 447,
-     449, 450, 445,
-     451, 452, 453,
-     454, 455, 452,
-     456, 457, 454,
-     458, 454, 451,
-     387, 459, 388,
-     460, 382, 459,
-     432, 461, 460,
-     390, 460, 387,
-     462, 463, 464,
-     463, 465, 464,
-     347, 466, 463,
-     345, 463, 467,
-     468, 469, 470,
-     470, 344, 345,
-     469, 342, 344,
-     471, 472, 469,
-     473, 474, 475,
-     476, 458, 474,
-     477, 456, 476,
-     478, 476, 473,
-     479, 430, 426,
-     480, 334, 430,
-     481, 332, 480,
-     482, 480, 479,
-     483, 484, 468,
-     485, 388, 484,
-     369, 386, 485,
-     486, 485, 483,
-     358, 487, 363,
-     363, 411, 329,
-     488, 411, 487,
-     396, 488, 487,
-     383, 472, 489,
-     490, 342, 472,
-     491, 349, 490,
-     385, 490, 383,
-     492, 370, 486,
-     493, 368, 370,
-     464, 494, 493,
-     462, 493, 492,
-     442, 495, 496,
-     496, 457, 497,
-     495, 455, 457,
-     441, 498, 495,
-     468, 499, 483,
-     483, 492, 486,
-     499, 462, 492,
-     470, 467, 499,
-     500, 501, 502,
-     502, 436, 438,
-     501, 339, 436,
-     503, 504, 501,
-     325, 505, 326,
-     326, 450, 324,
-     505, 448, 450,
-     376, 506, 505,
-     415, 507, 413,
-     508, 509, 507,
-     412, 510, 508,
-     410, 508, 415,
-     509, 511, 512,
-     512, 513, 514,
-     511, 397, 513,
-     515, 511, 510,
-     442, 516, 435,
-     435, 517, 354,
-     516, 478, 517,
-     496, 477, 516,
-     518, 519, 406,
-     406, 520, 404,
-     519, 327, 520,
-     521, 372, 519,
-     475, 522, 473,
-     522, 478, 473,
-     522, 354, 517,
-     523, 351, 522,
-     514, 524, 525,
-     525, 503, 500,
-     524, 526, 503,
-     513, 399, 524,
-     453, 527, 528,
-     528, 418, 420,
-     527, 425, 418,
-     455, 527, 452,
-     321, 529, 328,
-     328, 520, 327,
-     529, 404, 520,
-     530, 531, 529,
-     482, 532, 481,
-     532, 333, 481,
-     532, 362, 361,
-     533, 402, 532,
-     484, 471, 468,
-     534, 489, 471,
-     459, 384, 534,
-     388, 534, 484,
-     424, 535, 422,
-     536, 366, 535,
-     391, 364, 536,
-     444, 536, 424,
-     321, 537, 530,
-     530, 398, 393,
-     537, 526, 398,
-     338, 504, 537,
-     538, 355, 357,
-     539, 434, 355,
-     379, 461, 539,
-     380, 539, 538,
-     393, 540, 531,
-     531, 403, 404,
-     540, 362, 403,
-     395, 360, 540,
-     541, 542, 543,
-     544, 542, 545,
-     542, 546, 547,
-     542, 548, 543,
-     547, 549, 548,
-     547, 550, 551,
-     550, 552, 551,
-     549, 552, 553,
-     553, 554, 555,
-     556, 554, 552,
-     554, 557, 558,
-     554, 559, 555,
-     558, 560, 559,
-     558, 561, 562,
-     561, 563, 562,
-     560, 563, 564,
-     565, 566, 567,
-     553, 566, 568,
-     566, 559, 569,
-     566, 570, 567,
-     556, 571, 572,
-     573, 571, 574,
-     571, 575, 576,
-     571, 557, 572,
-     541, 542, 545,
-     542, 544, 545,
-     542, 546, 577,
-     548, 542, 543,
-     549, 547, 548,
-     547, 550, 546,
-     552, 550, 551,
-     549, 552, 551,
-     553, 554, 552,
-     554, 556, 552,
-     554, 557, 572,
-     559, 554, 555,
-     560, 558, 559,
-     558, 561, 557,
-     563, 561, 562,
-     560, 563, 562,
-     565, 566, 568,
-     566, 553, 568,
-     566, 559, 555,
-     570, 566, 567,
-     556, 571, 574,
-     571, 573, 574,
-     571, 575, 578,
-     557, 571, 572,
-     579, 580, 581,
-     580, 582, 581,
-     580, 583, 584,
-     585, 580, 586,
-     587, 588, 585,
-     589, 583, 588,
-     589, 590, 591,
-     587, 592, 589,
-     593, 594, 592,
-     594, 590, 592,
-     594, 595, 596,
-     597, 594, 598,
-     599, 600, 597,
-     600, 601, 595,
-     602, 601, 603,
-     599, 602, 603,
-     604, 605, 606,
-     605, 593, 606,
-     605, 597, 598,
-     607, 605, 608,
-     590, 609, 610,
-     609, 611, 610,
-     609, 612, 613,
-     595, 609, 596,
-     614, 615, 616,
-     617, 615, 618,
-     615, 619, 620,
-     615, 621, 616,
-     620, 622, 621,
-     619, 623, 620,
-     623, 624, 625,
-     622, 625, 626,
-     626, 627, 628,
-     624, 627, 625,
-     627, 629, 630,
-     627, 631, 628,
-     630, 632, 631,
-     630, 633, 634,
-     633, 635, 634,
-     632, 635, 636,
-     637, 638, 639,
-     626, 638, 640,
-     638, 631, 641,
-     638, 642, 639,
-     624, 643, 644,
-     645, 643, 646,
-     643, 647, 648,
-     643, 629, 644,
-       0,  14,   1,
-       3,  15,   4,
-       6,  12,   7,
-       1,  14,   9,
-      11,  16,   3,
-       4,  15,   7,
-       6,   8,   7,
-       1,  10,  13,
-      13,  12,   6,
-       1,   2,  13,
-       0,  16,  11,
-       9,   8,   4,
-      14,   9,   5,
-       6,   8,   9,
-       4,   8,   7,
-       9,   5,   4,
-       0,  14,  11,
-       1,  14,   0,
-      13,  10,   6,
-       5,   9,  14,
-      11,   5,   3,
-       4,  15,   3,
-       9,   8,   6,
-       1,  10,   9,
-      17,  27,  18,
-      20,  31,  21,
-      23,  30,  24,
-      17,  33,  26,
-      28,  22,  21,
-      20,  23,  30,
-      24,  30,  23,
-      17,  19,  32,
-      32,  33,  25,
-      17,  33,  32,
-      18,  27,  28,
-      26,  22,  20,
-      28,  22,  26,
-      26,  23,  25,
-      20,  31,  30,
-      26,  23,  20,
-      18,  29,  28,
-      18,  27,  17,
-      32,  24,  25,
-      28,  27,  26,
-      28,  29,  21,
-      21,  31,  20,
-      25,  23,  26,
-      17,  27,  26,
-      34,  98,  35,
-      35,  95,  37,
-      38,  99,  39,
-      41,  91,  42,
-      44,  43,  42,
-      46,  97,  47,
-      45,  61,  49,
-      50,  77,  51,
-      53,  99,  38,
-      55,  78,  56,
-      58,  61,  53,
-      59,  57,  56,
-      45,  42,  53,
-      62,  68,  63,
-      65,  64,  63,
-      54,  38,  40,
-      68,  62,  69,
-      71,  80,  72,
-      73,  65,  66,
-      58, 100,  49,
-      55,  57,  75,
-      59,  60,  51,
-      78, 649,  60,
-      71,  85,  79,
-      60, 649,  52,
-      59,  77,  81,
-      83,  87,  80,
-      84,  83,  79,
-      86,  72,  80,
-      46,  48,  72,
-      88,  85,  71,
-      84,  85,  88,
-      71,  48,  47,
-      91,  99,  53,
-      92,  93,  82,
-      50,  92,  81,
-      76,  75,  82,
-      90,  88,  89,
-      95,  35,  96,
-      59,  82,  75,
-      97,  94,  89,
-      98,  34,  73,
-      96,  35,  98,
-      91,  41,  39,
-      66,  63,  96,
-      68,  70,  96,
-      69,  37,  95,
-      54,  67, 100,
-     101, 105, 102,
-     104, 106, 102,
-     106, 151, 107,
-     102, 107, 108,
-     109, 112, 110,
-     112, 312, 113,
-     110, 113, 114,
-     111, 110, 115,
-     101, 119, 117,
-     118, 120, 117,
-     120, 222, 121,
-     117, 121, 104,
-     122, 125, 123,
-     125, 247, 126,
-     126, 650, 127,
-     123, 127, 128,
-     129, 133, 130,
-     132, 134, 133,
-     134, 213, 135,
-     133, 135, 136,
-     137, 140, 138,
-     140, 313, 141,
-     141, 312, 112,
-     139, 138, 112,
-     142, 146, 143,
-     145, 147, 146,
-     147, 267, 148,
-     146, 148, 149,
-     107, 152, 150,
-     151, 285, 152,
-     152, 285, 153,
-     152, 154, 155,
-     156, 160, 157,
-     159, 161, 160,
-     161, 253, 162,
-     160, 162, 163,
-     164, 168, 165,
-     167, 169, 168,
-     169, 225, 170,
-     168, 170, 149,
-     171, 174, 172,
-     174, 137, 175,
-     172, 175, 176,
-     173, 172, 177,
-     179, 182, 180,
-     182, 313, 183,
-     180, 183, 184,
-     181, 180, 185,
-     109, 111, 187,
-     111, 116, 189,
-     187, 189, 190,
-     188, 187, 191,
-     193, 196, 194,
-     196, 190, 189,
-     194, 189, 116,
-     195, 194, 197,
-     199, 203, 200,
-     202, 204, 203,
-     204, 225, 205,
-     203, 205, 206,
-     207, 210, 208,
-     210, 198, 197,
-     208, 197, 116,
-     209, 208, 115,
-     211, 214, 212,
-     213, 134, 214,
-     214, 134, 132,
-     212, 214, 215,
-     217, 219, 120,
-     218, 651, 219,
-     219, 651, 220,
-     219, 221, 222,
-     212, 224, 169,
-     212, 216, 223,
-     224, 223, 206,
-     224, 205, 225,
-     222, 221, 226,
-     221, 220, 227,
-     226, 227, 228,
-     121, 226, 229,
-     230, 234, 231,
-     233, 235, 234,
-     235, 296, 236,
-     234, 236, 237,
-     238, 239, 164,
-     159, 240, 239,
-     240, 213, 211,
-     239, 211, 167,
-     241, 245, 242,
-     244, 246, 242,
-     246, 650, 126,
-     243, 242, 126,
-     248, 251, 249,
-     251, 247, 125,
-     249, 125, 122,
-     250, 249, 252,
-     254, 257, 255,
-     237, 236, 257,
-     236, 296, 258,
-     257, 258, 259,
-     209, 261, 260,
-     114, 113, 261,
-     113, 312, 262,
-     261, 262, 263,
-     264, 266, 265,
-     264, 166, 165,
-     165, 149, 148,
-     266, 148, 267,
-     137, 139, 268,
-     139, 109, 188,
-     188, 192, 269,
-     175, 268, 269,
-     252, 270, 162,
-     122, 124, 270,
-     124, 128, 271,
-     270, 271, 163,
-     147, 273, 272,
-     145, 274, 273,
-     274, 244, 245,
-     273, 245, 241,
-     216, 276, 275,
-     276, 296, 235,
-     275, 235, 233,
-     223, 275, 277,
-     248, 265, 278,
-     265, 267, 272,
-     278, 272, 241,
-     251, 278, 243,
-     279, 282, 280,
-     282, 218, 217,
-     280, 217, 118,
-     281, 280, 283,
-     151, 106, 284,
-     106, 104, 229,
-     284, 229, 228,
-     285, 284, 286,
-     287, 289, 196,
-     288, 290, 289,
-     290, 192, 191,
-     289, 191, 190,
-     288, 292, 291,
-     292, 302, 293,
-     291, 293, 176,
-     291, 269, 192,
-     216, 215, 294,
-     215, 132, 295,
-     294, 295, 259,
-     276, 294, 258,
-     186, 185, 297,
-     185, 184, 299,
-     297, 299, 108,
-     298, 297, 150,
-     256, 255, 300,
-     259, 295, 300,
-     300, 295, 132,
-     300, 129, 131,
-     302, 304, 303,
-     304, 279, 281,
-     303, 281, 178,
-     293, 303, 177,
-     232, 306, 305,
-     201, 200, 305,
-     305, 200, 206,
-     305, 277, 233,
-     101, 103, 307,
-     103, 108, 299,
-     307, 299, 184,
-     308, 307, 309,
-     263, 262, 310,
-     312, 141, 310,
-     310, 141, 313,
-     311, 310, 182,
-     250, 314, 264,
-     253, 161, 314,
-     161, 159, 238,
-     264, 314, 238,
-     315, 316, 204,
-     144, 143, 316,
-     143, 149, 170,
-     316, 170, 225,
-     101, 308, 317,
-     308, 171, 173,
-     317, 173, 178,
-     119, 317, 283,
-     135, 319, 318,
-     213, 240, 319,
-     240, 159, 156,
-     319, 156, 158,
-     171, 309, 320,
-     309, 184, 183,
-     320, 183, 313,
-     174, 320, 140,
-     321, 328, 322,
-     322, 326, 324,
-     322, 373, 325,
-     327, 373, 322,
-     329, 335, 330,
-     331, 330, 332,
-     330, 336, 334,
-     335, 409, 336,
-     321, 323, 337,
-     337, 341, 339,
-     337, 449, 340,
-     324, 449, 337,
-     342, 349, 343,
-     343, 347, 345,
-     346, 652, 347,
-     348, 346, 343,
-     350, 353, 351,
-     353, 356, 354,
-     355, 434, 356,
-     357, 355, 353,
-     358, 363, 359,
-     360, 359, 361,
-     331, 333, 361,
-     363, 329, 331,
-     364, 367, 365,
-     367, 370, 368,
-     369, 486, 370,
-     371, 369, 367,
-     372, 374, 373,
-     374, 376, 325,
-     374, 653, 375,
-     377, 653, 374,
-     378, 381, 379,
-     381, 384, 382,
-     383, 489, 384,
-     385, 383, 381,
-     386, 389, 387,
-     389, 392, 390,
-     391, 444, 392,
-     371, 391, 389,
-     393, 398, 394,
-     395, 394, 396,
-     394, 399, 397,
-     398, 526, 399,
-     400, 405, 401,
-     402, 401, 403,
-     401, 406, 404,
-     405, 518, 406,
-     329, 411, 407,
-     335, 407, 408,
-     407, 412, 410,
-     411, 515, 412,
-     413, 416, 414,
-     414, 408, 410,
-     414, 417, 409,
-     416, 429, 417,
-     418, 421, 419,
-     421, 424, 422,
-     423, 444, 424,
-     425, 423, 421,
-     426, 430, 427,
-     428, 427, 417,
-     427, 336, 409,
-     334, 336, 427,
-     431, 433, 432,
-     433, 356, 434,
-     433, 435, 354,
-     431, 442, 435,
-     341, 437, 436,
-     437, 440, 438,
-     437, 446, 439,
-     340, 446, 437,
-     392, 443, 431,
-     431, 443, 441,
-     443, 423, 425,
-     444, 423, 443,
-     340, 449, 445,
-     446, 445, 447,
-     445, 450, 448,
-     449, 324, 450,
-     451, 454, 452,
-     454, 457, 455,
-     456, 497, 457,
-     458, 456, 454,
-     387, 460, 459,
-     460, 461, 382,
-     432, 434, 461,
-     390, 432, 460,
-     462, 467, 463,
-     463, 466, 465,
-     347, 652, 466,
-     345, 347, 463,
-     468, 471, 469,
-     470, 469, 344,
-     469, 472, 342,
-     471, 489, 472,
-     473, 476, 474,
-     476, 456, 458,
-     477, 497, 456,
-     478, 477, 476,
-     479, 480, 430,
-     480, 332, 334,
-     481, 333, 332,
-     482, 481, 480,
-     483, 485, 484,
-     485, 386, 388,
-     369, 371, 386,
-     486, 369, 485,
-     358, 396, 487,
-     363, 487, 411,
-     488, 515, 411,
-     396, 397, 488,
-     383, 490, 472,
-     490, 349, 342,
-     491, 348, 349,
-     385, 491, 490,
-     492, 493, 370,
-     493, 494, 368,
-     464, 465, 494,
-     462, 464, 493,
-     442, 441, 495,
-     496, 495, 457,
-     495, 498, 455,
-     441, 425, 498,
-     468, 470, 499,
-     483, 499, 492,
-     499, 467, 462,
-     470, 345, 467,
-     500, 503, 501,
-     502, 501, 436,
-     501, 504, 339,
-     503, 526, 504,
-     325, 376, 505,
-     326, 505, 450,
-     505, 506, 448,
-     376, 375, 506,
-     415, 508, 507,
-     508, 510, 509,
-     412, 515, 510,
-     410, 412, 508,
-     509, 510, 511,
-     512, 511, 513,
-     511, 488, 397,
-     515, 488, 511,
-     442, 496, 516,
-     435, 516, 517,
-     516, 477, 478,
-     496, 497, 477,
-     518, 521, 519,
-     406, 519, 520,
-     519, 372, 327,
-     521, 377, 372,
-     475, 523, 522,
-     522, 517, 478,
-     522, 351, 354,
-     523, 352, 351,
-     514, 513, 524,
-     525, 524, 503,
-     524, 399, 526,
-     513, 397, 399,
-     453, 452, 527,
-     528, 527, 418,
-     527, 498, 425,
-     455, 498, 527,
-     321, 530, 529,
-     328, 529, 520,
-     529, 531, 404,
-     530, 393, 531,
-     482, 533, 532,
-     532, 361, 333,
-     532, 402, 362,
-     533, 400, 402,
-     484, 534, 471,
-     534, 384, 489,
-     459, 382, 384,
-     388, 459, 534,
-     424, 536, 535,
-     536, 364, 366,
-     391, 371, 364,
-     444, 391, 536,
-     321, 338, 537,
-     530, 537, 398,
-     537, 504, 526,
-     338, 339, 504,
-     538, 539, 355,
-     539, 461, 434,
-     379, 382, 461,
-     380, 379, 539,
-     393, 395, 540,
-     531, 540, 403,
-     540, 360, 362,
-     395, 358, 360,
-     541, 545, 542,
-     544, 577, 542,
-     542, 577, 546,
-     542, 547, 548,
-     547, 551, 549,
-     547, 546, 550,
-     550, 556, 552,
-     549, 551, 552,
-     553, 552, 554,
-     556, 572, 554,
-     554, 572, 557,
-     554, 558, 559,
-     558, 562, 560,
-     558, 557, 561,
-     561, 654, 563,
-     560, 562, 563,
-     565, 568, 566,
-     553, 555, 566,
-     566, 555, 559,
-     566, 569, 570,
-     556, 574, 571,
-     573, 578, 571,
-     571, 578, 575,
-     571, 576, 557,
-     541, 543, 542,
-     542, 577, 544,
-     542, 547, 546,
-     548, 547, 542,
-     549, 551, 547,
-     547, 551, 550,
-     552, 556, 550,
-     549, 553, 552,
-     553, 555, 554,
-     554, 572, 556,
-     554, 558, 557,
-     559, 558, 554,
-     560, 562, 558,
-     558, 562, 561,
-     563, 654, 561,
-     560, 564, 563,
-     565, 567, 566,
-     566, 555, 553,
-     566, 569, 559,
-     570, 569, 566,
-     556, 572, 571,
-     571, 578, 573,
-     571, 576, 575,
-     557, 576, 571,
-     579, 586, 580,
-     580, 584, 582,
-     580, 588, 583,
-     585, 588, 580,
-     587, 589, 588,
-     589, 591, 583,
-     589, 592, 590,
-     587, 593, 592,
-     593, 598, 594,
-     594, 596, 590,
-     594, 600, 595,
-     597, 600, 594,
-     599, 603, 600,
-     600, 603, 601,
-     602, 655, 601,
-     599, 656, 602,
-     604, 608, 605,
-     605, 598, 593,
-     605, 657, 597,
-     607, 657, 605,
-     590, 596, 609,
-     609, 613, 611,
-     609, 658, 612,
-     595, 658, 609,
-     614, 618, 615,
-     617, 659, 615,
-     615, 659, 619,
-     615, 620, 621,
-     620, 623, 622,
-     619, 660, 623,
-     623, 660, 624,
-     622, 623, 625,
-     626, 625, 627,
-     624, 644, 627,
-     627, 644, 629,
-     627, 630, 631,
-     630, 634, 632,
-     630, 629, 633,
-     633, 661, 635,
-     632, 634, 635,
-     637, 640, 638,
-     626, 628, 638,
-     638, 628, 631,
-     638, 641, 642,
-     624, 646, 643,
-     645, 662, 643,
-     643, 662, 647,
-     643, 648, 629,
-};
-static const unsigned int normal_indices[3456] = {
-      22,   2,  10,
-      21,   1,  24,
-       7,  23,  14,
-       2,  29,   8,
-       0,  21,  24,
-       1,  23,  18,
-       3,  23,  11,
-       2,  19,  10,
-      19,   7,  12,
-       6,  19,  12,
-      22,   0,   9,
-      20,   5,  15,
-      13,  15,   4,
-       7,  20,  12,
-       5,  23,  17,
-      29,   1,  18,
-      22,   4,  16,
-       6,  22,  10,
-      19,   3,  11,
-      24,   9,   0,
-       4,  21,  16,
-       5,  21,  15,
-      29,   3,   8,
-       6,  20,  13,
-      45,  42,  30,
-      44,  41,  50,
-      34,  31,  28,
-      45,  51,  48,
-      38,  41,  36,
-      44,  43,  37,
-      31,  49,  46,
-      45,  39,  47,
-      39,  28,  31,
-      27,  39,  30,
-      42,  38,  36,
-      40,  26,  34,
-      25,  40,  33,
-      40,  28,  32,
-      26,  43,  34,
-      51,  44,  50,
-      42,  25,  33,
-      42,  27,  30,
-      39,  46,  47,
-      38,  51,  50,
-      25,  41,  35,
-      41,  26,  35,
-      46,  51,  47,
-      27,  40,  32,
-      60,  61,  72,
-      61,  62,  72,
-      59,  77,  68,
-      62,  63,  72,
-      60,  63,  54,
-     102,  84,  90,
-      54,  76,  60,
-     103,  79,  88,
-      73,  59,  66,
-     102,  78,  96,
-      58,  73,  66,
-     101,  78,  87,
-      54,  73,  64,
-      68,  69,  74,
-      67,  69,  56,
-      66,  68,  74,
-      57,  77,  71,
-      99,  80,  90,
-      76,  56,  70,
-      58,  76,  64,
-     102,  82,  93,
-     101,  79,  97,
-      86,  87,  78,
-      99,  81,  89,
-      87,  88,  79,
-     101,  83,  95,
-      88,  89,  81,
-     103,  81,  91,
-      86,  89,  98,
-     102,  80,  86,
-      85,  99,  92,
-     103,  85,  94,
-      99,  84,  92,
-      55,  73,  63,
-      94,  95,  83,
-     103,  83,  97,
-      93,  95, 100,
-      94,  92, 100,
-      53,  75,  71,
-     101,  82,  96,
-      93,  92,  84,
-      52,  76,  70,
-      75,  52,  70,
-      55,  77,  65,
-      56,  75,  70,
-      57,  75,  69,
-      77,  53,  71,
-      66,  67,  58,
-     116, 250, 237,
-     119, 250, 158,
-     238, 167, 250,
-     250, 111, 237,
-     128, 251, 177,
-     243, 171, 251,
-     251, 110, 242,
-     177, 242, 117,
-     116, 252, 158,
-     109, 252, 156,
-     155, 157, 252,
-     252, 119, 158,
-     114, 253, 223,
-     198, 226, 253,
-     226, 172, 253,
-     253, 123, 223,
-     209, 185, 134,
-     135, 254, 209,
-     192, 208, 254,
-     254, 133, 185,
-     129, 255, 178,
-     244, 169, 255,
-     169, 243, 255,
-     178, 243, 128,
-     230, 233, 152,
-     131, 256, 230,
-     235, 219, 256,
-     256, 153, 233,
-     167, 160, 111,
-     113, 257, 167,
-     257, 139, 225,
-     257, 131, 160,
-     221, 214, 145,
-     146, 258, 221,
-     201, 224, 258,
-     258, 121, 214,
-     213, 248, 142,
-     138, 259, 213,
-     240, 231, 259,
-     259, 153, 248,
-     141, 260, 220,
-     212, 187, 260,
-     260, 127, 211,
-     220, 211, 140,
-     147, 261, 182,
-     205, 229, 261,
-     261, 151, 232,
-     182, 232, 152,
-     128, 262, 188,
-     177, 154, 262,
-     262, 108, 174,
-     188, 174, 126,
-     122, 263, 168,
-     164, 154, 263,
-     263, 117, 166,
-     168, 166, 125,
-     189, 228, 148,
-     147, 264, 189,
-     227, 203, 264,
-     264, 149, 228,
-     132, 265, 207,
-     239, 166, 265,
-     265, 117, 242,
-     207, 242, 110,
-     180, 186, 138,
-     136, 266, 180,
-     266, 135, 202,
-     186, 202, 137,
-     159, 155, 109,
-     121, 267, 159,
-     267, 123, 161,
-     267, 112, 155,
-     186, 240, 138,
-     186, 247, 268,
-     268, 149, 203,
-     268, 150, 240,
-     112, 269, 157,
-     161, 172, 269,
-     269, 124, 162,
-     157, 162, 119,
-     183, 239, 132,
-     106, 270, 183,
-     245, 204, 270,
-     270, 125, 239,
-     218, 213, 142,
-     146, 271, 218,
-     215, 180, 271,
-     271, 138, 213,
-     115, 272, 246,
-     139, 272, 234,
-     236, 226, 272,
-     246, 226, 130,
-     118, 273, 200,
-     197, 198, 273,
-     273, 114, 196,
-     200, 196, 105,
-     168, 206, 122,
-     125, 274, 168,
-     204, 199, 274,
-     274, 104, 206,
-     207, 222, 132,
-     110, 275, 207,
-     171, 165, 275,
-     275, 148, 222,
-     181, 241, 118,
-     181, 248, 276,
-     248, 219, 276,
-     276, 107, 241,
-     129, 277, 187,
-     178, 188, 277,
-     188, 175, 277,
-     187, 175, 127,
-     196, 224, 105,
-     114, 278, 196,
-     223, 170, 278,
-     278, 121, 224,
-     235, 210, 107,
-     131, 279, 235,
-     225, 234, 279,
-     279, 115, 210,
-     137, 280, 247,
-     193, 245, 280,
-     280, 106, 217,
-     247, 217, 149,
-     118, 281, 197,
-     241, 210, 281,
-     281, 115, 246,
-     197, 246, 130,
-     145, 282, 216,
-     214, 159, 282,
-     282, 109, 176,
-     216, 176, 140,
-     113, 283, 195,
-     238, 162, 283,
-     283, 124, 236,
-     195, 236, 139,
-     173, 164, 122,
-     134, 284, 173,
-     190, 174, 284,
-     284, 108, 164,
-     134, 285, 190,
-     185, 191, 285,
-     285, 127, 175,
-     285, 126, 190,
-     137, 286, 193,
-     202, 194, 286,
-     286, 104, 199,
-     193, 199, 120,
-     152, 287, 230,
-     232, 163, 287,
-     287, 111, 160,
-     230, 160, 131,
-     122, 288, 173,
-     104, 288, 206,
-     288, 135, 209,
-     288, 134, 173,
-     133, 289, 191,
-     184, 216, 289,
-     289, 140, 211,
-     191, 211, 127,
-     132, 290, 183,
-     148, 290, 222,
-     290, 149, 217,
-     290, 106, 183,
-     116, 291, 179,
-     237, 163, 291,
-     291, 151, 249,
-     179, 249, 141,
-     148, 292, 189,
-     143, 292, 165,
-     292, 144, 205,
-     189, 205, 147,
-     200, 181, 118,
-     105, 293, 200,
-     201, 218, 293,
-     181, 218, 142,
-     182, 227, 147,
-     152, 294, 182,
-     233, 231, 294,
-     294, 150, 227,
-     116, 295, 156,
-     179, 220, 295,
-     295, 140, 176,
-     156, 176, 109,
-     208, 184, 133,
-     136, 296, 208,
-     215, 221, 296,
-     296, 145, 184,
-     141, 297, 212,
-     249, 229, 297,
-     297, 144, 244,
-     212, 244, 129,
-     310, 444, 352,
-     444, 313, 352,
-     444, 307, 432,
-     305, 444, 431,
-     322, 445, 437,
-     437, 365, 337,
-     445, 304, 365,
-     371, 436, 445,
-     310, 446, 350,
-     446, 303, 350,
-     446, 306, 349,
-     313, 446, 352,
-     308, 447, 392,
-     447, 324, 392,
-     366, 420, 447,
-     317, 447, 417,
-     379, 403, 328,
-     448, 329, 403,
-     402, 386, 448,
-     327, 448, 379,
-     323, 449, 438,
-     438, 363, 338,
-     437, 363, 449,
-     372, 437, 449,
-     427, 424, 346,
-     450, 325, 424,
-     413, 429, 450,
-     347, 450, 427,
-     354, 361, 305,
-     451, 307, 361,
-     451, 333, 389,
-     325, 451, 354,
-     408, 415, 339,
-     452, 340, 415,
-     418, 395, 452,
-     315, 452, 408,
-     442, 407, 336,
-     453, 332, 407,
-     425, 434, 453,
-     347, 453, 442,
-     335, 454, 406,
-     406, 381, 323,
-     454, 321, 381,
-     414, 405, 454,
-     341, 455, 399,
-     399, 423, 338,
-     455, 345, 423,
-     376, 426, 455,
-     322, 456, 371,
-     371, 348, 311,
-     456, 302, 348,
-     382, 368, 456,
-     316, 457, 358,
-     457, 302, 358,
-     457, 311, 348,
-     362, 360, 457,
-     422, 383, 342,
-     458, 341, 383,
-     397, 421, 458,
-     343, 458, 422,
-     326, 459, 433,
-     433, 360, 319,
-     459, 311, 360,
-     304, 459, 401,
-     380, 374, 332,
-     460, 330, 374,
-     460, 329, 386,
-     380, 396, 460,
-     349, 353, 303,
-     461, 315, 353,
-     461, 317, 364,
-     306, 461, 349,
-     434, 380, 332,
-     380, 441, 331,
-     462, 343, 441,
-     344, 462, 434,
-     306, 463, 355,
-     355, 366, 317,
-     463, 318, 366,
-     351, 356, 463,
-     433, 377, 326,
-     464, 300, 377,
-     398, 439, 464,
-     319, 464, 433,
-     407, 412, 336,
-     465, 340, 412,
-     374, 409, 465,
-     332, 465, 407,
-     309, 466, 428,
-     466, 333, 428,
-     420, 430, 466,
-     324, 466, 440,
-     312, 467, 391,
-     391, 392, 324,
-     467, 308, 392,
-     394, 390, 467,
-     400, 362, 316,
-     468, 319, 362,
-     393, 398, 468,
-     298, 468, 400,
-     416, 401, 326,
-     469, 304, 401,
-     359, 365, 469,
-     342, 469, 416,
-     435, 375, 312,
-     470, 336, 375,
-     413, 442, 470,
-     301, 470, 435,
-     323, 471, 372,
-     372, 382, 322,
-     369, 382, 471,
-     381, 369, 471,
-     418, 390, 299,
-     472, 308, 390,
-     364, 417, 472,
-     315, 472, 418,
-     404, 429, 301,
-     473, 325, 429,
-     428, 419, 473,
-     309, 473, 404,
-     331, 474, 387,
-     387, 439, 314,
-     474, 300, 439,
-     441, 411, 474,
-     312, 475, 435,
-     435, 404, 301,
-     475, 309, 404,
-     391, 440, 475,
-     339, 476, 408,
-     408, 353, 315,
-     476, 303, 353,
-     410, 370, 476,
-     307, 477, 432,
-     432, 356, 313,
-     477, 318, 356,
-     389, 430, 477,
-     358, 367, 316,
-     478, 328, 367,
-     368, 384, 478,
-     302, 478, 358,
-     328, 479, 379,
-     379, 385, 327,
-     479, 321, 385,
-     320, 479, 384,
-     331, 480, 396,
-     396, 388, 329,
-     480, 298, 388,
-     387, 393, 480,
-     346, 481, 426,
-     426, 357, 345,
-     481, 305, 357,
-     424, 354, 481,
-     316, 482, 400,
-     482, 298, 400,
-     482, 329, 388,
-     367, 403, 482,
-     327, 483, 378,
-     378, 410, 339,
-     483, 334, 410,
-     385, 405, 483,
-     326, 484, 416,
-     416, 422, 342,
-     484, 343, 422,
-     300, 484, 377,
-     310, 485, 431,
-     431, 357, 305,
-     485, 345, 357,
-     373, 443, 485,
-     342, 486, 359,
-     486, 337, 359,
-     486, 338, 363,
-     383, 399, 486,
-     375, 394, 312,
-     487, 299, 394,
-     412, 395, 487,
-     336, 487, 375,
-     421, 376, 341,
-     488, 346, 376,
-     425, 427, 488,
-     344, 488, 421,
-     310, 489, 373,
-     373, 414, 335,
-     489, 334, 414,
-     350, 370, 489,
-     378, 402, 327,
-     490, 330, 402,
-     415, 409, 490,
-     339, 490, 378,
-     335, 491, 443,
-     443, 423, 345,
-     491, 338, 423,
-     406, 438, 491,
-     492, 512, 500,
-     493, 512, 501,
-     512, 495, 503,
-     512, 494, 500,
-     503, 504, 494,
-     503, 505, 513,
-     505, 506, 513,
-     504, 506, 498,
-     498, 514, 507,
-     499, 514, 506,
-     514, 497, 509,
-     514, 496, 507,
-     509, 510, 496,
-     509, 511, 515,
-     511, 501, 515,
-     510, 501, 492,
-     494, 516, 500,
-     498, 516, 504,
-     516, 496, 510,
-     516, 492, 500,
-     499, 517, 508,
-     495, 517, 505,
-     517, 493, 511,
-     517, 497, 508,
-     518, 538, 527,
-     538, 519, 527,
-     538, 521, 528,
-     520, 538, 526,
-     530, 529, 520,
-     529, 531, 521,
-     532, 531, 539,
-     530, 532, 539,
-     524, 540, 532,
-     540, 525, 532,
-     540, 523, 534,
-     522, 540, 533,
-     536, 535, 522,
-     535, 537, 523,
-     527, 537, 541,
-     536, 527, 541,
-     520, 516, 530,
-     516, 524, 530,
-     516, 522, 533,
-     518, 516, 526,
-     525, 542, 531,
-     542, 521, 531,
-     542, 519, 528,
-     523, 542, 534,
-     543, 563, 552,
-     563, 544, 552,
-     563, 546, 553,
-     545, 563, 551,
-     555, 554, 545,
-     564, 546, 554,
-     564, 550, 556,
-     555, 557, 564,
-     549, 565, 557,
-     565, 550, 557,
-     565, 548, 559,
-     547, 565, 558,
-     561, 560, 547,
-     560, 562, 548,
-     552, 562, 566,
-     561, 552, 566,
-     545, 567, 555,
-     567, 549, 555,
-     567, 547, 558,
-     543, 567, 551,
-     550, 568, 556,
-     568, 546, 556,
-     568, 544, 553,
-     548, 568, 559,
-     569, 589, 577,
-     570, 589, 578,
-     589, 572, 580,
-     589, 571, 577,
-     580, 581, 571,
-     572, 590, 580,
-     590, 576, 583,
-     581, 583, 575,
-     575, 591, 584,
-     576, 591, 583,
-     591, 574, 586,
-     591, 573, 584,
-     586, 587, 573,
-     586, 588, 592,
-     588, 578, 592,
-     587, 578, 569,
-     571, 567, 577,
-     575, 567, 581,
-     567, 573, 587,
-     567, 569, 577,
-     576, 593, 585,
-     572, 593, 582,
-     593, 570, 588,
-     593, 574, 585,
-      22,   9,   2,
-      21,  17,   1,
-       7,  11,  23,
-       2,   9,  29,
-       0,  16,  21,
-       1,  17,  23,
-       3,  18,  23,
-       2,   8,  19,
-      19,  11,   7,
-       6,  10,  19,
-      22,  16,   0,
-      20,  14,   5,
-      13,  20,  15,
-       7,  14,  20,
-       5,  14,  23,
-      29,  24,   1,
-      22,  13,   4,
-       6,  13,  22,
-      19,   8,   3,
-      24,  29,   9,
-       4,  15,  21,
-       5,  17,  21,
-      29,  18,   3,
-       6,  12,  20,
-      45,  48,  42,
-      44,  37,  41,
-      34,  43,  31,
-      45,  47,  51,
-      38,  50,  41,
-      44,  49,  43,
-      31,  43,  49,
-      45,  30,  39,
-      39,  32,  28,
-      27,  32,  39,
-      42,  48,  38,
-      40,  35,  26,
-      25,  35,  40,
-      40,  34,  28,
-      26,  37,  43,
-      51,  49,  44,
-      42,  36,  25,
-      42,  33,  27,
-      39,  31,  46,
-      38,  48,  51,
-      25,  36,  41,
-      41,  37,  26,
-      46,  49,  51,
-      27,  33,  40,
-      60,  52,  61,
-      61,  53,  62,
-      59,  65,  77,
-      62,  55,  63,
-      60,  72,  63,
-     102,  93,  84,
-      54,  64,  76,
-     103,  97,  79,
-      73,  65,  59,
-     102,  86,  78,
-      58,  64,  73,
-     101,  96,  78,
-      54,  63,  73,
-      68,  57,  69,
-      67,  74,  69,
-      66,  59,  68,
-      57,  68,  77,
-      99,  89,  80,
-      76,  67,  56,
-      58,  67,  76,
-     102,  96,  82,
-     101,  87,  79,
-      86,  98,  87,
-      99,  91,  81,
-      87,  98,  88,
-     101,  97,  83,
-      88,  98,  89,
-     103,  88,  81,
-      86,  80,  89,
-     102,  90,  80,
-      85,  91,  99,
-     103,  91,  85,
-      99,  90,  84,
-      55,  65,  73,
-      94, 100,  95,
-     103,  94,  83,
-      93,  82,  95,
-      94,  85,  92,
-      53,  61,  75,
-     101,  95,  82,
-      93, 100,  92,
-      52,  60,  76,
-      75,  61,  52,
-      55,  62,  77,
-      56,  69,  75,
-      57,  71,  75,
-      77,  62,  53,
-      66,  74,  67,
-     116, 158, 250,
-     119, 238, 250,
-     238, 113, 167,
-     250, 167, 111,
-     128, 243, 251,
-     243, 143, 171,
-     251, 171, 110,
-     177, 251, 242,
-     116, 156, 252,
-     109, 155, 252,
-     155, 112, 157,
-     252, 157, 119,
-     114, 198, 253,
-     198, 130, 226,
-     226, 124, 172,
-     253, 172, 123,
-     209, 254, 185,
-     135, 192, 254,
-     192, 136, 208,
-     254, 208, 133,
-     129, 244, 255,
-     244, 144, 169,
-     169, 143, 243,
-     178, 255, 243,
-     230, 256, 233,
-     131, 235, 256,
-     235, 107, 219,
-     256, 219, 153,
-     167, 257, 160,
-     113, 195, 257,
-     257, 195, 139,
-     257, 225, 131,
-     221, 258, 214,
-     146, 201, 258,
-     201, 105, 224,
-     258, 224, 121,
-     213, 259, 248,
-     138, 240, 259,
-     240, 150, 231,
-     259, 231, 153,
-     141, 212, 260,
-     212, 129, 187,
-     260, 187, 127,
-     220, 260, 211,
-     147, 205, 261,
-     205, 144, 229,
-     261, 229, 151,
-     182, 261, 232,
-     128, 177, 262,
-     177, 117, 154,
-     262, 154, 108,
-     188, 262, 174,
-     122, 164, 263,
-     164, 108, 154,
-     263, 154, 117,
-     168, 263, 166,
-     189, 264, 228,
-     147, 227, 264,
-     227, 150, 203,
-     264, 203, 149,
-     132, 239, 265,
-     239, 125, 166,
-     265, 166, 117,
-     207, 265, 242,
-     180, 266, 186,
-     136, 192, 266,
-     266, 192, 135,
-     186, 266, 202,
-     159, 267, 155,
-     121, 170, 267,
-     267, 170, 123,
-     267, 161, 112,
-     186, 268, 240,
-     186, 137, 247,
-     268, 247, 149,
-     268, 203, 150,
-     112, 161, 269,
-     161, 123, 172,
-     269, 172, 124,
-     157, 269, 162,
-     183, 270, 239,
-     106, 245, 270,
-     245, 120, 204,
-     270, 204, 125,
-     218, 271, 213,
-     146, 215, 271,
-     215, 136, 180,
-     271, 180, 138,
-     115, 234, 272,
-     139, 236, 272,
-     236, 124, 226,
-     246, 272, 226,
-     118, 197, 273,
-     197, 130, 198,
-     273, 198, 114,
-     200, 273, 196,
-     168, 274, 206,
-     125, 204, 274,
-     204, 120, 199,
-     274, 199, 104,
-     207, 275, 222,
-     110, 171, 275,
-     171, 143, 165,
-     275, 165, 148,
-     181, 276, 241,
-     181, 142, 248,
-     248, 153, 219,
-     276, 219, 107,
-     129, 178, 277,
-     178, 128, 188,
-     188, 126, 175,
-     187, 277, 175,
-     196, 278, 224,
-     114, 223, 278,
-     223, 123, 170,
-     278, 170, 121,
-     235, 279, 210,
-     131, 225, 279,
-     225, 139, 234,
-     279, 234, 115,
-     137, 193, 280,
-     193, 120, 245,
-     280, 245, 106,
-     247, 280, 217,
-     118, 241, 281,
-     241, 107, 210,
-     281, 210, 115,
-     197, 281, 246,
-     145, 214, 282,
-     214, 121, 159,
-     282, 159, 109,
-     216, 282, 176,
-     113, 238, 283,
-     238, 119, 162,
-     283, 162, 124,
-     195, 283, 236,
-     173, 284, 164,
-     134, 190, 284,
-     190, 126, 174,
-     284, 174, 108,
-     134, 185, 285,
-     185, 133, 191,
-     285, 191, 127,
-     285, 175, 126,
-     137, 202, 286,
-     202, 135, 194,
-     286, 194, 104,
-     193, 286, 199,
-     152, 232, 287,
-     232, 151, 163,
-     287, 163, 111,
-     230, 287, 160,
-     122, 206, 288,
-     104, 194, 288,
-     288, 194, 135,
-     288, 209, 134,
-     133, 184, 289,
-     184, 145, 216,
-     289, 216, 140,
-     191, 289, 211,
-     132, 222, 290,
-     148, 228, 290,
-     290, 228, 149,
-     290, 217, 106,
-     116, 237, 291,
-     237, 111, 163,
-     291, 163, 151,
-     179, 291, 249,
-     148, 165, 292,
-     143, 169, 292,
-     292, 169, 144,
-     189, 292, 205,
-     200, 293, 181,
-     105, 201, 293,
-     201, 146, 218,
-     181, 293, 218,
-     182, 294, 227,
-     152, 233, 294,
-     233, 153, 231,
-     294, 231, 150,
-     116, 179, 295,
-     179, 141, 220,
-     295, 220, 140,
-     156, 295, 176,
-     208, 296, 184,
-     136, 215, 296,
-     215, 146, 221,
-     296, 221, 145,
-     141, 249, 297,
-     249, 151, 229,
-     297, 229, 144,
-     212, 297, 244,
-     310, 431, 444,
-     444, 432, 313,
-     444, 361, 307,
-     305, 361, 444,
-     322, 371, 445,
-     437, 445, 365,
-     445, 436, 304,
-     371, 311, 436,
-     310, 352, 446,
-     446, 349, 303,
-     446, 351, 306,
-     313, 351, 446,
-     308, 417, 447,
-     447, 420, 324,
-     366, 318, 420,
-     317, 366, 447,
-     379, 448, 403,
-     448, 386, 329,
-     402, 330, 386,
-     327, 402, 448,
-     323, 372, 449,
-     438, 449, 363,
-     437, 337, 363,
-     372, 322, 437,
-     427, 450, 424,
-     450, 429, 325,
-     413, 301, 429,
-     347, 413, 450,
-     354, 451, 361,
-     451, 389, 307,
-     451, 419, 333,
-     325, 419, 451,
-     408, 452, 415,
-     452, 395, 340,
-     418, 299, 395,
-     315, 418, 452,
-     442, 453, 407,
-     453, 434, 332,
-     425, 344, 434,
-     347, 425, 453,
-     335, 414, 454,
-     406, 454, 381,
-     454, 405, 321,
-     414, 334, 405,
-     341, 376, 455,
-     399, 455, 423,
-     455, 426, 345,
-     376, 346, 426,
-     322, 382, 456,
-     371, 456, 348,
-     456, 368, 302,
-     382, 320, 368,
-     316, 362, 457,
-     457, 348, 302,
-     457, 360, 311,
-     362, 319, 360,
-     422, 458, 383,
-     458, 421, 341,
-     397, 344, 421,
-     343, 397, 458,
-     326, 401, 459,
-     433, 459, 360,
-     459, 436, 311,
-     304, 436, 459,
-     380, 460, 374,
-     460, 386, 330,
-     460, 396, 329,
-     380, 331, 396,
-     349, 461, 353,
-     461, 364, 315,
-     461, 355, 317,
-     306, 355, 461,
-     434, 462, 380,
-     380, 462, 441,
-     462, 397, 343,
-     344, 397, 462,
-     306, 351, 463,
-     355, 463, 366,
-     463, 356, 318,
-     351, 313, 356,
-     433, 464, 377,
-     464, 439, 300,
-     398, 314, 439,
-     319, 398, 464,
-     407, 465, 412,
-     465, 409, 340,
-     374, 330, 409,
-     332, 374, 465,
-     309, 440, 466,
-     466, 430, 333,
-     420, 318, 430,
-     324, 420, 466,
-     312, 394, 467,
-     391, 467, 392,
-     467, 390, 308,
-     394, 299, 390,
-     400, 468, 362,
-     468, 398, 319,
-     393, 314, 398,
-     298, 393, 468,
-     416, 469, 401,
-     469, 365, 304,
-     359, 337, 365,
-     342, 359, 469,
-     435, 470, 375,
-     470, 442, 336,
-     413, 347, 442,
-     301, 413, 470,
-     323, 381, 471,
-     372, 471, 382,
-     369, 320, 382,
-     381, 321, 369,
-     418, 472, 390,
-     472, 417, 308,
-     364, 317, 417,
-     315, 364, 472,
-     404, 473, 429,
-     473, 419, 325,
-     428, 333, 419,
-     309, 428, 473,
-     331, 441, 474,
-     387, 474, 439,
-     474, 411, 300,
-     441, 343, 411,
-     312, 391, 475,
-     435, 475, 404,
-     475, 440, 309,
-     391, 324, 440,
-     339, 410, 476,
-     408, 476, 353,
-     476, 370, 303,
-     410, 334, 370,
-     307, 389, 477,
-     432, 477, 356,
-     477, 430, 318,
-     389, 333, 430,
-     358, 478, 367,
-     478, 384, 328,
-     368, 320, 384,
-     302, 368, 478,
-     328, 384, 479,
-     379, 479, 385,
-     479, 369, 321,
-     320, 369, 479,
-     331, 387, 480,
-     396, 480, 388,
-     480, 393, 298,
-     387, 314, 393,
-     346, 424, 481,
-     426, 481, 357,
-     481, 354, 305,
-     424, 325, 354,
-     316, 367, 482,
-     482, 388, 298,
-     482, 403, 329,
-     367, 328, 403,
-     327, 385, 483,
-     378, 483, 410,
-     483, 405, 334,
-     385, 321, 405,
-     326, 377, 484,
-     416, 484, 422,
-     484, 411, 343,
-     300, 411, 484,
-     310, 373, 485,
-     431, 485, 357,
-     485, 443, 345,
-     373, 335, 443,
-     342, 383, 486,
-     486, 363, 337,
-     486, 399, 338,
-     383, 341, 399,
-     375, 487, 394,
-     487, 395, 299,
-     412, 340, 395,
-     336, 412, 487,
-     421, 488, 376,
-     488, 427, 346,
-     425, 347, 427,
-     344, 425, 488,
-     310, 350, 489,
-     373, 489, 414,
-     489, 370, 334,
-     350, 303, 370,
-     378, 490, 402,
-     490, 409, 330,
-     415, 340, 409,
-     339, 415, 490,
-     335, 406, 491,
-     443, 491, 423,
-     491, 438, 338,
-     406, 323, 438,
-     492, 501, 512,
-     493, 502, 512,
-     512, 502, 495,
-     512, 503, 494,
-     503, 513, 504,
-     503, 495, 505,
-     505, 499, 506,
-     504, 513, 506,
-     498, 506, 514,
-     499, 508, 514,
-     514, 508, 497,
-     514, 509, 496,
-     509, 515, 510,
-     509, 497, 511,
-     511, 493, 501,
-     510, 515, 501,
-     494, 504, 516,
-     498, 507, 516,
-     516, 507, 496,
-     516, 510, 492,
-     499, 505, 517,
-     495, 502, 517,
-     517, 502, 493,
-     517, 511, 497,
-     518, 526, 538,
-     538, 528, 519,
-     538, 529, 521,
-     520, 529, 538,
-     530, 539, 529,
-     529, 539, 531,
-     532, 525, 531,
-     530, 524, 532,
-     524, 533, 540,
-     540, 534, 525,
-     540, 535, 523,
-     522, 535, 540,
-     536, 541, 535,
-     535, 541, 537,
-     527, 519, 537,
-     536, 518, 527,
-     520, 526, 516,
-     516, 533, 524,
-     516, 536, 522,
-     518, 536, 516,
-     525, 534, 542,
-     542, 528, 521,
-     542, 537, 519,
-     523, 537, 542,
-     543, 551, 563,
-     563, 553, 544,
-     563, 554, 546,
-     545, 554, 563,
-     555, 564, 554,
-     564, 556, 546,
-     564, 557, 550,
-     555, 549, 557,
-     549, 558, 565,
-     565, 559, 550,
-     565, 560, 548,
-     547, 560, 565,
-     561, 566, 560,
-     560, 566, 562,
-     552, 544, 562,
-     561, 543, 552,
-     545, 551, 567,
-     567, 558, 549,
-     567, 561, 547,
-     543, 561, 567,
-     550, 559, 568,
-     568, 553, 546,
-     568, 562, 544,
-     548, 562, 568,
-     569, 578, 589,
-     570, 579, 589,
-     589, 579, 572,
-     589, 580, 571,
-     580, 590, 581,
-     572, 582, 590,
-     590, 582, 576,
-     581, 590, 583,
-     575, 583, 591,
-     576, 585, 591,
-     591, 585, 574,
-     591, 586, 573,
-     586, 592, 587,
-     586, 574, 588,
-     588, 570, 578,
-     587, 592, 578,
-     571, 581, 567,
-     575, 584, 567,
-     567, 584, 573,
-     567, 587, 569,
-     576, 582, 593,
-     572, 579, 593,
-     593, 579, 570,
-     593, 588, 574,
-};
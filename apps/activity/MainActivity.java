@@ -18,8 +18,8 @@ public class MainActivity extends Activity {
 }
 
 class CustomSurfaceView extends SurfaceView implements SurfaceHolder.Callback {
-    private boolean running = false;
-    private Thread renderThread;
+    // present through EGL with YUV to RGB in a shader; false uses the swscale/ANativeWindow_lock path
+    private static final boolean USE_GPU = true;
 
     static {
         System.loadLibrary("engine");
@@ -32,40 +32,20 @@ class CustomSurfaceView extends SurfaceView implements SurfaceHolder.Callback {
 
     @Override
     public void surfaceCreated(SurfaceHolder holder) {
-        init(holder.getSurface());
-        startRendering();
+        start(holder.getSurface(), getWidth(), getHeight(), USE_GPU);
     }
 
     @Override
     public void surfaceDestroyed(SurfaceHolder holder) {
-        stopRendering();
-        deinit();
+        stop();
     }
 
     @Override
-    public void surfaceChanged(SurfaceHolder holder, int format, int width, int height) {}
-
-    private void startRendering() {
-        running = true;
-        renderThread = new Thread(() -> {
-            while (running) {
-                step(getWidth(), getHeight());
-            }
-        });
-        renderThread.start();
-    }
-
-    private void stopRendering() {
-        running = false;
-        if (renderThread != null) {
-            try {
-                renderThread.join();
-            } catch (InterruptedException ignored) {}
-            renderThread = null;
-        }
+    public void surfaceChanged(SurfaceHolder holder, int format, int width, int height) {
+        resize(width, height);
     }
 
-    private native void init(Surface surface);
-    private native void step(int width, int height);
-    private native void deinit();
+    private native void start(Surface surface, int width, int height, boolean gpu);
+    private native void resize(int width, int height);
+    private native void stop();
 }
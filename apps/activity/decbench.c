@@ -0,0 +1,152 @@
+// Host benchmark of decoder_configure() (../common/decoder.h): the first
+// packets of the video stream are read into memory, then decoded with latency
+// budgets of 0, 1 and 2 frames. For each mode it reports the decode rate, how
+// many packets go in before the first frame comes out, and the time from
+// sending a packet to receiving its frame, e.g.
+//
+//     ./decbench                   # the clip engine.c plays
+//     ./decbench movie.mp4 900     # another file or URL, 900 packets
+
+#include <libavformat/avformat.h>
+#include <libavutil/time.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../common/decoder.h"
+
+#define BENCH_URL "http://storage.googleapis.com/gtv-videos-bucket/sample/BigBuckBunny.mp4"
+#define BENCH_PACKETS 600
+
+typedef struct {
+    int threads;
+    const char *mode;
+    int frames;
+    double fps;
+    int delay; // packets sent after the first one before a frame came out
+    double latency_ms;
+    double max_latency_ms;
+} Result;
+
+// Decodes `packets` once. Latencies are matched from frame to packet by pts
+// after the run, so the lookup is not timed.
+static int bench(const AVCodec *decoder, const AVCodecParameters *codecpar, AVPacket **packets, int count, int latency_frames, Result *result) {
+    int64_t *sent = malloc((count + 1) * sizeof(int64_t));
+    int64_t *received = malloc((count + 1) * sizeof(int64_t));
+    int64_t *received_pts = malloc((count + 1) * sizeof(int64_t));
+    AVCodecContext *c = avcodec_alloc_context3(decoder);
+    AVFrame *frame = av_frame_alloc();
+    int ret = AVERROR(ENOMEM);
+    if (!sent || !received || !received_pts || !c || !frame) goto end;
+
+    if ((ret = avcodec_parameters_to_context(c, codecpar)) < 0) goto end;
+    decoder_configure(c, decoder, latency_frames);
+    if ((ret = avcodec_open2(c, decoder, NULL)) < 0) goto end;
+    result->threads = c->thread_count;
+    result->mode = decoder_thread_type_name(c);
+
+    int frames = 0;
+    result->delay = -1;
+    int64_t start = av_gettime_relative();
+    for (int i = 0; i <= count; i++) {
+        // the last round drains the frames the threads still hold
+        sent[i] = av_gettime_relative();
+        if ((ret = avcodec_send_packet(c, i < count ? packets[i] : NULL)) < 0) goto end;
+        while ((ret = avcodec_receive_frame(c, frame)) >= 0) {
+            if (result->delay < 0) result->delay = i;
+            if (frames <= count) {
+                received[frames] = av_gettime_relative();
+                received_pts[frames] = frame->pts;
+                frames++;
+            }
+            av_frame_unref(frame);
+        }
+        if (ret != AVERROR(EAGAIN) && ret != AVERROR_EOF) goto end;
+    }
+    double seconds = (av_gettime_relative() - start) / 1e6;
+    ret = 0;
+
+    int64_t total = 0, max = 0;
+    int matched = 0;
+    for (int f = 0; f < frames; f++) {
+        for (int i = 0; i < count && received_pts[f] != AV_NOPTS_VALUE; i++) {
+            if (packets[i]->pts != received_pts[f]) continue;
+            int64_t latency = received[f] - sent[i];
+            total += latency;
+            if (latency > max) max = latency;
+            matched++;
+            break;
+        }
+    }
+
+    result->frames = frames;
+    result->fps = frames / seconds;
+    result->latency_ms = matched ? total / 1e3 / matched : 0.0;
+    result->max_latency_ms = max / 1e3;
+
+end:
+    av_frame_free(&frame);
+    avcodec_free_context(&c);
+    free(received_pts);
+    free(received);
+    free(sent);
+    return ret;
+}
+
+int main(int argc, char **argv) {
+    const char *url = argc > 1 ? argv[1] : BENCH_URL;
+    int max_packets = argc > 2 ? atoi(argv[2]) : BENCH_PACKETS;
+    if (max_packets < 1) {
+        fprintf(stderr, "usage: %s [file or url] [packets]\n", argv[0]);
+        return 1;
+    }
+
+    int ret;
+    AVFormatContext *format_context = NULL;
+    if ((ret = avformat_open_input(&format_context, url, NULL, NULL)) < 0 || (ret = avformat_find_stream_info(format_context, NULL)) < 0) {
+        fprintf(stderr, "%s: %s\n", url, av_err2str(ret));
+        return 1;
+    }
+    if ((ret = av_find_best_stream(format_context, AVMEDIA_TYPE_VIDEO, -1, -1, NULL, 0)) < 0) {
+        fprintf(stderr, "%s: no video stream\n", url);
+        return 1;
+    }
+    AVStream *stream = format_context->streams[ret];
+    const AVCodec *decoder = avcodec_find_decoder(stream->codecpar->codec_id);
+    if (!decoder) {
+        fprintf(stderr, "no decoder for %s\n", avcodec_get_name(stream->codecpar->codec_id));
+        return 1;
+    }
+
+    // read up front, so the network or the disk is not part of the numbers
+    AVPacket **packets = calloc(max_packets, sizeof(AVPacket *));
+    AVPacket *pkt = av_packet_alloc();
+    int count = 0;
+    while (count < max_packets && av_read_frame(format_context, pkt) >= 0) {
+        if (pkt->stream_index == stream->index) {
+            packets[count] = av_packet_alloc();
+            av_packet_move_ref(packets[count++], pkt);
+        }
+        av_packet_unref(pkt);
+    }
+    av_packet_free(&pkt);
+
+    printf("decoder: %s, %dx%d, %d packets, %d cores\n", decoder->name, stream->codecpar->width, stream->codecpar->height, count, av_cpu_count());
+    printf("%6s %8s %7s %8s %10s %13s %13s\n", "budget", "threads", "mode", "fps", "delay", "latency ms", "max ms");
+
+    int status = 0;
+    for (int budget = 0; budget <= 2; budget++) {
+        Result result = {0};
+        if ((ret = bench(decoder, stream->codecpar, packets, count, budget, &result)) < 0 || result.frames == 0) {
+            fprintf(stderr, "decbench: budget %d: %s\n", budget, ret < 0 ? av_err2str(ret) : "no frames");
+            status = 1;
+            break;
+        }
+        printf("%6d %8d %7s %8.1f %10d %13.2f %13.2f\n", budget, result.threads, result.mode, result.fps, result.delay, result.latency_ms, result.max_latency_ms);
+    }
+
+    for (int i = 0; i < count; i++) av_packet_free(&packets[i]);
+    free(packets);
+    avformat_close_input(&format_context);
+    return status;
+}
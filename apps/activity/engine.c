@@ -13,21 +13,70 @@
 #include <libavutil/time.h>
 #include <libswscale/swscale.h>
 
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "../common/decoder.h"
+#include "http_cache.h"
+
+#define FRAME_QUEUE_SIZE 4
+#define DECODER_LATENCY_FRAMES 2
+
 #define LOG(...) ((void)__android_log_print(ANDROID_LOG_INFO, "ENGINE", __VA_ARGS__))
 #define LOGE(...) ((void)__android_log_print(ANDROID_LOG_ERROR, "ENGINE", __VA_ARGS__))
 
-int ret;
-
-static ANativeWindow *window = NULL;
-static ANativeWindow_Buffer buffer;
-static AVFormatContext *format_context = NULL;
-static AVCodecContext *decoder_context = NULL;
-static AVStream *stream = NULL;
-static AVPacket *pkt = NULL;
-static AVFrame *frame = NULL;
-static AVFrame *tmp_frame = NULL;
-static struct SwsContext *sws_context = NULL;
-static int64_t launch_time;
+typedef struct {
+    AVFrame *frames[FRAME_QUEUE_SIZE];
+    int64_t times[FRAME_QUEUE_SIZE]; // presentation time in microseconds
+    int read;
+    int count;
+    bool eof;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+} FrameQueue;
+
+typedef struct {
+    int64_t presented;
+    int64_t dropped;
+    int64_t late;
+    int64_t max_lateness;
+    int64_t stalls; // underruns after which the clock was re-anchored
+} FrameStats;
+
+#define DECODE_SENT_SIZE 32
+
+// Decode throughput and latency, logged so the threading modes picked by
+// decoder_configure() can be compared on a device. Latency runs from sending a
+// packet to receiving the frame with its pts, so it includes the frames frame
+// threading keeps in flight and any reordering delay.
+typedef struct {
+    int64_t decoded;
+    int64_t decode_time; // us spent in send/receive
+    int64_t latency;     // us summed over `matched` frames
+    int64_t matched;
+    int64_t sent_pts[DECODE_SENT_SIZE];
+    int64_t sent_time[DECODE_SENT_SIZE];
+    int sent_next;
+} DecodeStats;
+
+typedef struct {
+    ANativeWindow *window;
+
+    atomic_bool running;
+    atomic_bool gpu;
+    atomic_int width;
+    atomic_int height;
+    pthread_t thread;
+    pthread_t present_thread;
+
+    FrameQueue queue;
+    FrameStats stats;
+} Engine;
+
+static Engine engine = {0};
 
 void custom_log_callback(void *ptr, int level, const char *fmt, va_list vl) {
     (void)ptr;
@@ -51,134 +100,717 @@ void custom_log_callback(void *ptr, int level, const char *fmt, va_list vl) {
     }
 }
 
-JNIEXPORT void JNICALL Java_com_example_activity_CustomSurfaceView_init(JNIEnv *env, jobject obj, jobject surface) {
-    launch_time = av_gettime_relative();
+static int engine_interrupt(void *arg) {
+    (void)arg;
+    return !atomic_load(&engine.running);
+}
 
-    // av_log_set_callback(custom_log_callback);
+static void frame_queue_init(FrameQueue *q) {
+    memset(q, 0, sizeof(*q));
 
-    window = ANativeWindow_fromSurface(env, surface);
-    if (window == NULL) return;
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&q->cond, &attr);
+    pthread_condattr_destroy(&attr);
+    pthread_mutex_init(&q->mutex, NULL);
 
-    JavaVM *javaVM;
-    (*env)->GetJavaVM(env, &javaVM);
-    av_jni_set_java_vm(javaVM, NULL);
+    for (int i = 0; i < FRAME_QUEUE_SIZE; i++) q->frames[i] = av_frame_alloc();
+}
+
+static void frame_queue_destroy(FrameQueue *q) {
+    for (int i = 0; i < FRAME_QUEUE_SIZE; i++) av_frame_free(&q->frames[i]);
+    pthread_cond_destroy(&q->cond);
+    pthread_mutex_destroy(&q->mutex);
+}
+
+static void frame_queue_wake(FrameQueue *q) {
+    pthread_mutex_lock(&q->mutex);
+    pthread_cond_broadcast(&q->cond);
+    pthread_mutex_unlock(&q->mutex);
+}
+
+// Blocks while the queue is full. Takes ownership of the frame's references.
+static bool frame_queue_push(FrameQueue *q, AVFrame *frame, int64_t time) {
+    pthread_mutex_lock(&q->mutex);
+    while (q->count == FRAME_QUEUE_SIZE && atomic_load(&engine.running)) pthread_cond_wait(&q->cond, &q->mutex);
+    if (!atomic_load(&engine.running)) {
+        pthread_mutex_unlock(&q->mutex);
+        av_frame_unref(frame);
+        return false;
+    }
+
+    int slot = (q->read + q->count) % FRAME_QUEUE_SIZE;
+    av_frame_move_ref(q->frames[slot], frame);
+    q->times[slot] = time;
+    q->count++;
+
+    pthread_cond_broadcast(&q->cond);
+    pthread_mutex_unlock(&q->mutex);
+    return true;
+}
+
+static void frame_queue_finish(FrameQueue *q) {
+    pthread_mutex_lock(&q->mutex);
+    q->eof = true;
+    pthread_cond_broadcast(&q->cond);
+    pthread_mutex_unlock(&q->mutex);
+}
+
+static int64_t monotonic_time(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// Waits on the queue until the absolute monotonic deadline, a wake up, or a stop request.
+static void frame_queue_wait_until(FrameQueue *q, int64_t deadline) {
+    struct timespec ts = {.tv_sec = deadline / 1000000, .tv_nsec = (deadline % 1000000) * 1000};
+    pthread_cond_timedwait(&q->cond, &q->mutex, &ts);
+}
+
+static const char *vertex_shader_source = "#version 300 es\n"
+                                          "layout(location = 0) in vec2 position;\n"
+                                          "layout(location = 1) in vec2 texCoord;\n"
+                                          "out vec2 TexCoord;\n"
+                                          "void main() {\n"
+                                          "    gl_Position = vec4(position, 0.0, 1.0);\n"
+                                          "    TexCoord = texCoord;\n"
+                                          "}\n";
+
+static const char *fragment_shader_source = "#version 300 es\n"
+                                            "precision mediump float;\n"
+                                            "in vec2 TexCoord;\n"
+                                            "out vec4 FragColor;\n"
+                                            "uniform sampler2D textureY;\n"
+                                            "uniform sampler2D textureU;\n"
+                                            "uniform sampler2D textureV;\n"
+                                            "uniform mat3 yuv_matrix;\n"
+                                            "uniform vec3 yuv_offset;\n"
+                                            "void main() {\n"
+                                            "    vec3 yuv = vec3(texture(textureY, TexCoord).r, texture(textureU, TexCoord).r, texture(textureV, TexCoord).r) - yuv_offset;\n"
+                                            "    FragColor = vec4(clamp(yuv_matrix * yuv, 0.0, 1.0), 1.0);\n"
+                                            "}\n";
+
+typedef struct {
+    bool gpu;
+
+    // CPU path: swscale to RGBA and copy into the locked window buffer
+    AVFrame *tmp_frame;
+    struct SwsContext *sws_context;
+    int sws_source[3];
+    int width;
+    int height;
+
+    // GPU path: upload the YUV planes and convert in the fragment shader
+    EGLDisplay egl_display;
+    EGLSurface egl_surface;
+    EGLContext egl_context;
+    GLuint program;
+    GLuint textures[3];
+    GLuint VAO;
+    GLuint VBO;
+    GLint yuv_matrix_location;
+    GLint yuv_offset_location;
+    int texture_width;
+    int texture_height;
+} Presenter;
+
+static GLuint presenter_compile(GLenum type, const char *source) {
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+
+    GLint status;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if (status == GL_FALSE) {
+        char buffer[512];
+        glGetShaderInfoLog(shader, sizeof(buffer), NULL, buffer);
+        LOGE("[ERROR]: shader compilation: %s", buffer);
+    }
+    return shader;
+}
+
+static void presenter_destroy_gpu(Presenter *p) {
+    if (p->egl_display == EGL_NO_DISPLAY) return;
+
+    if (p->egl_context != EGL_NO_CONTEXT) {
+        glDeleteTextures(3, p->textures);
+        glDeleteBuffers(1, &p->VBO);
+        glDeleteVertexArrays(1, &p->VAO);
+        glDeleteProgram(p->program);
+    }
+
+    eglMakeCurrent(p->egl_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (p->egl_surface != EGL_NO_SURFACE) eglDestroySurface(p->egl_display, p->egl_surface);
+    if (p->egl_context != EGL_NO_CONTEXT) eglDestroyContext(p->egl_display, p->egl_context);
+    eglTerminate(p->egl_display);
+
+    p->egl_display = EGL_NO_DISPLAY;
+    p->egl_surface = EGL_NO_SURFACE;
+    p->egl_context = EGL_NO_CONTEXT;
+}
+
+static bool presenter_init_gpu(Presenter *p) {
+    p->egl_display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (p->egl_display == EGL_NO_DISPLAY || !eglInitialize(p->egl_display, NULL, NULL)) {
+        LOGE("[ERROR]: cannot initialize EGL");
+        p->egl_display = EGL_NO_DISPLAY;
+        return false;
+    }
+
+    EGLint attributes[] = {EGL_SURFACE_TYPE, EGL_WINDOW_BIT, EGL_BLUE_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_RED_SIZE, 8, EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT, EGL_NONE};
+    EGLConfig egl_config;
+    EGLint num_configs;
+    if (!eglChooseConfig(p->egl_display, attributes, &egl_config, 1, &num_configs) || num_configs == 0) {
+        LOGE("[ERROR]: cannot choose EGL config");
+        presenter_destroy_gpu(p);
+        return false;
+    }
+
+    EGLint context_attributes[] = {EGL_CONTEXT_CLIENT_VERSION, 3, EGL_NONE};
+    p->egl_context = eglCreateContext(p->egl_display, egl_config, EGL_NO_CONTEXT, context_attributes);
+    p->egl_surface = eglCreateWindowSurface(p->egl_display, egl_config, engine.window, NULL);
+    if (p->egl_context == EGL_NO_CONTEXT || p->egl_surface == EGL_NO_SURFACE || !eglMakeCurrent(p->egl_display, p->egl_surface, p->egl_surface, p->egl_context)) {
+        LOGE("[ERROR]: cannot create EGL surface or context");
+        presenter_destroy_gpu(p);
+        return false;
+    }
+
+    // clang-format off
+    GLfloat vertices[] = {
+        -1.0f, +1.0f, +0.0f, +0.0f,
+        -1.0f, -1.0f, +0.0f, +1.0f,
+        +1.0f, +1.0f, +1.0f, +0.0f,
+        +1.0f, -1.0f, +1.0f, +1.0f,
+    };
+    // clang-format on
+
+    glGenVertexArrays(1, &p->VAO);
+    glBindVertexArray(p->VAO);
+
+    glGenBuffers(1, &p->VBO);
+    glBindBuffer(GL_ARRAY_BUFFER, p->VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(GLfloat), (void *)0);
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(GLfloat), (void *)(2 * sizeof(GLfloat)));
+
+    GLuint vertex_shader = presenter_compile(GL_VERTEX_SHADER, vertex_shader_source);
+    GLuint fragment_shader = presenter_compile(GL_FRAGMENT_SHADER, fragment_shader_source);
+
+    p->program = glCreateProgram();
+    glAttachShader(p->program, vertex_shader);
+    glAttachShader(p->program, fragment_shader);
+    glLinkProgram(p->program);
+    glDeleteShader(vertex_shader);
+    glDeleteShader(fragment_shader);
+
+    GLint status;
+    glGetProgramiv(p->program, GL_LINK_STATUS, &status);
+    if (status == GL_FALSE) {
+        char buffer[512];
+        glGetProgramInfoLog(p->program, sizeof(buffer), NULL, buffer);
+        LOGE("[ERROR]: shader program linking: %s", buffer);
+        presenter_destroy_gpu(p);
+        return false;
+    }
+
+    glUseProgram(p->program);
+    glUniform1i(glGetUniformLocation(p->program, "textureY"), 0);
+    glUniform1i(glGetUniformLocation(p->program, "textureU"), 1);
+    glUniform1i(glGetUniformLocation(p->program, "textureV"), 2);
+    p->yuv_matrix_location = glGetUniformLocation(p->program, "yuv_matrix");
+    p->yuv_offset_location = glGetUniformLocation(p->program, "yuv_offset");
+
+    glGenTextures(3, p->textures);
+    for (int i = 0; i < 3; i++) {
+        glActiveTexture(GL_TEXTURE0 + i);
+        glBindTexture(GL_TEXTURE_2D, p->textures[i]);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    return true;
+}
+
+static void presenter_init(Presenter *p, bool gpu) {
+    memset(p, 0, sizeof(*p));
+    p->egl_display = EGL_NO_DISPLAY;
+    p->egl_surface = EGL_NO_SURFACE;
+    p->egl_context = EGL_NO_CONTEXT;
+    p->tmp_frame = av_frame_alloc();
+
+    p->gpu = gpu && presenter_init_gpu(p);
+    LOG("Presenter: %s", p->gpu ? "EGL (YUV shader)" : "CPU (swscale RGBA)");
+}
+
+static void presenter_destroy(Presenter *p) {
+    presenter_destroy_gpu(p);
+    sws_freeContext(p->sws_context);
+    av_frame_free(&p->tmp_frame);
+}
+
+// Returns the swscale context converting frame to the given destination, (re)creating it when anything changed.
+static struct SwsContext *presenter_sws(Presenter *p, const AVFrame *frame, int width, int height, enum AVPixelFormat format) {
+    int source[3] = {frame->width, frame->height, frame->format};
+    if (p->sws_context && !memcmp(source, p->sws_source, sizeof(source)) && p->tmp_frame->width == width && p->tmp_frame->height == height && p->tmp_frame->format == format) return p->sws_context;
+
+    memcpy(p->sws_source, source, sizeof(source));
+    sws_freeContext(p->sws_context);
+    p->sws_context = sws_getContext(frame->width, frame->height, frame->format, width, height, format, SWS_BILINEAR, NULL, NULL, NULL);
+
+    av_frame_unref(p->tmp_frame);
+    p->tmp_frame->width = width;
+    p->tmp_frame->height = height;
+    p->tmp_frame->format = format;
+    return p->sws_context;
+}
+
+static int presenter_present_cpu(Presenter *p, AVFrame *frame) {
+    int ret;
+
+    int w = atomic_load(&engine.width);
+    int h = atomic_load(&engine.height);
+    if (w <= 0 || h <= 0) return 0;
+    if (w != p->width || h != p->height) {
+        ANativeWindow_setBuffersGeometry(engine.window, w, h, WINDOW_FORMAT_RGBX_8888);
+        p->width = w;
+        p->height = h;
+    }
+
+    struct SwsContext *sws_context = presenter_sws(p, frame, w, h, AV_PIX_FMT_RGBA);
+    if ((ret = sws_scale_frame(sws_context, p->tmp_frame, frame)) < 0) {
+        LOGE("[ERROR]: sws_scale_frame: %s", av_err2str(ret));
+        return ret;
+    }
+
+    ANativeWindow_Buffer buffer;
+    if (ANativeWindow_lock(engine.window, &buffer, NULL) != 0) {
+        LOGE("[ERROR]: Unable to lock the native window buffer");
+        return AVERROR_EXTERNAL;
+    }
+
+    if (buffer.width != w || buffer.height != h) {
+        LOGE("[ERROR]: Buffer dimensions mismatch");
+        ANativeWindow_unlockAndPost(engine.window);
+        return 0;
+    }
+
+    uint8_t *dst = (uint8_t *)buffer.bits;
+    const uint8_t *src = p->tmp_frame->data[0];
+    int frame_line_size = p->tmp_frame->linesize[0];
+
+    for (int y = 0; y < h; y++) {
+        memcpy(dst, src, w * 4);
+        dst += buffer.stride * 4;
+        src += frame_line_size;
+    }
+    ANativeWindow_unlockAndPost(engine.window);
+
+    return 0;
+}
+
+static void presenter_set_colorspace(Presenter *p, const AVFrame *frame) {
+    bool full = frame->color_range == AVCOL_RANGE_JPEG || frame->format == AV_PIX_FMT_YUVJ420P;
+    bool bt709 = frame->colorspace == AVCOL_SPC_BT709 || (frame->colorspace == AVCOL_SPC_UNSPECIFIED && frame->height >= 720);
+
+    // column major: the columns hold the contributions of Y, U and V to RGB
+    float ky = full ? 1.0f : 1.164f;
+    float rv = bt709 ? (full ? 1.5748f : 1.793f) : (full ? 1.402f : 1.596f);
+    float gu = bt709 ? (full ? -0.1873f : -0.213f) : (full ? -0.344f : -0.391f);
+    float gv = bt709 ? (full ? -0.4681f : -0.533f) : (full ? -0.714f : -0.813f);
+    float bu = bt709 ? (full ? 1.8556f : 2.112f) : (full ? 1.772f : 2.018f);
+    GLfloat matrix[9] = {ky, ky, ky, 0.0f, gu, bu, rv, gv, 0.0f};
+
+    glUniformMatrix3fv(p->yuv_matrix_location, 1, GL_FALSE, matrix);
+    glUniform3f(p->yuv_offset_location, full ? 0.0f : 16.0f / 255.0f, 0.5f, 0.5f);
+}
+
+static int presenter_present_gpu(Presenter *p, AVFrame *frame) {
+    int ret;
+
+    // only planar 4:2:0 is uploaded directly, anything else is converted to it first
+    const AVFrame *yuv = frame;
+    if (frame->format != AV_PIX_FMT_YUV420P && frame->format != AV_PIX_FMT_YUVJ420P) {
+        struct SwsContext *sws_context = presenter_sws(p, frame, frame->width, frame->height, AV_PIX_FMT_YUV420P);
+        if ((ret = sws_scale_frame(sws_context, p->tmp_frame, frame)) < 0) {
+            LOGE("[ERROR]: sws_scale_frame: %s", av_err2str(ret));
+            return ret;
+        }
+        av_frame_copy_props(p->tmp_frame, frame);
+        yuv = p->tmp_frame;
+    }
+
+    int w = atomic_load(&engine.width);
+    int h = atomic_load(&engine.height);
+    if (w <= 0 || h <= 0) return 0;
+    glViewport(0, 0, w, h);
+
+    bool resized = yuv->width != p->texture_width || yuv->height != p->texture_height;
+    for (int i = 0; i < 3; i++) {
+        int pw = i ? AV_CEIL_RSHIFT(yuv->width, 1) : yuv->width;
+        int ph = i ? AV_CEIL_RSHIFT(yuv->height, 1) : yuv->height;
+
+        glActiveTexture(GL_TEXTURE0 + i);
+        glBindTexture(GL_TEXTURE_2D, p->textures[i]);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, yuv->linesize[i]);
+        if (resized) {
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, pw, ph, 0, GL_RED, GL_UNSIGNED_BYTE, yuv->data[i]);
+        } else {
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, pw, ph, GL_RED, GL_UNSIGNED_BYTE, yuv->data[i]);
+        }
+    }
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    p->texture_width = yuv->width;
+    p->texture_height = yuv->height;
+
+    presenter_set_colorspace(p, yuv);
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+
+    if (!eglSwapBuffers(p->egl_display, p->egl_surface)) {
+        LOGE("[ERROR]: eglSwapBuffers: 0x%x", eglGetError());
+        return AVERROR_EXTERNAL;
+    }
+
+    return 0;
+}
+
+static int presenter_present(Presenter *p, AVFrame *frame) {
+    return p->gpu ? presenter_present_gpu(p, frame) : presenter_present_cpu(p, frame);
+}
 
-    AVDictionary *options = NULL;
-    av_dict_set(&options, "buffer_size", "32", 0);
-    av_dict_set(&options, "max_delay", "0", 0);
-    if ((ret = avformat_open_input(&format_context, "http://storage.googleapis.com/gtv-videos-bucket/sample/BigBuckBunny.mp4", NULL, &options)) < 0) {
+static void *present_task(void *arg) {
+    (void)arg;
+
+    FrameQueue *q = &engine.queue;
+    FrameStats *stats = &engine.stats;
+
+    AVFrame *frame = av_frame_alloc();
+
+    Presenter presenter;
+    presenter_init(&presenter, atomic_load(&engine.gpu));
+
+    // The clock is anchored on the first frame that reaches the presenter, so the
+    // time spent opening the network stream and probing does not count as lateness.
+    bool anchored = false;
+    int64_t clock_base = 0;
+    int64_t time_base = 0;
+    int64_t report_time = 0;
+
+    // when the queue last ran dry (0 while it holds frames), and the spacing of
+    // the last two frames taken from it
+    int64_t underrun_start = 0;
+    int64_t last_time = INT64_MIN;
+    int64_t frame_interval = 1000000 / 30;
+
+    pthread_mutex_lock(&q->mutex);
+    while (atomic_load(&engine.running)) {
+        if (q->count == 0) {
+            if (q->eof) break;
+            if (anchored && underrun_start == 0) underrun_start = monotonic_time();
+            pthread_cond_wait(&q->cond, &q->mutex);
+            continue;
+        }
+
+        int64_t now = monotonic_time();
+        int64_t time = q->times[q->read];
+        if (!anchored) {
+            anchored = true;
+            clock_base = now;
+            time_base = time;
+            report_time = now;
+        }
+
+        int64_t due = clock_base + (time - time_base);
+
+        // After a stall that starved the queue for more than a frame, playback
+        // resumes from the frame that ended it rather than dropping every late
+        // frame until decode has caught up with the old clock.
+        if (underrun_start && now - underrun_start > frame_interval && due < now) {
+            clock_base = now;
+            time_base = time;
+            due = now;
+            stats->stalls++;
+        }
+        underrun_start = 0;
+        if (due > now) {
+            frame_queue_wait_until(q, due);
+            continue;
+        }
+
+        // A frame is dropped when the one after it is already due, which keeps
+        // the presenter locked to the clock after a decode or network stall.
+        int64_t lateness = now - due;
+        bool drop = false;
+        if (q->count > 1) {
+            int64_t next_time = q->times[(q->read + 1) % FRAME_QUEUE_SIZE];
+            drop = clock_base + (next_time - time_base) <= now;
+        }
+
+        if (last_time != INT64_MIN && time > last_time) frame_interval = time - last_time;
+        last_time = time;
+
+        av_frame_move_ref(frame, q->frames[q->read]);
+        q->read = (q->read + 1) % FRAME_QUEUE_SIZE;
+        q->count--;
+        pthread_cond_broadcast(&q->cond);
+        pthread_mutex_unlock(&q->mutex);
+
+        if (drop) {
+            stats->dropped++;
+        } else {
+            if (lateness > 2000) stats->late++;
+            if (lateness > stats->max_lateness) stats->max_lateness = lateness;
+            stats->presented++;
+            if (presenter_present(&presenter, frame) < 0) {
+                atomic_store(&engine.running, false);
+            }
+        }
+        av_frame_unref(frame);
+
+        if (now - report_time >= 5000000) {
+            LOG("Frames: presented %ld | dropped %ld | late %ld | max lateness %ld us | stalls %ld", stats->presented, stats->dropped, stats->late, stats->max_lateness, stats->stalls);
+            report_time = now;
+        }
+
+        pthread_mutex_lock(&q->mutex);
+    }
+    pthread_cond_broadcast(&q->cond);
+    pthread_mutex_unlock(&q->mutex);
+
+    LOG("Frames: presented %ld | dropped %ld | late %ld | max lateness %ld us | stalls %ld", stats->presented, stats->dropped, stats->late, stats->max_lateness, stats->stalls);
+
+    presenter_destroy(&presenter);
+    av_frame_free(&frame);
+
+    return NULL;
+}
+
+static void decode_stats_sent(DecodeStats *stats, const AVPacket *pkt, int64_t now) {
+    if (!pkt || pkt->pts == AV_NOPTS_VALUE) return;
+    stats->sent_pts[stats->sent_next] = pkt->pts;
+    stats->sent_time[stats->sent_next] = now;
+    stats->sent_next = (stats->sent_next + 1) % DECODE_SENT_SIZE;
+}
+
+static void decode_stats_received(DecodeStats *stats, const AVFrame *frame, int64_t now) {
+    stats->decoded++;
+    for (int i = 0; i < DECODE_SENT_SIZE && frame->pts != AV_NOPTS_VALUE; i++) {
+        if (stats->sent_time[i] && stats->sent_pts[i] == frame->pts) {
+            stats->latency += now - stats->sent_time[i];
+            stats->matched++;
+            stats->sent_time[i] = 0;
+            break;
+        }
+    }
+
+    if (stats->decoded % 300 == 0 && stats->decode_time > 0) {
+        LOG("Decoder: %ld frames | %.1f fps | latency %.1f ms", stats->decoded, stats->decoded * 1e6 / stats->decode_time, stats->matched ? stats->latency / 1e3 / stats->matched : 0.0);
+    }
+}
+
+// Sends `pkt` to the decoder, or NULL to drain it at the end of the stream, and
+// queues every frame it returns. Returns 0 when the decoder wants more input,
+// AVERROR_EOF once it is drained, and a negative error otherwise.
+static int engine_decode(AVCodecContext *decoder_context, AVStream *stream, AVPacket *pkt, AVFrame *frame, DecodeStats *stats) {
+    int64_t decode_start = monotonic_time();
+    decode_stats_sent(stats, pkt, decode_start);
+    int ret = avcodec_send_packet(decoder_context, pkt);
+    if (ret < 0 && ret != AVERROR(EAGAIN)) {
+        LOGE("[ERROR]: avcodec_send_packet: %s", av_err2str(ret));
+        return ret;
+    }
+
+    while (atomic_load(&engine.running)) {
+        ret = avcodec_receive_frame(decoder_context, frame);
+        if (ret == AVERROR(EAGAIN)) {
+            ret = 0;
+            break;
+        } else if (ret == AVERROR_EOF) {
+            break;
+        } else if (ret < 0) {
+            LOGE("[ERROR]: avcodec_receive_frame: %s", av_err2str(ret));
+            break;
+        }
+
+        int64_t now = monotonic_time();
+        stats->decode_time += now - decode_start;
+        decode_stats_received(stats, frame, now);
+
+        int64_t ts = frame->best_effort_timestamp != AV_NOPTS_VALUE ? frame->best_effort_timestamp : frame->pts;
+        int64_t time = av_rescale_q(ts, stream->time_base, AV_TIME_BASE_Q);
+        if (!frame_queue_push(&engine.queue, frame, time)) return AVERROR_EXIT;
+        decode_start = monotonic_time();
+    }
+    stats->decode_time += monotonic_time() - decode_start;
+    return ret;
+}
+
+static void *engine_task(void *arg) {
+    (void)arg;
+
+    int ret;
+
+    AVFormatContext *format_context = NULL;
+    HttpCache *cache = NULL;
+    AVCodecContext *decoder_context = NULL;
+    AVStream *stream = NULL;
+    AVPacket *pkt = NULL;
+    AVFrame *frame = NULL;
+    bool presenting = false;
+    DecodeStats decode_stats = {0};
+
+    const char *url = "http://storage.googleapis.com/gtv-videos-bucket/sample/BigBuckBunny.mp4";
+
+    int64_t open_time = monotonic_time();
+    format_context = avformat_alloc_context();
+    format_context->interrupt_callback = (AVIOInterruptCB){.callback = engine_interrupt, .opaque = NULL};
+
+    // the demuxer reads through the read-ahead cache; plain http is the fallback
+    // when the server does not report a size or accept range requests
+    if ((ret = http_cache_open(&cache, &format_context->pb, url, &format_context->interrupt_callback)) < 0) {
+        LOGE("[ERROR]: http_cache_open: %s", av_err2str(ret));
+    }
+
+    if ((ret = avformat_open_input(&format_context, url, NULL, NULL)) < 0) {
         LOGE("[ERROR]: avformat_open_input: %s", av_err2str(ret));
-        return;
+        goto end;
     }
-    format_context->flags |= AVFMT_FLAG_NOBUFFER | AVFMT_FLAG_FLUSH_PACKETS;
 
     if ((ret = avformat_find_stream_info(format_context, NULL)) < 0) {
         LOGE("[ERROR]: avformat_find_stream_info: %s", av_err2str(ret));
-        return;
+        goto end;
     }
+    LOG("Open: %ld ms", (monotonic_time() - open_time) / 1000);
 
-    const AVCodec *decoder = avcodec_find_decoder_by_name("h264");
-    if (!decoder) {
-        LOGE("[ERROR]: decoder not found");
-        return;
-    }
     if ((ret = av_find_best_stream(format_context, AVMEDIA_TYPE_VIDEO, -1, -1, NULL, 0)) < 0) {
         LOGE("[ERROR]: av_find_best_stream: %s", av_err2str(ret));
-        return;
+        goto end;
     }
 
     stream = format_context->streams[ret];
+    const AVCodec *decoder = avcodec_find_decoder(stream->codecpar->codec_id);
+    if (!decoder) {
+        LOGE("[ERROR]: no decoder for %s", avcodec_get_name(stream->codecpar->codec_id));
+        goto end;
+    }
     decoder_context = avcodec_alloc_context3(decoder);
     if ((ret = avcodec_parameters_to_context(decoder_context, stream->codecpar)) < 0) {
         LOGE("[ERROR]: avcodec_parameters_to_context: %s", av_err2str(ret));
-        return;
+        goto end;
     }
 
+    decoder_configure(decoder_context, decoder, DECODER_LATENCY_FRAMES);
     if ((ret = avcodec_open2(decoder_context, decoder, NULL)) < 0) {
         LOGE("[ERROR]: avcodec_open2: %s", av_err2str(ret));
-        return;
+        goto end;
     }
+    LOG("Decoder: %s | threads %d (%s)", decoder->name, decoder_context->thread_count, decoder_thread_type_name(decoder_context));
 
     pkt = av_packet_alloc();
     frame = av_frame_alloc();
-    tmp_frame = av_frame_alloc();
-}
 
-JNIEXPORT void JNICALL Java_com_example_activity_CustomSurfaceView_step(JNIEnv *env, jobject obj, jint width, jint height) {
-    ANativeWindow_setBuffersGeometry(window, width, height, WINDOW_FORMAT_RGBX_8888);
+    memset(&engine.stats, 0, sizeof(engine.stats));
+    if (pthread_create(&engine.present_thread, NULL, present_task, NULL) != 0) {
+        LOGE("[ERROR]: cannot create present thread");
+        goto end;
+    }
+    presenting = true;
 
-    ret = av_read_frame(format_context, pkt);
-    if (ret == AVERROR_EOF || ret == AVERROR(EAGAIN) || pkt->stream_index != stream->index) {
+    while (atomic_load(&engine.running)) {
+        ret = av_read_frame(format_context, pkt);
+        if (ret == AVERROR(EAGAIN)) {
+            av_usleep(1000);
+            continue;
+        }
+        if (ret == AVERROR_EOF) {
+            // the frame threads still hold the last frames of the stream
+            engine_decode(decoder_context, stream, NULL, frame, &decode_stats);
+            break;
+        }
+        if (ret < 0) {
+            LOGE("[ERROR]: av_read_frame: %s", av_err2str(ret));
+            break;
+        }
+        if (pkt->stream_index != stream->index) {
+            av_packet_unref(pkt);
+            continue;
+        }
+
+        ret = engine_decode(decoder_context, stream, pkt, frame, &decode_stats);
         av_packet_unref(pkt);
-        return;
+        if (ret < 0) break;
     }
 
-    ret = avcodec_send_packet(decoder_context, pkt);
-    if (ret == AVERROR_EOF || ret == AVERROR(EAGAIN)) {
-        return;
-    }
+end:
+    frame_queue_finish(&engine.queue);
+    if (presenting) pthread_join(engine.present_thread, NULL);
 
-    while (ret >= 0) {
-        ret = avcodec_receive_frame(decoder_context, frame);
-        if (ret == AVERROR_EOF || ret == AVERROR(EAGAIN)) {
-            break;
-        } else if (ret < 0) {
-            LOGE("[ERROR]: avcodec_receive_frame: %s", av_err2str(ret));
-            return;
-        }
+    av_frame_free(&frame);
+    av_packet_free(&pkt);
+    avcodec_free_context(&decoder_context);
+    avformat_close_input(&format_context);
+    http_cache_close(&cache);
 
-        int64_t pts = (1000 * 1000 * frame->pts * stream->time_base.num) / stream->time_base.den;
-        int64_t rts = av_gettime_relative() - launch_time;
-        if (pts > rts) av_usleep(pts - rts);
-        LOG("Delay: %ld | Frame: %s %p w: %d h: %d ls: %d", pts - rts, av_get_pix_fmt_name(frame->format), frame->data[0], frame->width, frame->height, frame->linesize[0]);
+    return NULL;
+}
 
-        if (!sws_context) {
-            sws_context = sws_getContext(frame->width, frame->height, frame->format, width, height, AV_PIX_FMT_RGBA, SWS_BILINEAR, NULL, NULL, NULL);
-        }
+JNIEXPORT void JNICALL Java_com_example_activity_CustomSurfaceView_start(JNIEnv *env, jobject obj, jobject surface, jint width, jint height, jboolean gpu) {
+    (void)obj;
 
-        if ((ret = sws_scale_frame(sws_context, tmp_frame, frame)) < 0) {
-            LOGE("[ERROR]: sws_scale_frame: %s", av_err2str(ret));
-            return;
-        }
-        if (ANativeWindow_lock(window, &buffer, NULL) != 0) {
-            LOGE("[ERROR]: Unable to lock the native window buffer");
-            return;
-        }
+    // av_log_set_callback(custom_log_callback);
 
-        if (buffer.width != width || buffer.height != height) {
-            LOGE("[ERROR]: Buffer dimensions mismatch");
-            ANativeWindow_unlockAndPost(window);
-            return;
-        }
+    if (engine.window != NULL) return;
 
-        uint8_t *dst = (uint8_t *)buffer.bits;
-        const uint8_t *src = tmp_frame->data[0];
-        int frame_line_size = tmp_frame->linesize[0];
+    engine.window = ANativeWindow_fromSurface(env, surface);
+    if (engine.window == NULL) return;
 
-        for (int y = 0; y < height; y++) {
-            for (int x = 0; x < width; x++) {
-                dst[x * 4 + 0] = src[x * 4 + 0];
-                dst[x * 4 + 1] = src[x * 4 + 1];
-                dst[x * 4 + 2] = src[x * 4 + 2];
-                dst[x * 4 + 3] = src[x * 4 + 3];
-            }
-            dst += buffer.stride * 4;
-            src += frame_line_size;
-        }
-        // LOG("Frame: %s %p w: %d h: %d ls: %d %p w: %d h: %d", av_get_pix_fmt_name(tmp_frame->format), tmp_frame->data[0], tmp_frame->width, tmp_frame->height, tmp_frame->linesize[0], buffer.bits, buffer.width, buffer.height);
-        ANativeWindow_unlockAndPost(window);
+    JavaVM *javaVM;
+    (*env)->GetJavaVM(env, &javaVM);
+    av_jni_set_java_vm(javaVM, NULL);
+
+    atomic_store(&engine.width, width);
+    atomic_store(&engine.height, height);
+    atomic_store(&engine.gpu, gpu);
+    atomic_store(&engine.running, true);
+    frame_queue_init(&engine.queue);
+
+    if (pthread_create(&engine.thread, NULL, engine_task, NULL) != 0) {
+        LOGE("[ERROR]: cannot create engine thread");
+        atomic_store(&engine.running, false);
+        frame_queue_destroy(&engine.queue);
+        ANativeWindow_release(engine.window);
+        engine.window = NULL;
     }
+}
+
+JNIEXPORT void JNICALL Java_com_example_activity_CustomSurfaceView_resize(JNIEnv *env, jobject obj, jint width, jint height) {
+    (void)env;
+    (void)obj;
 
-    av_packet_unref(pkt);
+    atomic_store(&engine.width, width);
+    atomic_store(&engine.height, height);
 }
 
-JNIEXPORT void JNICALL Java_com_example_activity_CustomSurfaceView_deinit(JNIEnv *env, jobject obj) {
-    if (window != NULL) {
-        ANativeWindow_release(window);
-        window = NULL;
+JNIEXPORT void JNICALL Java_com_example_activity_CustomSurfaceView_stop(JNIEnv *env, jobject obj) {
+    (void)env;
+    (void)obj;
+
+    if (engine.window == NULL) return;
+
+    atomic_store(&engine.running, false);
+    frame_queue_wake(&engine.queue);
+    pthread_join(engine.thread, NULL);
+    frame_queue_destroy(&engine.queue);
+
+    if (engine.window != NULL) {
+        ANativeWindow_release(engine.window);
+        engine.window = NULL;
     }
-    if (decoder_context != NULL) avcodec_free_context(&decoder_context);
-    if (format_context != NULL) avformat_close_input(&format_context);
-    if (pkt != NULL) av_packet_free(&pkt);
-    if (frame != NULL) av_frame_free(&frame);
 }
@@ -0,0 +1,718 @@
+#include "http_cache.h"
+
+#include <libavutil/avstring.h>
+#include <libavutil/mem.h>
+#include <libavutil/time.h>
+
+#include <errno.h>
+#include <inttypes.h>
+#include <netdb.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+// the host test builds this file without the NDK
+#ifdef __ANDROID__
+#include <android/log.h>
+#define LOG(...) ((void)__android_log_print(ANDROID_LOG_INFO, "ENGINE", __VA_ARGS__))
+#define LOGE(...) ((void)__android_log_print(ANDROID_LOG_ERROR, "ENGINE", __VA_ARGS__))
+#else
+#define LOG(...) ((void)(fprintf(stderr, __VA_ARGS__), fputc('\n', stderr)))
+#define LOGE(...) LOG(__VA_ARGS__)
+#endif
+
+#define HTTP_CACHE_BLOCK_SIZE (256 * 1024)
+#define HTTP_CACHE_BLOCKS 32
+#define HTTP_CACHE_READ_AHEAD 8
+#define HTTP_CACHE_TAIL_BLOCKS 8
+#define HTTP_CACHE_WORKERS 3
+#define HTTP_CACHE_IO_SIZE (64 * 1024)
+#define HTTP_CACHE_RECV_SIZE (16 * 1024)
+#define HTTP_CACHE_ATTEMPTS 3       // fetches of the block the demuxer waits on before it fails
+#define HTTP_CACHE_REDIRECTS 4
+#define HTTP_CACHE_TIMEOUT 10000000 // us without progress before a request fails
+#define HTTP_CACHE_POLL 50          // ms between interrupt checks while blocked on a socket
+
+typedef enum {
+    BLOCK_EMPTY,
+    BLOCK_PENDING,
+    BLOCK_READY,
+    BLOCK_FAILED, // only ever the block the demuxer waits on, holds its error
+} BlockState;
+
+typedef struct {
+    int64_t index;
+    BlockState state;
+    int size;
+    int error;
+    int64_t last_use;
+    uint8_t *data;
+} CacheBlock;
+
+// One kept-alive HTTP/1.1 connection per worker. Every block is a bounded
+// range request on it; the socket is only reopened when the server closes it.
+typedef struct {
+    int fd; // -1 while closed
+    int begin;
+    int end;
+    uint8_t buffer[HTTP_CACHE_RECV_SIZE];
+} HttpConnection;
+
+typedef struct {
+    int status;
+    int64_t length;      // Content-Length, -1 when absent
+    int64_t range_start; // first byte of Content-Range, -1 when absent
+    int64_t total;       // size after the '/' of Content-Range, -1 when unknown
+    bool close;
+    bool chunked;
+    char location[1024];
+} HttpResponse;
+
+struct HttpCache {
+    char *url;
+    char host[256];
+    char port[8];
+    char host_header[272];
+    char path[2048];
+
+    int64_t size;
+    int64_t position;
+    int64_t nb_blocks;
+
+    // first block of the trailing region that is prefetched when the moov atom
+    // sits after mdat, or -1 when the layout is not known (yet) or the demuxer
+    // has read it
+    int64_t tail_block;
+
+    CacheBlock blocks[HTTP_CACHE_BLOCKS];
+    int64_t use_counter;
+    int64_t wanted;
+    int wanted_failures;
+
+    atomic_bool closing;
+    AVIOInterruptCB interrupt;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    pthread_t workers[HTTP_CACHE_WORKERS];
+    HttpConnection connections[HTTP_CACHE_WORKERS];
+    int nb_workers;
+    int next_worker;
+
+    AVIOContext *pb;
+};
+
+static int http_cache_interrupt(void *opaque) {
+    HttpCache *cache = (HttpCache *)opaque;
+    if (atomic_load(&cache->closing)) return 1;
+    return cache->interrupt.callback && cache->interrupt.callback(cache->interrupt.opaque);
+}
+
+// Only plain http is served from the cache; anything else (https, relative
+// redirects) makes http_cache_open() fail and the engine use ffmpeg's http.
+static int http_cache_set_url(HttpCache *cache, const char *url) {
+    char proto[16], host[256], path[2048];
+    int port;
+    av_url_split(proto, sizeof(proto), NULL, 0, host, sizeof(host), &port, path, sizeof(path), url);
+    if (strcmp(proto, "http") || !host[0]) return AVERROR(ENOSYS);
+    if (port < 0) port = 80;
+
+    av_strlcpy(cache->host, host, sizeof(cache->host));
+    snprintf(cache->port, sizeof(cache->port), "%d", port);
+    if (port == 80) {
+        av_strlcpy(cache->host_header, host, sizeof(cache->host_header));
+    } else {
+        snprintf(cache->host_header, sizeof(cache->host_header), "%s:%d", host, port);
+    }
+    av_strlcpy(cache->path, path[0] ? path : "/", sizeof(cache->path));
+
+    av_freep(&cache->url);
+    cache->url = av_strdup(url);
+    return cache->url ? 0 : AVERROR(ENOMEM);
+}
+
+// Waits until `fd` is ready for `events`, polling the interrupt callback.
+static int connection_wait(HttpCache *cache, int fd, short events) {
+    int64_t deadline = av_gettime_relative() + HTTP_CACHE_TIMEOUT;
+    for (;;) {
+        if (http_cache_interrupt(cache)) return AVERROR_EXIT;
+
+        struct pollfd p = {.fd = fd, .events = events};
+        int ret = poll(&p, 1, HTTP_CACHE_POLL);
+        if (ret > 0) return 0; // errors and hang ups surface from the next call
+        if (ret < 0 && errno != EINTR) return AVERROR(errno);
+        if (av_gettime_relative() > deadline) return AVERROR(ETIMEDOUT);
+    }
+}
+
+static void connection_close(HttpConnection *c) {
+    if (c->fd >= 0) close(c->fd);
+    c->fd = -1;
+    c->begin = c->end = 0;
+}
+
+static int connection_open(HttpCache *cache, HttpConnection *c) {
+    struct addrinfo hints = {.ai_family = AF_UNSPEC, .ai_socktype = SOCK_STREAM};
+    struct addrinfo *addresses;
+    int ret = getaddrinfo(cache->host, cache->port, &hints, &addresses);
+    if (ret) {
+        LOGE("[ERROR]: http cache: %s: %s", cache->host, gai_strerror(ret));
+        return AVERROR(EIO);
+    }
+
+    ret = AVERROR(ECONNREFUSED);
+    for (struct addrinfo *a = addresses; a; a = a->ai_next) {
+        int fd = socket(a->ai_family, a->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, a->ai_protocol);
+        if (fd < 0) {
+            ret = AVERROR(errno);
+            continue;
+        }
+
+        if (connect(fd, a->ai_addr, a->ai_addrlen) == 0) {
+            ret = 0;
+        } else if (errno != EINPROGRESS) {
+            ret = AVERROR(errno);
+        } else if ((ret = connection_wait(cache, fd, POLLOUT)) == 0) {
+            int error = 0;
+            socklen_t length = sizeof(error);
+            getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &length);
+            ret = error ? AVERROR(error) : 0;
+        }
+
+        if (ret == 0) {
+            c->fd = fd;
+            c->begin = c->end = 0;
+            break;
+        }
+        close(fd);
+        if (ret == AVERROR_EXIT) break;
+    }
+
+    freeaddrinfo(addresses);
+    return ret;
+}
+
+static int connection_write(HttpCache *cache, HttpConnection *c, const char *data, int size) {
+    while (size > 0) {
+        ssize_t n = send(c->fd, data, size, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) return AVERROR(errno);
+            int ret = connection_wait(cache, c->fd, POLLOUT);
+            if (ret < 0) return ret;
+            continue;
+        }
+        data += n;
+        size -= n;
+    }
+    return 0;
+}
+
+// Appends whatever the socket has to the receive buffer. Returns AVERROR_EOF
+// when the server closed the connection.
+static int connection_fill(HttpCache *cache, HttpConnection *c) {
+    if (c->begin > 0) {
+        memmove(c->buffer, c->buffer + c->begin, c->end - c->begin);
+        c->end -= c->begin;
+        c->begin = 0;
+    }
+    if (c->end == (int)sizeof(c->buffer)) return AVERROR_INVALIDDATA;
+
+    for (;;) {
+        ssize_t n = recv(c->fd, c->buffer + c->end, sizeof(c->buffer) - c->end, 0);
+        if (n > 0) {
+            c->end += (int)n;
+            return 0;
+        }
+        if (n == 0) return AVERROR_EOF;
+        if (errno == EINTR) continue;
+        if (errno != EAGAIN && errno != EWOULDBLOCK) return AVERROR(errno);
+        int ret = connection_wait(cache, c->fd, POLLIN);
+        if (ret < 0) return ret;
+    }
+}
+
+// Reads one header line, without its line break, into `line`.
+static int connection_read_line(HttpCache *cache, HttpConnection *c, char *line, int size) {
+    for (;;) {
+        uint8_t *start = c->buffer + c->begin;
+        uint8_t *newline = memchr(start, '\n', c->end - c->begin);
+        if (newline) {
+            int length = (int)(newline - start);
+            c->begin += length + 1;
+            if (length > 0 && start[length - 1] == '\r') length--;
+            if (length >= size) return AVERROR_INVALIDDATA;
+            memcpy(line, start, length);
+            line[length] = 0;
+            return 0;
+        }
+
+        int ret = connection_fill(cache, c);
+        if (ret < 0) return ret;
+    }
+}
+
+static int connection_read(HttpCache *cache, HttpConnection *c, uint8_t *data, int64_t size) {
+    while (size > 0) {
+        if (c->begin == c->end) {
+            int ret = connection_fill(cache, c);
+            if (ret < 0) return ret;
+        }
+        int n = (int)FFMIN(size, c->end - c->begin);
+        memcpy(data, c->buffer + c->begin, n);
+        c->begin += n;
+        data += n;
+        size -= n;
+    }
+    return 0;
+}
+
+// Sends a request for bytes [offset, offset + size) and reads the response
+// headers, leaving the body on the connection.
+static int http_cache_request(HttpCache *cache, HttpConnection *c, int64_t offset, int64_t size, HttpResponse *response) {
+    char line[4096];
+    int length = snprintf(line, sizeof(line),
+                          "GET %s HTTP/1.1\r\n"
+                          "Host: %s\r\n"
+                          "Range: bytes=%" PRId64 "-%" PRId64 "\r\n"
+                          "Accept-Encoding: identity\r\n"
+                          "Connection: keep-alive\r\n"
+                          "\r\n",
+                          cache->path, cache->host_header, offset, offset + size - 1);
+    if (length >= (int)sizeof(line)) return AVERROR(EINVAL);
+
+    int ret;
+    if ((ret = connection_write(cache, c, line, length)) < 0) return ret;
+    if ((ret = connection_read_line(cache, c, line, sizeof(line))) < 0) return ret;
+
+    int minor;
+    memset(response, 0, sizeof(*response));
+    response->length = response->range_start = response->total = -1;
+    if (sscanf(line, "HTTP/1.%d %d", &minor, &response->status) != 2) return AVERROR_INVALIDDATA;
+    response->close = minor == 0;
+
+    for (;;) {
+        if ((ret = connection_read_line(cache, c, line, sizeof(line))) < 0) return ret;
+        if (!line[0]) break;
+
+        char *value = strchr(line, ':');
+        if (!value) continue;
+        *value++ = 0;
+        while (*value == ' ' || *value == '\t') value++;
+
+        if (!av_strcasecmp(line, "Content-Length")) {
+            response->length = strtoll(value, NULL, 10);
+        } else if (!av_strcasecmp(line, "Content-Range")) {
+            int64_t end;
+            if (sscanf(value, "bytes %" SCNd64 "-%" SCNd64 "/%" SCNd64, &response->range_start, &end, &response->total) < 2) response->range_start = -1;
+        } else if (!av_strcasecmp(line, "Connection")) {
+            response->close = !av_strcasecmp(value, "close");
+        } else if (!av_strcasecmp(line, "Transfer-Encoding")) {
+            response->chunked = av_strcasecmp(value, "identity") != 0;
+        } else if (!av_strcasecmp(line, "Location")) {
+            av_strlcpy(response->location, value, sizeof(response->location));
+        }
+    }
+
+    // the body has to be delimited by its length for the connection to be reused
+    if (response->chunked || response->length < 0) response->close = true;
+    return 0;
+}
+
+// Fetches bytes [offset, offset + size) into `data` on a worker's connection.
+// A kept-alive connection the server has closed while idle is reopened once.
+static int http_cache_fetch(HttpCache *cache, HttpConnection *c, int64_t offset, int size, uint8_t *data) {
+    for (int attempt = 0;; attempt++) {
+        bool reused = c->fd >= 0;
+        int ret = reused ? 0 : connection_open(cache, c);
+
+        HttpResponse response;
+        if (ret >= 0) ret = http_cache_request(cache, c, offset, size, &response);
+        if (ret >= 0) {
+            if (response.status == 206 && response.range_start == offset && response.length == size) {
+                ret = connection_read(cache, c, data, size);
+            } else {
+                LOGE("[ERROR]: http cache: bytes %" PRId64 "+%d: status %d, %" PRId64 " bytes from %" PRId64, offset, size, response.status, response.length, response.range_start);
+                ret = AVERROR(EIO);
+            }
+        }
+
+        if (ret >= 0 && !response.close) return 0;
+        connection_close(c);
+        if (ret >= 0) return 0;
+        if (!reused || attempt > 0 || ret == AVERROR_EXIT) return ret;
+    }
+}
+
+static CacheBlock *http_cache_find(HttpCache *cache, int64_t index) {
+    for (int i = 0; i < HTTP_CACHE_BLOCKS; i++) {
+        if (cache->blocks[i].state != BLOCK_EMPTY && cache->blocks[i].index == index) return &cache->blocks[i];
+    }
+    return NULL;
+}
+
+// Makes `index` the block the reader waits on, -1 for none. Errors are only
+// reported for that block, so a failure left on a previous one is dropped and
+// the block refetched when it is wanted again.
+static void http_cache_want(HttpCache *cache, int64_t index) {
+    if (cache->wanted == index) return;
+    cache->wanted = index;
+    cache->wanted_failures = 0;
+    for (int i = 0; i < HTTP_CACHE_BLOCKS; i++) {
+        if (cache->blocks[i].state == BLOCK_FAILED && cache->blocks[i].index != index) cache->blocks[i].state = BLOCK_EMPTY;
+    }
+}
+
+static bool http_cache_protected(HttpCache *cache, int64_t index) {
+    int64_t current = cache->position / HTTP_CACHE_BLOCK_SIZE;
+    if (index >= current && index <= current + HTTP_CACHE_READ_AHEAD) return true;
+    if (index == cache->wanted) return true;
+    // kept until the demuxer gets to it, or it would be prefetched again
+    if (cache->tail_block >= 0 && index >= cache->tail_block && index < cache->tail_block + HTTP_CACHE_TAIL_BLOCKS) return true;
+    return false;
+}
+
+// Returns an empty slot, evicting the least recently used ready block outside
+// the read-ahead window and the unread tail if needed. NULL means every slot is busy or protected.
+static CacheBlock *http_cache_slot(HttpCache *cache) {
+    CacheBlock *victim = NULL;
+    for (int i = 0; i < HTTP_CACHE_BLOCKS; i++) {
+        CacheBlock *block = &cache->blocks[i];
+        if (block->state == BLOCK_EMPTY) return block;
+        if (block->state != BLOCK_READY || http_cache_protected(cache, block->index)) continue;
+        if (!victim || block->last_use < victim->last_use) victim = block;
+    }
+    if (victim) victim->state = BLOCK_EMPTY;
+    return victim;
+}
+
+// Picks the next block to fetch: the block the reader is blocked on, then the
+// read-ahead window, then the trailing moov region.
+static int64_t http_cache_next(HttpCache *cache) {
+    if (cache->wanted >= 0 && !http_cache_find(cache, cache->wanted)) return cache->wanted;
+
+    int64_t current = cache->position / HTTP_CACHE_BLOCK_SIZE;
+    for (int64_t i = current; i <= current + HTTP_CACHE_READ_AHEAD && i < cache->nb_blocks; i++) {
+        if (!http_cache_find(cache, i)) return i;
+    }
+
+    if (cache->tail_block >= 0) {
+        for (int64_t i = cache->tail_block; i < cache->nb_blocks && i < cache->tail_block + HTTP_CACHE_TAIL_BLOCKS; i++) {
+            if (!http_cache_find(cache, i)) return i;
+        }
+    }
+
+    return -1;
+}
+
+static uint64_t read_be(const uint8_t *p, int n) {
+    uint64_t v = 0;
+    for (int i = 0; i < n; i++) v = (v << 8) | p[i];
+    return v;
+}
+
+// Walks the top level MP4 boxes in the first block. When mdat comes before
+// moov, the demuxer will seek to the end of the file right after probing, so
+// the region after mdat is queued for prefetch alongside the head.
+static void http_cache_scan_layout(HttpCache *cache, const uint8_t *data, int size) {
+    int64_t offset = 0;
+    while (offset + 8 <= size) {
+        uint64_t box_size = read_be(data + offset, 4);
+        const uint8_t *type = data + offset + 4;
+        int header = 8;
+
+        if (box_size == 1) {
+            if (offset + 16 > size) return;
+            box_size = read_be(data + offset + 8, 8);
+            header = 16;
+        } else if (box_size == 0) {
+            box_size = cache->size - offset;
+        }
+        if (box_size < (uint64_t)header) return;
+
+        if (!memcmp(type, "moov", 4)) return;
+        if (!memcmp(type, "mdat", 4)) {
+            int64_t end = offset + (int64_t)box_size;
+            if (end < cache->size) {
+                cache->tail_block = end / HTTP_CACHE_BLOCK_SIZE;
+                LOG("http cache: moov after mdat at %" PRId64 ", prefetching tail", end);
+            }
+            return;
+        }
+
+        offset += (int64_t)box_size;
+    }
+}
+
+static void *http_cache_worker(void *arg) {
+    HttpCache *cache = (HttpCache *)arg;
+
+    pthread_mutex_lock(&cache->mutex);
+    int id = cache->next_worker++;
+    pthread_mutex_unlock(&cache->mutex);
+
+    while (!atomic_load(&cache->closing)) {
+        pthread_mutex_lock(&cache->mutex);
+
+        int64_t index;
+        CacheBlock *block = NULL;
+        while (!atomic_load(&cache->closing)) {
+            index = http_cache_next(cache);
+            if (index >= 0 && (block = http_cache_slot(cache)) != NULL) break;
+            pthread_cond_wait(&cache->cond, &cache->mutex);
+        }
+        if (!block) {
+            pthread_mutex_unlock(&cache->mutex);
+            break;
+        }
+
+        block->index = index;
+        block->state = BLOCK_PENDING;
+        block->size = 0;
+        pthread_mutex_unlock(&cache->mutex);
+
+        int64_t offset = index * HTTP_CACHE_BLOCK_SIZE;
+        int size = (int)FFMIN(HTTP_CACHE_BLOCK_SIZE, cache->size - offset);
+        int ret = http_cache_fetch(cache, &cache->connections[id], offset, size, block->data);
+
+        pthread_mutex_lock(&cache->mutex);
+        if (ret >= 0) {
+            block->state = BLOCK_READY;
+            block->size = size;
+            block->last_use = ++cache->use_counter;
+        } else if (atomic_load(&cache->closing)) {
+            block->state = BLOCK_EMPTY;
+        } else if (index == cache->wanted && ++cache->wanted_failures >= HTTP_CACHE_ATTEMPTS) {
+            // the demuxer is blocked on this block, hand it the error
+            LOGE("[ERROR]: http cache block %" PRId64 ": %s", index, av_err2str(ret));
+            block->state = BLOCK_FAILED;
+            block->error = ret;
+        } else {
+            // a prefetch, or a retry left for the wanted block: forget it so
+            // it is fetched again
+            LOG("http cache block %" PRId64 ": %s, retrying", index, av_err2str(ret));
+            block->state = BLOCK_EMPTY;
+        }
+        pthread_cond_broadcast(&cache->cond);
+        pthread_mutex_unlock(&cache->mutex);
+
+        if (ret < 0) av_usleep(100 * 1000);
+    }
+
+    return NULL;
+}
+
+static int http_cache_read(void *opaque, uint8_t *buf, int buf_size) {
+    HttpCache *cache = (HttpCache *)opaque;
+
+    pthread_mutex_lock(&cache->mutex);
+    if (cache->position >= cache->size) {
+        pthread_mutex_unlock(&cache->mutex);
+        return AVERROR_EOF;
+    }
+
+    int64_t index = cache->position / HTTP_CACHE_BLOCK_SIZE;
+    CacheBlock *block;
+    while ((block = http_cache_find(cache, index)) == NULL || block->state != BLOCK_READY) {
+        if (http_cache_interrupt(cache)) {
+            pthread_mutex_unlock(&cache->mutex);
+            return AVERROR_EXIT;
+        }
+        if (block && block->state == BLOCK_FAILED) {
+            int ret = block->error;
+            block->state = BLOCK_EMPTY;
+            http_cache_want(cache, -1);
+            pthread_mutex_unlock(&cache->mutex);
+            return ret;
+        }
+
+        http_cache_want(cache, index);
+        pthread_cond_broadcast(&cache->cond);
+
+        // wake up periodically to poll the interrupt callback
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        ts.tv_nsec += 50 * 1000 * 1000;
+        if (ts.tv_nsec >= 1000 * 1000 * 1000) {
+            ts.tv_sec++;
+            ts.tv_nsec -= 1000 * 1000 * 1000;
+        }
+        pthread_cond_timedwait(&cache->cond, &cache->mutex, &ts);
+    }
+
+    int offset = (int)(cache->position - index * HTTP_CACHE_BLOCK_SIZE);
+    int n = FFMIN(buf_size, block->size - offset);
+    memcpy(buf, block->data + offset, n);
+    block->last_use = ++cache->use_counter;
+    cache->position += n;
+    if (cache->wanted == index) http_cache_want(cache, -1);
+
+    // the demuxer has reached the tail: the read-ahead window covers the rest
+    // of it, and once playback moves on its blocks age out like any other
+    // instead of being fetched again each time they are evicted
+    if (cache->tail_block >= 0 && index >= cache->tail_block) cache->tail_block = -1;
+
+    // the window moved, let idle workers prefetch further ahead
+    pthread_cond_broadcast(&cache->cond);
+    pthread_mutex_unlock(&cache->mutex);
+
+    return n;
+}
+
+static int64_t http_cache_seek(void *opaque, int64_t offset, int whence) {
+    HttpCache *cache = (HttpCache *)opaque;
+
+    whence &= ~AVSEEK_FORCE;
+    if (whence == AVSEEK_SIZE) return cache->size;
+
+    pthread_mutex_lock(&cache->mutex);
+    int64_t position;
+    switch (whence) {
+    case SEEK_SET: position = offset; break;
+    case SEEK_CUR: position = cache->position + offset; break;
+    case SEEK_END: position = cache->size + offset; break;
+    default: position = -1; break;
+    }
+    if (position < 0 || position > cache->size) {
+        pthread_mutex_unlock(&cache->mutex);
+        return AVERROR(EINVAL);
+    }
+
+    cache->position = position;
+    pthread_cond_broadcast(&cache->cond);
+    pthread_mutex_unlock(&cache->mutex);
+
+    return position;
+}
+
+// Requests the first block on the first connection, following redirects. The
+// Content-Range of the answer gives the file size and proves that the server
+// honours range requests; the block is kept and scanned for the MP4 layout.
+static int http_cache_probe(HttpCache *cache) {
+    HttpConnection *c = &cache->connections[0];
+    CacheBlock *block = &cache->blocks[0];
+
+    for (int redirects = 0;; redirects++) {
+        int ret;
+        HttpResponse response;
+        if ((ret = connection_open(cache, c)) < 0) return ret;
+        if ((ret = http_cache_request(cache, c, 0, HTTP_CACHE_BLOCK_SIZE, &response)) < 0) return ret;
+
+        if (response.status >= 300 && response.status < 400 && response.location[0] && redirects < HTTP_CACHE_REDIRECTS) {
+            connection_close(c);
+            if ((ret = http_cache_set_url(cache, response.location)) < 0) return ret;
+            continue;
+        }
+        if (response.status != 206 || response.range_start != 0 || response.total <= 0 || response.length <= 0 || response.length > HTTP_CACHE_BLOCK_SIZE) {
+            LOGE("[ERROR]: http cache: %s: status %d, no usable Content-Range", cache->url, response.status);
+            return AVERROR(ENOSYS);
+        }
+
+        if ((ret = connection_read(cache, c, block->data, response.length)) < 0) return ret;
+        if (response.close) connection_close(c);
+
+        cache->size = response.total;
+        block->index = 0;
+        block->state = BLOCK_READY;
+        block->size = (int)response.length;
+        block->last_use = ++cache->use_counter;
+        http_cache_scan_layout(cache, block->data, block->size);
+        return 0;
+    }
+}
+
+int http_cache_open(HttpCache **out, AVIOContext **pb, const char *url, const AVIOInterruptCB *interrupt) {
+    int ret;
+
+    HttpCache *cache = av_mallocz(sizeof(HttpCache));
+    if (!cache) return AVERROR(ENOMEM);
+
+    cache->tail_block = -1;
+    cache->wanted = -1;
+    if (interrupt) cache->interrupt = *interrupt;
+    for (int i = 0; i < HTTP_CACHE_WORKERS; i++) cache->connections[i].fd = -1;
+
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&cache->cond, &attr);
+    pthread_condattr_destroy(&attr);
+    pthread_mutex_init(&cache->mutex, NULL);
+
+    for (int i = 0; i < HTTP_CACHE_BLOCKS; i++) {
+        cache->blocks[i].index = -1;
+        cache->blocks[i].data = av_malloc(HTTP_CACHE_BLOCK_SIZE);
+        if (!cache->blocks[i].data) {
+            ret = AVERROR(ENOMEM);
+            goto fail;
+        }
+    }
+
+    // the first connection learns the file size up front; the first worker
+    // takes it over, the others connect in parallel on their first fetch
+    if ((ret = http_cache_set_url(cache, url)) < 0) goto fail;
+    if ((ret = http_cache_probe(cache)) < 0) goto fail;
+    cache->nb_blocks = (cache->size + HTTP_CACHE_BLOCK_SIZE - 1) / HTTP_CACHE_BLOCK_SIZE;
+
+    uint8_t *buffer = av_malloc(HTTP_CACHE_IO_SIZE);
+    if (!buffer) {
+        ret = AVERROR(ENOMEM);
+        goto fail;
+    }
+    cache->pb = avio_alloc_context(buffer, HTTP_CACHE_IO_SIZE, 0, cache, http_cache_read, NULL, http_cache_seek);
+    if (!cache->pb) {
+        av_free(buffer);
+        ret = AVERROR(ENOMEM);
+        goto fail;
+    }
+
+    for (int i = 0; i < HTTP_CACHE_WORKERS; i++) {
+        if (pthread_create(&cache->workers[i], NULL, http_cache_worker, cache) != 0) {
+            ret = AVERROR(EAGAIN);
+            goto fail;
+        }
+        cache->nb_workers++;
+    }
+
+    LOG("http cache: %" PRId64 " bytes | %d blocks of %d KiB | %d workers", cache->size, HTTP_CACHE_BLOCKS, HTTP_CACHE_BLOCK_SIZE / 1024, HTTP_CACHE_WORKERS);
+
+    *out = cache;
+    *pb = cache->pb;
+    return 0;
+
+fail:
+    http_cache_close(&cache);
+    return ret;
+}
+
+void http_cache_close(HttpCache **pcache) {
+    HttpCache *cache = *pcache;
+    if (!cache) return;
+
+    pthread_mutex_lock(&cache->mutex);
+    atomic_store(&cache->closing, true);
+    pthread_cond_broadcast(&cache->cond);
+    pthread_mutex_unlock(&cache->mutex);
+
+    for (int i = 0; i < cache->nb_workers; i++) pthread_join(cache->workers[i], NULL);
+
+    for (int i = 0; i < HTTP_CACHE_WORKERS; i++) connection_close(&cache->connections[i]);
+    for (int i = 0; i < HTTP_CACHE_BLOCKS; i++) av_freep(&cache->blocks[i].data);
+
+    if (cache->pb) {
+        av_freep(&cache->pb->buffer);
+        avio_context_free(&cache->pb);
+    }
+
+    pthread_cond_destroy(&cache->cond);
+    pthread_mutex_destroy(&cache->mutex);
+    av_freep(&cache->url);
+    av_freep(pcache);
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <libavformat/avformat.h>
+
+// Read-ahead cache over HTTP range requests. The file is split into fixed size
+// blocks that a small pool of workers fetches in parallel ahead of the
+// demuxer's read position, each block one bounded `Range: bytes=a-b` request
+// on the worker's kept-alive HTTP/1.1 connection. Only plain http URLs are
+// served; http_cache_open() fails for anything else, and for servers that do
+// not honour range requests, so the caller can fall back to ffmpeg's http.
+// The AVIOContext it returns is meant to be set as AVFormatContext.pb.
+typedef struct HttpCache HttpCache;
+
+int http_cache_open(HttpCache **cache, AVIOContext **pb, const char *url, const AVIOInterruptCB *interrupt);
+void http_cache_close(HttpCache **cache);
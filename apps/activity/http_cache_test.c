@@ -0,0 +1,416 @@
+// Host test of the read-ahead cache against a local HTTP/1.1 server running
+// in-process on 127.0.0.1, serving a synthetic MP4 with its moov atom at the
+// end, e.g.
+//
+//     make test
+//
+// The cache is built into the test so it can use the block size.
+
+#define _GNU_SOURCE
+#include "http_cache.c"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+
+#define TEST_BLOCKS 64
+#define TEST_SIZE ((int64_t)TEST_BLOCKS * HTTP_CACHE_BLOCK_SIZE + 12345)
+#define TEST_MOOV_SIZE 100000
+#define TEST_MAX_REQUESTS 4096
+
+typedef struct {
+    int listen_fd;
+    int port;
+    uint8_t *data;
+    int64_t size;
+    pthread_t thread;
+    atomic_bool stopping;
+    atomic_int active; // connection threads still running
+
+    pthread_mutex_t mutex;
+    int connections;
+    int requests;
+    int unbounded;          // range requests without an end offset
+    int64_t fail_offset;    // requests starting here are answered with a 503...
+    int fail_count;         // ...this many times, -1 for always
+    bool close_each;        // answer every request with Connection: close
+    bool ignore_range;      // answer with the whole file and a 200
+    int64_t offsets[TEST_MAX_REQUESTS];
+} Server;
+
+static Server server;
+static int failures;
+
+#define CHECK(cond)                                                            \
+    do {                                                                       \
+        if (!(cond)) {                                                         \
+            fprintf(stderr, "%s:%d: %s: %s\n", __FILE__, __LINE__, __func__, #cond); \
+            failures++;                                                        \
+        }                                                                      \
+    } while (0)
+
+static bool send_all(int fd, const void *data, int64_t size) {
+    const uint8_t *p = data;
+    while (size > 0) {
+        ssize_t n = send(fd, p, size, MSG_NOSIGNAL);
+        if (n <= 0) return false;
+        p += n;
+        size -= n;
+    }
+    return true;
+}
+
+static void *server_connection(void *arg) {
+    int fd = (int)(intptr_t)arg;
+    char request[8192];
+    int filled = 0;
+
+    while (!atomic_load(&server.stopping)) {
+        char *end;
+        while (!(end = memmem(request, filled, "\r\n\r\n", 4))) {
+            ssize_t n = recv(fd, request + filled, sizeof(request) - filled - 1, 0);
+            if (n <= 0) goto done;
+            filled += (int)n;
+        }
+        *end = 0;
+        int consumed = (int)(end + 4 - request);
+
+        char path[2048] = "";
+        sscanf(request, "GET %2047s", path);
+        int64_t first = 0, last = server.size - 1;
+        bool ranged = false, bounded = false;
+        char *range = strcasestr(request, "\r\nRange: bytes=");
+        if (range) {
+            ranged = true;
+            bounded = sscanf(range, "\r\nRange: bytes=%" SCNd64 "-%" SCNd64, &first, &last) == 2;
+            if (last >= server.size) last = server.size - 1;
+        }
+
+        pthread_mutex_lock(&server.mutex);
+        if (ranged && !bounded) server.unbounded++;
+        if (server.requests < TEST_MAX_REQUESTS) server.offsets[server.requests] = first;
+        server.requests++;
+        bool fail = first == server.fail_offset && server.fail_count != 0;
+        if (fail && server.fail_count > 0) server.fail_count--;
+        bool close_after = server.close_each;
+        bool whole = server.ignore_range || !ranged;
+        pthread_mutex_unlock(&server.mutex);
+
+        char header[512];
+        int length;
+        const char *connection = close_after ? "Connection: close\r\n" : "";
+        if (!strcmp(path, "/redirect")) {
+            length = snprintf(header, sizeof(header), "HTTP/1.1 302 Found\r\nLocation: http://127.0.0.1:%d/file.mp4\r\nContent-Length: 0\r\n%s\r\n", server.port, connection);
+            first = 0, last = -1;
+        } else if (fail) {
+            length = snprintf(header, sizeof(header), "HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\n%s\r\n", connection);
+            first = 0, last = -1;
+        } else if (whole) {
+            length = snprintf(header, sizeof(header), "HTTP/1.1 200 OK\r\nContent-Length: %" PRId64 "\r\n%s\r\n", server.size, connection);
+            first = 0, last = server.size - 1;
+        } else {
+            length = snprintf(header, sizeof(header), "HTTP/1.1 206 Partial Content\r\nContent-Range: bytes %" PRId64 "-%" PRId64 "/%" PRId64 "\r\nContent-Length: %" PRId64 "\r\n%s\r\n", first, last, server.size, last - first + 1, connection);
+        }
+
+        if (!send_all(fd, header, length) || !send_all(fd, server.data + first, last - first + 1) || close_after) break;
+
+        memmove(request, request + consumed, filled - consumed);
+        filled -= consumed;
+    }
+
+done:
+    close(fd);
+    atomic_fetch_sub(&server.active, 1);
+    return NULL;
+}
+
+static void *server_task(void *arg) {
+    (void)arg;
+    while (!atomic_load(&server.stopping)) {
+        struct pollfd p = {.fd = server.listen_fd, .events = POLLIN};
+        if (poll(&p, 1, 20) <= 0) continue;
+        int fd = accept(server.listen_fd, NULL, NULL);
+        if (fd < 0) continue;
+
+        pthread_mutex_lock(&server.mutex);
+        server.connections++;
+        pthread_mutex_unlock(&server.mutex);
+
+        pthread_t thread;
+        atomic_fetch_add(&server.active, 1);
+        if (pthread_create(&thread, NULL, server_connection, (void *)(intptr_t)fd) != 0) {
+            close(fd);
+            atomic_fetch_sub(&server.active, 1);
+            continue;
+        }
+        pthread_detach(thread);
+    }
+    return NULL;
+}
+
+static void write_box(uint8_t *p, uint32_t size, const char *type) {
+    p[0] = size >> 24, p[1] = size >> 16, p[2] = size >> 8, p[3] = size;
+    memcpy(p + 4, type, 4);
+}
+
+// An ftyp box, an mdat box filling the file, then the moov box at the end.
+static void server_make_file(void) {
+    server.size = TEST_SIZE;
+    server.data = malloc(server.size);
+    for (int64_t i = 0; i < server.size; i++) server.data[i] = (uint8_t)((uint32_t)i * 2654435761u >> 24);
+
+    int64_t moov = server.size - TEST_MOOV_SIZE;
+    write_box(server.data, 24, "ftyp");
+    write_box(server.data + 24, (uint32_t)(moov - 24), "mdat");
+    write_box(server.data + moov, TEST_MOOV_SIZE, "moov");
+}
+
+static void server_start(void) {
+    pthread_mutex_init(&server.mutex, NULL);
+    server.listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in address = {.sin_family = AF_INET, .sin_addr.s_addr = htonl(INADDR_LOOPBACK)};
+    socklen_t length = sizeof(address);
+    if (bind(server.listen_fd, (struct sockaddr *)&address, length) < 0 || listen(server.listen_fd, 16) < 0) {
+        perror("server");
+        exit(1);
+    }
+    getsockname(server.listen_fd, (struct sockaddr *)&address, &length);
+    server.port = ntohs(address.sin_port);
+    pthread_create(&server.thread, NULL, server_task, NULL);
+}
+
+static void server_stop(void) {
+    atomic_store(&server.stopping, true);
+    pthread_join(server.thread, NULL);
+    close(server.listen_fd);
+    // connection threads end once the cache has closed its sockets
+    while (atomic_load(&server.active) > 0) av_usleep(1000);
+    free(server.data);
+}
+
+static void server_reset(int64_t fail_offset, int fail_count, bool close_each, bool ignore_range) {
+    pthread_mutex_lock(&server.mutex);
+    server.connections = 0;
+    server.requests = 0;
+    server.unbounded = 0;
+    server.fail_offset = fail_offset;
+    server.fail_count = fail_count;
+    server.close_each = close_each;
+    server.ignore_range = ignore_range;
+    pthread_mutex_unlock(&server.mutex);
+}
+
+static int open_cache(HttpCache **cache, AVIOContext **pb, const char *path) {
+    char url[256];
+    snprintf(url, sizeof(url), "http://127.0.0.1:%d%s", server.port, path);
+    return http_cache_open(cache, pb, url, NULL);
+}
+
+// Reads [offset, offset + size) through the cache and compares it with the file.
+static int read_at(AVIOContext *pb, int64_t offset, int size) {
+    static uint8_t buffer[HTTP_CACHE_BLOCK_SIZE];
+    if (avio_seek(pb, offset, SEEK_SET) != offset) return AVERROR(EINVAL);
+    int n = avio_read(pb, buffer, size);
+    if (n < 0) return n;
+    if (n != size || memcmp(buffer, server.data + offset, size)) return AVERROR_INVALIDDATA;
+    return 0;
+}
+
+static int read_all(AVIOContext *pb) {
+    for (int64_t offset = 0; offset < server.size; offset += HTTP_CACHE_IO_SIZE) {
+        int ret = read_at(pb, offset, (int)FFMIN(HTTP_CACHE_IO_SIZE, server.size - offset));
+        if (ret < 0) return ret;
+    }
+    return 0;
+}
+
+static bool requested(int64_t offset) {
+    pthread_mutex_lock(&server.mutex);
+    bool found = false;
+    for (int i = 0; i < server.requests && i < TEST_MAX_REQUESTS; i++) found |= server.offsets[i] == offset;
+    pthread_mutex_unlock(&server.mutex);
+    return found;
+}
+
+// Number of requests for the block starting at the most requested offset.
+static int max_requests_per_block(void) {
+    int most = 0;
+    pthread_mutex_lock(&server.mutex);
+    for (int i = 0; i < server.requests && i < TEST_MAX_REQUESTS; i++) {
+        int count = 0;
+        for (int j = 0; j < server.requests && j < TEST_MAX_REQUESTS; j++) count += server.offsets[j] == server.offsets[i];
+        if (count > most) most = count;
+    }
+    pthread_mutex_unlock(&server.mutex);
+    return most;
+}
+
+static void test_sequential(void) {
+    server_reset(-1, 0, false, false);
+    HttpCache *cache = NULL;
+    AVIOContext *pb = NULL;
+    CHECK(open_cache(&cache, &pb, "/file.mp4") == 0);
+    if (!cache) return;
+
+    CHECK(avio_size(pb) == server.size);
+    CHECK(read_all(pb) == 0);
+    CHECK(avio_read(pb, (uint8_t[1]){0}, 1) == AVERROR_EOF);
+    http_cache_close(&cache);
+
+    // every block is one bounded request, the probe connection is reused by
+    // the first worker and the others are kept alive across blocks
+    CHECK(server.unbounded == 0);
+    CHECK(server.connections <= HTTP_CACHE_WORKERS);
+    CHECK(server.requests == TEST_BLOCKS + 1);
+    CHECK(max_requests_per_block() == 1);
+}
+
+static void test_moov_prefetch(void) {
+    server_reset(-1, 0, false, false);
+    HttpCache *cache = NULL;
+    AVIOContext *pb = NULL;
+    CHECK(open_cache(&cache, &pb, "/file.mp4") == 0);
+    if (!cache) return;
+
+    // the tail is fetched without the reader asking for it
+    int64_t tail = (server.size - TEST_MOOV_SIZE) / HTTP_CACHE_BLOCK_SIZE * HTTP_CACHE_BLOCK_SIZE;
+    for (int i = 0; i < 100 && !requested(tail); i++) av_usleep(10000);
+    CHECK(requested(tail));
+    CHECK(read_at(pb, server.size - TEST_MOOV_SIZE, TEST_MOOV_SIZE) == 0);
+    http_cache_close(&cache);
+}
+
+// What the demuxer does with a moov at the end: the head, then the moov, then
+// the mdat from the start. The file is larger than the cache, so the blocks
+// read for the moov are evicted as playback goes on, and must stay evicted
+// rather than be fetched again every time. Playback stops while the read-ahead
+// window is still short of them, as they are fetched again once it gets there.
+static void test_moov_at_end_playback(void) {
+    server_reset(-1, 0, false, false);
+    HttpCache *cache = NULL;
+    AVIOContext *pb = NULL;
+    CHECK(open_cache(&cache, &pb, "/file.mp4") == 0);
+    if (!cache) return;
+
+    int64_t tail = (server.size - TEST_MOOV_SIZE) / HTTP_CACHE_BLOCK_SIZE * HTTP_CACHE_BLOCK_SIZE;
+    int64_t end = tail - (HTTP_CACHE_READ_AHEAD + 1) * HTTP_CACHE_BLOCK_SIZE;
+    CHECK(end / HTTP_CACHE_BLOCK_SIZE > HTTP_CACHE_BLOCKS);
+    CHECK(read_at(pb, 0, 32) == 0);
+    CHECK(read_at(pb, server.size - TEST_MOOV_SIZE, TEST_MOOV_SIZE) == 0);
+    for (int64_t offset = 32; offset < end; offset += HTTP_CACHE_IO_SIZE) {
+        int ret = read_at(pb, offset, (int)FFMIN(HTTP_CACHE_IO_SIZE, end - offset));
+        CHECK(ret == 0);
+        if (ret < 0) break;
+    }
+    http_cache_close(&cache);
+
+    CHECK(max_requests_per_block() == 1);
+    CHECK(server.requests <= TEST_BLOCKS + 1);
+}
+
+static void test_random_seeks(void) {
+    server_reset(-1, 0, false, false);
+    HttpCache *cache = NULL;
+    AVIOContext *pb = NULL;
+    CHECK(open_cache(&cache, &pb, "/file.mp4") == 0);
+    if (!cache) return;
+
+    uint32_t seed = 1;
+    for (int i = 0; i < 300; i++) {
+        seed = seed * 1664525 + 1013904223;
+        int size = 1 + (int)(seed >> 16) % 4000;
+        int64_t offset = (int64_t)(seed % (uint32_t)(server.size - size));
+        int ret = read_at(pb, offset, size);
+        CHECK(ret == 0);
+        if (ret < 0) break;
+    }
+    http_cache_close(&cache);
+    CHECK(server.unbounded == 0);
+}
+
+// A read-ahead block that fails once is fetched again; the reader never sees it.
+static void test_prefetch_failure(void) {
+    server_reset(3 * HTTP_CACHE_BLOCK_SIZE, 1, false, false);
+    HttpCache *cache = NULL;
+    AVIOContext *pb = NULL;
+    CHECK(open_cache(&cache, &pb, "/file.mp4") == 0);
+    if (!cache) return;
+
+    CHECK(read_all(pb) == 0);
+    CHECK(server.fail_count == 0);
+    http_cache_close(&cache);
+}
+
+// A block that keeps failing is reported to the reader waiting on it, and
+// only for that block.
+static void test_wanted_failure(void) {
+    server_reset(5 * HTTP_CACHE_BLOCK_SIZE, -1, false, false);
+    HttpCache *cache = NULL;
+    AVIOContext *pb = NULL;
+    CHECK(open_cache(&cache, &pb, "/file.mp4") == 0);
+    if (!cache) return;
+
+    CHECK(read_at(pb, 4 * HTTP_CACHE_BLOCK_SIZE, HTTP_CACHE_BLOCK_SIZE) == 0);
+    int ret = read_at(pb, 5 * HTTP_CACHE_BLOCK_SIZE, 100);
+    CHECK(ret < 0 && ret != AVERROR_INVALIDDATA && ret != AVERROR_EOF);
+    CHECK(read_at(pb, 7 * HTTP_CACHE_BLOCK_SIZE, HTTP_CACHE_BLOCK_SIZE) == 0);
+
+    // and fetched again once the server recovers
+    server_reset(-1, 0, false, false);
+    CHECK(read_at(pb, 5 * HTTP_CACHE_BLOCK_SIZE, 100) == 0);
+    http_cache_close(&cache);
+}
+
+static void test_connection_close(void) {
+    server_reset(-1, 0, true, false);
+    HttpCache *cache = NULL;
+    AVIOContext *pb = NULL;
+    CHECK(open_cache(&cache, &pb, "/file.mp4") == 0);
+    if (!cache) return;
+
+    CHECK(read_all(pb) == 0);
+    http_cache_close(&cache);
+    CHECK(server.connections == server.requests);
+}
+
+static void test_redirect(void) {
+    server_reset(-1, 0, false, false);
+    HttpCache *cache = NULL;
+    AVIOContext *pb = NULL;
+    CHECK(open_cache(&cache, &pb, "/redirect") == 0);
+    if (!cache) return;
+
+    CHECK(read_at(pb, 0, HTTP_CACHE_BLOCK_SIZE) == 0);
+    http_cache_close(&cache);
+}
+
+static void test_no_range_support(void) {
+    server_reset(-1, 0, false, true);
+    HttpCache *cache = NULL;
+    AVIOContext *pb = NULL;
+    CHECK(open_cache(&cache, &pb, "/file.mp4") == AVERROR(ENOSYS));
+    CHECK(cache == NULL);
+}
+
+int main(void) {
+    server_make_file();
+    server_start();
+
+    test_sequential();
+    test_moov_prefetch();
+    test_moov_at_end_playback();
+    test_random_seeks();
+    test_prefetch_failure();
+    test_wanted_failure();
+    test_connection_close();
+    test_redirect();
+    test_no_range_support();
+
+    server_stop();
+
+    if (failures) {
+        fprintf(stderr, "http_cache_test: %d checks failed\n", failures);
+        return 1;
+    }
+    fprintf(stderr, "http_cache_test: ok\n");
+    return 0;
+}
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <math.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+#define ANALYSIS_SIZE 1024 // FFT length, power of two
+#define ANALYSIS_BANDS 48
+
+// One published analysis of the last ANALYSIS_SIZE mixed frames.
+typedef struct {
+    float bands[ANALYSIS_BANDS]; // log spaced, 0..1 over a 60 dB range
+    float rms;
+    uint32_t sequence;
+} Spectrum;
+
+// Triple buffer between the analysis (writer) and the render thread (reader).
+// Each side owns one slot and they swap the third through a single atomic, so
+// neither ever waits and the reader always sees the latest complete spectrum.
+typedef struct {
+    Spectrum slots[3];
+    _Atomic uint32_t middle; // slot index, SPECTRUM_FRESH set when unread
+    uint32_t back;           // writer's slot
+    uint32_t front;          // reader's slot
+} SpectrumBuffer;
+
+#define SPECTRUM_FRESH 4u
+
+static inline void spectrum_buffer_init(SpectrumBuffer *buffer) {
+    memset(buffer->slots, 0, sizeof(buffer->slots));
+    buffer->front = 0;
+    atomic_init(&buffer->middle, 1);
+    buffer->back = 2;
+}
+
+static inline Spectrum *spectrum_buffer_back(SpectrumBuffer *buffer) {
+    return &buffer->slots[buffer->back];
+}
+
+// Publishes the back slot and takes the old middle one for the next write.
+static inline void spectrum_buffer_publish(SpectrumBuffer *buffer) {
+    uint32_t old = atomic_exchange_explicit(&buffer->middle, buffer->back | SPECTRUM_FRESH, memory_order_acq_rel);
+    buffer->back = old & ~SPECTRUM_FRESH;
+}
+
+// Returns the newest spectrum, swapping it in when one has been published since
+// the last call. The pointer stays valid until the next call.
+static inline const Spectrum *spectrum_buffer_read(SpectrumBuffer *buffer) {
+    if (atomic_load_explicit(&buffer->middle, memory_order_relaxed) & SPECTRUM_FRESH) {
+        uint32_t old = atomic_exchange_explicit(&buffer->middle, buffer->front, memory_order_acq_rel);
+        buffer->front = old & ~SPECTRUM_FRESH;
+    }
+    return &buffer->slots[buffer->front];
+}
+
+// Radix-2 FFT over split real/imaginary arrays with per-stage twiddle tables,
+// so every butterfly loop reads its inputs and twiddles contiguously.
+typedef struct {
+    float window[ANALYSIS_SIZE];     // Hann
+    float twiddle_re[ANALYSIS_SIZE]; // stage with half length h starts at index h - 1
+    float twiddle_im[ANALYSIS_SIZE];
+    uint16_t reverse[ANALYSIS_SIZE];
+    uint16_t band_start[ANALYSIS_BANDS + 1];
+
+    float re[ANALYSIS_SIZE];
+    float im[ANALYSIS_SIZE];
+
+    float input[ANALYSIS_SIZE]; // mono history, `filled` samples since the last run
+    uint32_t filled;
+    uint32_t sequence;
+} Analyzer;
+
+static inline void analyzer_init(Analyzer *analyzer, uint32_t rate) {
+    memset(analyzer, 0, sizeof(*analyzer));
+    const int n = ANALYSIS_SIZE;
+
+    int bits = 0;
+    while ((1 << bits) < n) bits++;
+    for (int i = 0; i < n; i++) {
+        int r = 0;
+        for (int b = 0; b < bits; b++) r |= ((i >> b) & 1) << (bits - 1 - b);
+        analyzer->reverse[i] = (uint16_t)r;
+        analyzer->window[i] = 0.5f - 0.5f * cosf(2.0f * (float)M_PI * i / (n - 1));
+    }
+
+    for (int half = 1; half < n; half <<= 1) {
+        for (int k = 0; k < half; k++) {
+            float angle = -(float)M_PI * k / half;
+            analyzer->twiddle_re[half - 1 + k] = cosf(angle);
+            analyzer->twiddle_im[half - 1 + k] = sinf(angle);
+        }
+    }
+
+    // bands spaced logarithmically from 40 Hz to 16 kHz (or Nyquist)
+    float low = 40.0f;
+    float high = rate / 2.0f < 16000.0f ? rate / 2.0f : 16000.0f;
+    for (int b = 0; b <= ANALYSIS_BANDS; b++) {
+        float hz = low * powf(high / low, (float)b / ANALYSIS_BANDS);
+        int bin = (int)(hz * n / rate);
+        if (bin < 1) bin = 1;
+        if (bin > n / 2) bin = n / 2;
+        if (b > 0 && bin <= analyzer->band_start[b - 1]) bin = analyzer->band_start[b - 1] + 1;
+        analyzer->band_start[b] = (uint16_t)(bin > n / 2 ? n / 2 : bin);
+    }
+}
+
+// Butterflies for one stage: for every group, a = x[j], b = x[j + half] * w,
+// x[j] = a + b, x[j + half] = a - b.
+static inline void analyzer_stage(float *re, float *im, const float *wr, const float *wi, int half, int n) {
+    for (int start = 0; start < n; start += half * 2) {
+        float *ar = re + start, *ai = im + start;
+        float *br = ar + half, *bi = ai + half;
+        int k = 0;
+#if defined(__ARM_NEON)
+        for (; k + 4 <= half; k += 4) {
+            float32x4_t xr = vld1q_f32(br + k), xi = vld1q_f32(bi + k);
+            float32x4_t cr = vld1q_f32(wr + k), ci = vld1q_f32(wi + k);
+            float32x4_t tr = vmlsq_f32(vmulq_f32(xr, cr), xi, ci);
+            float32x4_t ti = vmlaq_f32(vmulq_f32(xr, ci), xi, cr);
+            float32x4_t yr = vld1q_f32(ar + k), yi = vld1q_f32(ai + k);
+            vst1q_f32(ar + k, vaddq_f32(yr, tr));
+            vst1q_f32(ai + k, vaddq_f32(yi, ti));
+            vst1q_f32(br + k, vsubq_f32(yr, tr));
+            vst1q_f32(bi + k, vsubq_f32(yi, ti));
+        }
+#elif defined(__SSE__)
+        for (; k + 4 <= half; k += 4) {
+            __m128 xr = _mm_loadu_ps(br + k), xi = _mm_loadu_ps(bi + k);
+            __m128 cr = _mm_loadu_ps(wr + k), ci = _mm_loadu_ps(wi + k);
+            __m128 tr = _mm_sub_ps(_mm_mul_ps(xr, cr), _mm_mul_ps(xi, ci));
+            __m128 ti = _mm_add_ps(_mm_mul_ps(xr, ci), _mm_mul_ps(xi, cr));
+            __m128 yr = _mm_loadu_ps(ar + k), yi = _mm_loadu_ps(ai + k);
+            _mm_storeu_ps(ar + k, _mm_add_ps(yr, tr));
+            _mm_storeu_ps(ai + k, _mm_add_ps(yi, ti));
+            _mm_storeu_ps(br + k, _mm_sub_ps(yr, tr));
+            _mm_storeu_ps(bi + k, _mm_sub_ps(yi, ti));
+        }
+#endif
+        for (; k < half; k++) {
+            float tr = br[k] * wr[k] - bi[k] * wi[k];
+            float ti = br[k] * wi[k] + bi[k] * wr[k];
+            br[k] = ar[k] - tr;
+            bi[k] = ai[k] - ti;
+            ar[k] += tr;
+            ai[k] += ti;
+        }
+    }
+}
+
+// In-place forward FFT of analyzer->re/im.
+static inline void analyzer_fft(Analyzer *analyzer) {
+    for (int half = 1; half < ANALYSIS_SIZE; half <<= 1) {
+        analyzer_stage(analyzer->re, analyzer->im, analyzer->twiddle_re + half - 1, analyzer->twiddle_im + half - 1, half, ANALYSIS_SIZE);
+    }
+}
+
+// Windows the history, transforms it and writes bands and RMS into `out`.
+static inline void analyzer_run(Analyzer *analyzer, Spectrum *out) {
+    const int n = ANALYSIS_SIZE;
+
+    float energy = 0.0f;
+    for (int i = 0; i < n; i++) {
+        float x = analyzer->input[i];
+        energy += x * x;
+        analyzer->re[analyzer->reverse[i]] = x * analyzer->window[i];
+        analyzer->im[analyzer->reverse[i]] = 0.0f;
+    }
+    analyzer_fft(analyzer);
+
+    // a full scale sine peaks at n / 4 after the Hann window
+    const float scale = 4.0f / n;
+    for (int b = 0; b < ANALYSIS_BANDS; b++) {
+        float peak = 0.0f;
+        for (int k = analyzer->band_start[b]; k < analyzer->band_start[b + 1]; k++) {
+            float m = analyzer->re[k] * analyzer->re[k] + analyzer->im[k] * analyzer->im[k];
+            if (m > peak) peak = m;
+        }
+        float db = 10.0f * log10f(peak * scale * scale + 1e-12f);
+        float level = (db + 60.0f) / 60.0f;
+        out->bands[b] = level < 0.0f ? 0.0f : level > 1.0f ? 1.0f : level;
+    }
+
+    out->rms = sqrtf(energy / n);
+    out->sequence = ++analyzer->sequence;
+}
+
+// Feeds interleaved stereo frames, downmixed to mono. Returns true when a new
+// spectrum was written to `out`, which happens every ANALYSIS_SIZE / 2 frames.
+static inline bool analyzer_push(Analyzer *analyzer, const float *frames, uint32_t count, Spectrum *out) {
+    bool ready = false;
+    for (uint32_t i = 0; i < count; i++) {
+        analyzer->input[analyzer->filled++] = (frames[i * 2] + frames[i * 2 + 1]) * 0.5f;
+        if (analyzer->filled == ANALYSIS_SIZE) {
+            analyzer_run(analyzer, out);
+            // keep half the window for a 50% overlap
+            memmove(analyzer->input, analyzer->input + ANALYSIS_SIZE / 2, ANALYSIS_SIZE / 2 * sizeof(float));
+            analyzer->filled = ANALYSIS_SIZE / 2;
+            ready = true;
+        }
+    }
+    return ready;
+}
@@ -10,29 +10,118 @@
 #include <android/native_window.h>
 
 #include <pthread.h>
+#include <semaphore.h>
+#include <stdatomic.h>
+#include <time.h>
 
 #include <math.h>
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 
 #define MINIAUDIO_IMPLEMENTATION
 #include <miniaudio/miniaudio.h>
 
+#include <stdio.h>
+#include <sys/mman.h>
 #include <unistd.h>
 
+#include "analysis.h"
+#include "mixer.h"
+#include "output.h"
+#include "ring.h"
+#include "sound_bank.h"
+#include "telemetry.h"
+
+#define AUDIO_RING_FRAMES 8192
+#define AUDIO_RING_BURSTS 4
+#define AUDIO_CHUNK_FRAMES 256
+#define AUDIO_TAP_FRAMES 4096
+#define BLIP_SAMPLE_RATE 48000
+#define AUDIO_REPORT_SECONDS 2
+
+// Stress knobs for provoking glitches on purpose, set from the Makefile:
+// `make stress STALL_MS=40` sleeps the decoder for STALL_MS every
+// AUDIO_STALL_EVERY_MS so the ring has to ride through the gap.
+#ifndef AUDIO_STALL_MS
+#define AUDIO_STALL_MS 0
+#endif
+#define AUDIO_STALL_EVERY_MS 1000
+
 #define LOG(...) ((void)__android_log_print(ANDROID_LOG_INFO, "ENGINE", __VA_ARGS__))
 
+// Output stream, decoder thread and everything the data callback touches. It
+// follows the activity (resume, pause, destroy) rather than the window, so a
+// rotation keeps the same stream and decoder playing instead of opening new ones.
+typedef struct {
+    AAssetManager *assets;
+    pthread_t thread;
+    bool joinable;       // thread started and not joined yet, main thread only
+    atomic_bool running; // decoder thread alive, cleared to shut it down
+    atomic_bool paused;
+    atomic_bool disconnected; // set by the error callback, the stream must be reopened
+
+    AudioRing ring;
+    sem_t ring_space;
+    AudioTelemetry telemetry;
+
+    // copy of the mixed output, analysed on the decoder thread and published
+    // to the render thread
+    AudioRing tap;
+    Analyzer analyzer;
+    SpectrumBuffer spectrum;
+
+    Mixer mixer;
+    SoundBank bank;
+    // held by triggers while they pick a sound and start it, and by the decoder
+    // thread while it publishes or retires the bank, so no voice can start
+    // after mixer_clear() with a sound from a freed bank
+    pthread_mutex_t bank_mutex;
+    bool bank_ready;
+} AudioEngine;
+
 typedef struct {
     ANativeWindow *window;
     AInputQueue *input;
 
     bool running;
     pthread_t thread;
-    pthread_t audio_thread;
+
+    AudioEngine audio;
+    Sound blip;
+    int next_effect;
 } AndroidApp;
 
+int64_t monotonic_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// Short decaying sine used as the touch sound effect.
+Sound make_blip(uint32_t rate) {
+    uint32_t count = rate / 8;
+    float *frames = (float *)malloc(count * sizeof(float));
+    for (uint32_t i = 0; i < count; i++) {
+        float t = (float)i / rate;
+        frames[i] = sinf(2.0f * (float)M_PI * 880.0f * t) * expf(-t * 30.0f);
+    }
+    return (Sound){.frames = frames, .count = count, .channels = 1, .rate = rate};
+}
+
+// Plays the next effect of the sound bank, or `fallback` until the bank is
+// loaded. Called from the render thread, never from the audio callback.
+int audio_engine_play_effect(AudioEngine *engine, int *next_effect, const Sound *fallback, float pan) {
+    pthread_mutex_lock(&engine->bank_mutex);
+    const Sound *sound = fallback;
+    if (engine->bank_ready && engine->bank.count > 0) sound = &engine->bank.sounds[(*next_effect)++ % engine->bank.count];
+    int handle = mixer_play(&engine->mixer, sound, 0.8f, pan, false);
+    pthread_mutex_unlock(&engine->bank_mutex);
+    return handle;
+}
+
 void *render_task(void *arg) {
     AndroidApp *app = (AndroidApp *)arg;
 
@@ -53,20 +142,48 @@ void *render_task(void *arg) {
     glViewport(0, 0, width, height);
 
     float dt = 0.0f;
+    float levels[ANALYSIS_BANDS] = {0};
+    float rms = 0.0f;
 
     while (app->running) {
         AInputEvent *event = NULL;
         while (AInputQueue_getEvent(app->input, &event) >= 0) {
             if (AInputQueue_preDispatchEvent(app->input, event)) continue;
-            AInputQueue_finishEvent(app->input, event, 0);
+
+            int handled = 0;
+            if (AInputEvent_getType(event) == AINPUT_EVENT_TYPE_MOTION && (AMotionEvent_getAction(event) & AMOTION_EVENT_ACTION_MASK) == AMOTION_EVENT_ACTION_DOWN) {
+                float pan = AMotionEvent_getX(event, 0) / width * 2.0f - 1.0f;
+                audio_engine_play_effect(&app->audio, &app->next_effect, &app->blip, pan);
+                handled = 1;
+            }
+            AInputQueue_finishEvent(app->input, event, handled);
         }
 
+        // bars jump up with the spectrum and fall back slowly; the background
+        // brightness follows the RMS level
+        const Spectrum *spectrum = spectrum_buffer_read(&app->audio.spectrum);
+        for (int i = 0; i < ANALYSIS_BANDS; i++) levels[i] = fmaxf(spectrum->bands[i], levels[i] * 0.92f);
+        rms = fmaxf(spectrum->rms, rms * 0.95f);
+
         float r = (sinf(dt + 0) * 0.5f) + 0.5f;
         float g = (cosf(dt + 0) * 0.5f) + 0.5f;
         float b = (sinf(dt + 3) * 0.5f) + 0.5f;
+        float level = fminf(rms * 2.0f, 1.0f) * 0.5f;
 
-        glClearColor(r, g, b, 1.0f);
+        glDisable(GL_SCISSOR_TEST);
+        glClearColor(r * level, g * level, b * level, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+        glEnable(GL_SCISSOR_TEST);
+        glClearColor(r, g, b, 1.0f);
+        for (int i = 0; i < ANALYSIS_BANDS; i++) {
+            int x = i * width / ANALYSIS_BANDS;
+            int w = (i + 1) * width / ANALYSIS_BANDS - x - 2;
+            int h = (int)(levels[i] * height);
+            if (w <= 0 || h <= 0) continue;
+            glScissor(x, 0, w, h);
+            glClear(GL_COLOR_BUFFER_BIT);
+        }
         eglSwapBuffers(egl_display, egl_surface);
 
         dt += 0.01f;
@@ -80,92 +197,422 @@ void *render_task(void *arg) {
     return NULL;
 }
 
-void *audio_task(void *arg) {
-    ANativeActivity *activity = (ANativeActivity *)arg;
-    AndroidApp *app = activity->instance;
-    AAsset *asset = AAssetManager_open(activity->assetManager, "file.wav", AASSET_MODE_UNKNOWN);
-    if (!asset) {
-        LOG("cannot load file.wav");
-        exit(0);
-    }
+typedef struct {
+    AAsset *asset;
+    void *map;
+    size_t map_size;
+    ma_decoder decoder;
+} AudioSource;
 
-    int64_t size = AAsset_getLength(asset);
-    uint8_t *buffer = (uint8_t *)malloc(size);
+ma_result asset_read(ma_decoder *decoder, void *buffer, size_t bytes_to_read, size_t *bytes_read) {
+    int ret = AAsset_read((AAsset *)decoder->pUserData, buffer, bytes_to_read);
+    if (ret < 0) return MA_ERROR;
 
-    if (AAsset_read(asset, buffer, size) < 0) {
-        LOG("cannot read file.wav");
-        exit(0);
+    *bytes_read = ret;
+    return ret == 0 && bytes_to_read > 0 ? MA_AT_END : MA_SUCCESS;
+}
+
+ma_result asset_seek(ma_decoder *decoder, ma_int64 offset, ma_seek_origin origin) {
+    int whence = origin == ma_seek_origin_start ? SEEK_SET : origin == ma_seek_origin_end ? SEEK_END : SEEK_CUR;
+    return AAsset_seek64((AAsset *)decoder->pUserData, offset, whence) < 0 ? MA_ERROR : MA_SUCCESS;
+}
+
+// Opens an asset for decoding without reading it into memory. Uncompressed
+// assets are mapped straight from the APK, so their pages come from the page
+// cache on demand; compressed assets are streamed through AAsset_read.
+bool audio_source_open(AudioSource *source, AAssetManager *manager, const char *path, const ma_decoder_config *config) {
+    memset(source, 0, sizeof(*source));
+
+    source->asset = AAssetManager_open(manager, path, AASSET_MODE_STREAMING);
+    if (!source->asset) {
+        LOG("cannot open %s", path);
+        return false;
     }
 
     int ret;
 
-    ma_decoder decoder;
-    ma_decoder_config config = ma_decoder_config_init(ma_format_f32, 2, 44100);
+    off64_t start, length;
+    int fd = AAsset_openFileDescriptor64(source->asset, &start, &length);
+    if (fd >= 0) {
+        long page = sysconf(_SC_PAGESIZE);
+        off64_t aligned = start & ~(off64_t)(page - 1);
+        source->map_size = length + (start - aligned);
+        source->map = mmap(NULL, source->map_size, PROT_READ, MAP_PRIVATE, fd, aligned);
+        close(fd);
+
+        if (source->map == MAP_FAILED) {
+            source->map = NULL;
+        } else {
+            madvise(source->map, source->map_size, MADV_SEQUENTIAL);
+            if ((ret = ma_decoder_init_memory((uint8_t *)source->map + (start - aligned), length, config, &source->decoder)) == MA_SUCCESS) {
+                LOG("%s: mapped %ld bytes", path, (long)length);
+                return true;
+            }
+            LOG("cannot initialize decoder from mapping: %s", ma_result_description(ret));
+            munmap(source->map, source->map_size);
+            source->map = NULL;
+        }
+    }
 
-    if ((ret = ma_decoder_init_memory(buffer, size, &config, &decoder)) != MA_SUCCESS) {
+    if ((ret = ma_decoder_init(asset_read, asset_seek, source->asset, config, &source->decoder)) != MA_SUCCESS) {
         LOG("cannot initialize decoder %s", ma_result_description(ret));
-        free(buffer);
-        AAsset_close(asset);
-        exit(0);
+        AAsset_close(source->asset);
+        source->asset = NULL;
+        return false;
     }
 
-    AAudioStream *stream = NULL;
+    LOG("%s: streaming", path);
+    return true;
+}
+
+void audio_source_close(AudioSource *source) {
+    ma_decoder_uninit(&source->decoder);
+    if (source->map) munmap(source->map, source->map_size);
+    if (source->asset) AAsset_close(source->asset);
+    memset(source, 0, sizeof(*source));
+}
+
+// SoundBankLoader over the APK's assets; the decoder lives in a heap
+// AudioSource so it can be closed from any loading thread.
+ma_decoder *asset_decoder_open(void *context, const char *path, const ma_decoder_config *config) {
+    AudioSource *source = (AudioSource *)malloc(sizeof(AudioSource));
+    if (!source) return NULL;
+    if (!audio_source_open(source, (AAssetManager *)context, path, config)) {
+        free(source);
+        return NULL;
+    }
+    return &source->decoder;
+}
+
+void asset_decoder_close(void *context, ma_decoder *decoder) {
+    (void)context;
+    AudioSource *source = (AudioSource *)((char *)decoder - offsetof(AudioSource, decoder));
+    audio_source_close(source);
+    free(source);
+}
+
+// Resident set size in KiB, for reporting memory use.
+long resident_kib(void) {
+    long pages = 0;
+    FILE *file = fopen("/proc/self/statm", "r");
+    if (file) {
+        if (fscanf(file, "%*s %ld", &pages) != 1) pages = 0;
+        fclose(file);
+    }
+    return pages * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+// Runs on the AAudio real-time thread: no locks, no allocation, no logging.
+aaudio_data_callback_result_t audio_callback(AAudioStream *stream, void *user_data, void *audio_data, int32_t num_frames) {
+    (void)stream;
+    AudioEngine *engine = (AudioEngine *)user_data;
+    float *out = (float *)audio_data;
+    int64_t start = monotonic_ns();
+
+    uint32_t fill;
+    bool underrun = audio_output_render(&engine->ring, &engine->mixer, &engine->tap, out, num_frames, &fill);
+
+    sem_post(&engine->ring_space);
+    audio_telemetry_callback(&engine->telemetry, monotonic_ns() - start, fill, underrun);
+    return AAUDIO_CALLBACK_RESULT_CONTINUE;
+}
+
+// Runs on a thread owned by AAudio, which must not close the stream from here.
+// A disconnect (headphones unplugged, Bluetooth route change) only flags the
+// stream and wakes the decoder thread, which reopens it on the new device.
+void audio_error_callback(AAudioStream *stream, void *user_data, aaudio_result_t error) {
+    (void)stream;
+    AudioEngine *engine = (AudioEngine *)user_data;
+    LOG("stream error: %s", AAudio_convertResultToText(error));
+    if (error == AAUDIO_ERROR_DISCONNECTED) {
+        atomic_store(&engine->disconnected, true);
+        sem_post(&engine->ring_space);
+    }
+}
+
+// Opens the low-latency output stream with the buffer sized to two bursts.
+// `rate` 0 opens it at the device's native rate; a reopen passes the rate in
+// use so the decoder, mixer and sound bank stay valid, and AAudio resamples if
+// the new device runs at another one. Returns NULL on failure.
+AAudioStream *audio_stream_open(AudioEngine *engine, int32_t rate) {
+    int ret;
+
     AAudioStreamBuilder *builder;
     if ((ret = AAudio_createStreamBuilder(&builder)) != AAUDIO_OK) {
         LOG("cannot create stream builder: %s", AAudio_convertResultToText(ret));
-        exit(0);
+        return NULL;
     }
 
     AAudioStreamBuilder_setFormat(builder, AAUDIO_FORMAT_PCM_FLOAT);
     AAudioStreamBuilder_setChannelCount(builder, 2);
-    AAudioStreamBuilder_setSampleRate(builder, 44100);
+    AAudioStreamBuilder_setSampleRate(builder, rate);
+    AAudioStreamBuilder_setPerformanceMode(builder, AAUDIO_PERFORMANCE_MODE_LOW_LATENCY);
+    AAudioStreamBuilder_setSharingMode(builder, AAUDIO_SHARING_MODE_EXCLUSIVE);
+    AAudioStreamBuilder_setDataCallback(builder, audio_callback, engine);
+    AAudioStreamBuilder_setErrorCallback(builder, audio_error_callback, engine);
 
-    if ((ret = AAudioStreamBuilder_openStream(builder, &stream)) != AAUDIO_OK) {
+    AAudioStream *stream = NULL;
+    ret = AAudioStreamBuilder_openStream(builder, &stream);
+    AAudioStreamBuilder_delete(builder);
+    if (ret != AAUDIO_OK) {
         LOG("cannot open stream: %s", AAudio_convertResultToText(ret));
-        AAudioStreamBuilder_delete(builder);
-        exit(0);
+        return NULL;
     }
 
-    if ((ret = AAudioStream_requestStart(stream)) != AAUDIO_OK) {
-        LOG("cannot start stream: %s", AAudio_convertResultToText(ret));
-        AAudioStream_close(stream);
-        AAudioStreamBuilder_delete(builder);
+    // Keep two bursts in the device buffer (double buffering) so new audio
+    // reaches the speaker quickly.
+    AAudioStream_setBufferSizeInFrames(stream, AAudioStream_getFramesPerBurst(stream) * 2);
+    LOG("stream: %d Hz | %d channels | burst %d | buffer %d | sharing %s | performance mode %d", AAudioStream_getSampleRate(stream), AAudioStream_getChannelCount(stream), AAudioStream_getFramesPerBurst(stream), AAudioStream_getBufferSizeInFrames(stream), AAudioStream_getSharingMode(stream) == AAUDIO_SHARING_MODE_EXCLUSIVE ? "exclusive" : "shared", AAudioStream_getPerformanceMode(stream));
+    return stream;
+}
+
+// Decoded frames kept ahead in the ring: a few bursts, so little audio is
+// queued in front of the speaker.
+uint32_t audio_ring_target(AudioEngine *engine, AAudioStream *stream) {
+    uint32_t target = AAudioStream_getFramesPerBurst(stream) * AUDIO_RING_BURSTS;
+    return target < engine->ring.capacity ? target : engine->ring.capacity;
+}
+
+// Estimated time from writing the next frame until it leaves the speaker,
+// derived from the last presented frame. Returns -1 while the stream has no
+// timestamp yet (it takes a few bursts after start).
+double output_latency_ms(AAudioStream *stream, int32_t rate) {
+    int64_t position, time_ns;
+    if (AAudioStream_getTimestamp(stream, CLOCK_MONOTONIC, &position, &time_ns) != AAUDIO_OK) return -1.0;
+
+    int64_t written = AAudioStream_getFramesWritten(stream);
+    int64_t presentation_ns = time_ns + (written - position) * 1000000000 / rate;
+    return (presentation_ns - monotonic_ns()) / 1e6;
+}
+
+// Logs and resets the callback counters. Returns the underruns in the interval.
+uint32_t audio_report(AudioEngine *engine, AAudioStream *stream, int32_t rate) {
+    AudioTelemetryWindow window;
+    audio_telemetry_take(&engine->telemetry, &window);
+
+    char histogram[160];
+    audio_telemetry_histogram(&window, histogram, sizeof(histogram));
+
+    uint32_t fill = audio_ring_available(&engine->ring);
+    LOG("audio: xruns %d | underruns %u/%u callbacks | ring %u (min %u) frames | latency %.1f ms + %.1f ms ring", AAudioStream_getXRunCount(stream), window.underruns, window.callbacks, fill, window.min_fill == UINT32_MAX ? 0 : window.min_fill, output_latency_ms(stream, rate), fill * 1000.0 / rate);
+    LOG("audio: callback max %.0f us | %s", window.max_ns / 1e3, histogram);
+    return window.underruns;
+}
+
+void *audio_task(void *arg) {
+    AudioEngine *engine = (AudioEngine *)arg;
+    int64_t open_time = monotonic_ns();
+    long open_rss = resident_kib();
+
+    int ret;
+
+    if (!audio_ring_init(&engine->ring, AUDIO_RING_FRAMES, 2) || !audio_ring_init(&engine->tap, AUDIO_TAP_FRAMES, 2)) {
+        LOG("cannot allocate audio ring");
         exit(0);
     }
 
-    float audio_buffer[1024 * 2];
-    ma_uint64 frames_read;
+    // The sample rate is left unspecified so the stream opens at the device's
+    // native rate; everything is then decoded or resampled once, directly to it,
+    // instead of again in the system mixer.
+    atomic_store(&engine->disconnected, false);
+    AAudioStream *stream = audio_stream_open(engine, AAUDIO_UNSPECIFIED);
+    if (!stream) exit(0);
+    uint32_t target = audio_ring_target(engine, stream);
+    int32_t rate = AAudioStream_getSampleRate(stream);
+
+    AudioSource source;
+    ma_decoder_config config = ma_decoder_config_init(ma_format_f32, 2, rate);
+    if (!audio_source_open(&source, engine->assets, "file.wav", &config)) exit(0);
+    ma_decoder *decoder = &source.decoder;
+
+    ma_uint32 source_rate = 0;
+    ma_data_source_get_data_format(decoder->pBackend, NULL, NULL, &source_rate, NULL, 0);
+    if (source_rate == (ma_uint32)rate) {
+        LOG("file.wav: %u Hz, native to the device, no resampling", source_rate);
+    } else {
+        LOG("file.wav: %u Hz, resampled once to %d Hz in the decoder", source_rate, rate);
+    }
 
-    while (app->running) {
-        ret = ma_decoder_read_pcm_frames(&decoder, audio_buffer, 1024, &frames_read);
-        if (ret == MA_AT_END) {
-            if ((ret = ma_decoder_seek_to_pcm_frame(&decoder, 0)) != MA_SUCCESS) {
-                LOG("cannot reset decoder: %s", ma_result_description(ret));
+    mixer_set_rate(&engine->mixer, rate);
+    analyzer_init(&engine->analyzer, rate);
+
+    const char *effects[] = {"tap.wav", "pop.wav", "click.wav"};
+    SoundBankLoader loader = {.context = engine->assets, .open = asset_decoder_open, .close = asset_decoder_close};
+    sound_bank_load(&engine->bank, &loader, effects, sizeof(effects) / sizeof(effects[0]), rate);
+    pthread_mutex_lock(&engine->bank_mutex);
+    engine->bank_ready = true;
+    pthread_mutex_unlock(&engine->bank_mutex);
+
+    float audio_buffer[AUDIO_CHUNK_FRAMES * 2];
+    float tap_buffer[AUDIO_CHUNK_FRAMES * 2];
+    ma_uint64 frames_read = 0;
+    ma_uint64 frames_written = 0;
+
+    // prime the ring so the first callbacks do not underrun
+    bool started = false;
+    bool stream_paused = false;
+    int64_t report_time = 0;
+    int64_t stall_time = 0;
+    uint32_t underruns = 0;
+
+    while (atomic_load(&engine->running)) {
+        // the ring, decoder and voices carry over, so the new stream starts
+        // with whatever was already buffered for the old one
+        if (atomic_exchange(&engine->disconnected, false)) {
+            LOG("stream: disconnected, reopening with %u frames buffered", audio_ring_available(&engine->ring));
+            AAudioStream_requestStop(stream);
+            underruns += audio_report(engine, stream, rate);
+            AAudioStream_close(stream);
+            if (!(stream = audio_stream_open(engine, rate))) break;
+            target = audio_ring_target(engine, stream);
+            started = false;
+            stream_paused = false;
+            continue;
+        }
+
+        // pause and resume only touch the stream; the ring and decoder keep
+        // their position, so playback resumes without priming again
+        bool paused = atomic_load(&engine->paused);
+        if (started && paused != stream_paused) {
+            ret = paused ? AAudioStream_requestPause(stream) : AAudioStream_requestStart(stream);
+            if (ret != AAUDIO_OK) LOG("cannot %s stream: %s", paused ? "pause" : "resume", AAudio_convertResultToText(ret));
+            stream_paused = paused;
+            LOG("stream: %s with %u frames buffered", paused ? "paused" : "resumed", audio_ring_available(&engine->ring));
+        }
+        if (stream_paused) {
+            sem_wait(&engine->ring_space);
+            continue;
+        }
+
+        // whatever the callback played since the last pass
+        uint32_t tapped;
+        bool analysed = false;
+        while ((tapped = audio_ring_read(&engine->tap, tap_buffer, AUDIO_CHUNK_FRAMES)) > 0) {
+            analysed |= analyzer_push(&engine->analyzer, tap_buffer, tapped, spectrum_buffer_back(&engine->spectrum));
+        }
+        if (analysed) spectrum_buffer_publish(&engine->spectrum);
+
+        int64_t now = monotonic_ns();
+        if (started && now - report_time >= AUDIO_REPORT_SECONDS * 1000000000LL) {
+            underruns += audio_report(engine, stream, rate);
+            report_time = now;
+        }
+
+        if (AUDIO_STALL_MS > 0 && started && now - stall_time >= AUDIO_STALL_EVERY_MS * 1000000LL) {
+            LOG("stall: decoder sleeping %d ms with %u frames buffered", AUDIO_STALL_MS, audio_ring_available(&engine->ring));
+            usleep(AUDIO_STALL_MS * 1000);
+            stall_time = monotonic_ns();
+        }
+
+        if (frames_written == frames_read) {
+            ret = ma_decoder_read_pcm_frames(decoder, audio_buffer, AUDIO_CHUNK_FRAMES, &frames_read);
+            frames_written = 0;
+            if (ret == MA_AT_END) {
+                if ((ret = ma_decoder_seek_to_pcm_frame(decoder, 0)) != MA_SUCCESS) {
+                    LOG("cannot reset decoder: %s", ma_result_description(ret));
+                    break;
+                }
+                continue;
+            }
+
+            if (ret != MA_SUCCESS) {
+                LOG("cannot read PCM frames: %s", ma_result_description(ret));
                 break;
             }
+        }
+
+        uint32_t space = target > audio_ring_available(&engine->ring) ? target - audio_ring_available(&engine->ring) : 0;
+        if (space > 0) {
+            uint32_t count = (uint32_t)(frames_read - frames_written);
+            if (count > space) count = space;
+            frames_written += audio_ring_write(&engine->ring, audio_buffer + frames_written * 2, count);
             continue;
         }
 
-        if (ret != MA_SUCCESS) {
-            LOG("cannot read PCM frames: %s", ma_result_description(ret));
-            break;
+        if (!started && !paused) {
+            if ((ret = AAudioStream_requestStart(stream)) != AAUDIO_OK) {
+                LOG("cannot start stream: %s", AAudio_convertResultToText(ret));
+                break;
+            }
+            started = true;
+            report_time = stall_time = monotonic_ns();
+            LOG("startup: %.2f ms | rss %ld KiB (+%ld KiB)", (monotonic_ns() - open_time) / 1e6, resident_kib(), resident_kib() - open_rss);
         }
 
-        if ((ret = AAudioStream_write(stream, audio_buffer, frames_read, INT64_MAX)) < 0) {
-            LOG("cannot write stream: %s", AAudio_convertResultToText(ret));
-            break;
+        // the callback posts after every burst it consumes
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        ts.tv_nsec += 20 * 1000 * 1000;
+        if (ts.tv_nsec >= 1000 * 1000 * 1000) {
+            ts.tv_sec++;
+            ts.tv_nsec -= 1000 * 1000 * 1000;
         }
+        sem_timedwait(&engine->ring_space, &ts);
     }
 
-    AAudioStream_requestStop(stream);
-    AAudioStream_close(stream);
-    AAudioStreamBuilder_delete(builder);
-    ma_decoder_uninit(&decoder);
-    free(buffer);
-    AAsset_close(asset);
+    if (stream) {
+        AAudioStream_requestStop(stream);
+        underruns += audio_report(engine, stream, rate);
+        LOG("stream: %u underruns | %d xruns", underruns, AAudioStream_getXRunCount(stream));
+        AAudioStream_close(stream);
+    }
+
+    // once a zero rate is set under the lock no trigger can start a voice, so
+    // the voices can be released and the bank freed under them
+    pthread_mutex_lock(&engine->bank_mutex);
+    engine->bank_ready = false;
+    mixer_set_rate(&engine->mixer, 0);
+    pthread_mutex_unlock(&engine->bank_mutex);
+    mixer_clear(&engine->mixer);
+    sound_bank_free(&engine->bank);
+    audio_ring_destroy(&engine->ring);
+    audio_ring_destroy(&engine->tap);
+    audio_source_close(&source);
+
+    // also reached when the stream failed to open or start, so the next
+    // audio_engine_start() starts over instead of resuming a dead thread
+    atomic_store(&engine->running, false);
     return NULL;
 }
 
+// Starts the decoder thread and stream on first use, otherwise resumes the
+// paused stream.
+void audio_engine_start(AudioEngine *engine, AAssetManager *assets) {
+    atomic_store(&engine->paused, false);
+    if (atomic_load(&engine->running)) {
+        sem_post(&engine->ring_space);
+        return;
+    }
+
+    // the previous thread gave up on its own after an error
+    if (engine->joinable) {
+        pthread_join(engine->thread, NULL);
+        sem_destroy(&engine->ring_space);
+        engine->joinable = false;
+    }
+
+    engine->assets = assets;
+    sem_init(&engine->ring_space, 0, 0);
+    audio_telemetry_init(&engine->telemetry);
+    atomic_store(&engine->running, true);
+    engine->joinable = pthread_create(&engine->thread, NULL, audio_task, engine) == 0;
+    if (!engine->joinable) atomic_store(&engine->running, false);
+}
+
+void audio_engine_pause(AudioEngine *engine) {
+    if (!atomic_load(&engine->running)) return;
+    atomic_store(&engine->paused, true);
+}
+
+void audio_engine_stop(AudioEngine *engine) {
+    if (!engine->joinable) return;
+    atomic_store(&engine->running, false);
+    sem_post(&engine->ring_space);
+    pthread_join(engine->thread, NULL);
+    sem_destroy(&engine->ring_space);
+    engine->joinable = false;
+}
+
 void on_window_init(ANativeActivity *activity, ANativeWindow *window) {
     LOG("on_window_init");
 
@@ -174,7 +621,6 @@ void on_window_init(ANativeActivity *activity, ANativeWindow *window) {
     app->running = true;
 
     pthread_create(&app->thread, NULL, render_task, app);
-    pthread_create(&app->audio_thread, NULL, audio_task, activity);
 }
 
 void on_window_deinit(ANativeActivity *activity, ANativeWindow *window) {
@@ -198,13 +644,41 @@ void on_input_deinit(ANativeActivity *activity, AInputQueue *input) {
     app->input = NULL;
 }
 
+void on_resume(ANativeActivity *activity) {
+    AndroidApp *app = (AndroidApp *)activity->instance;
+    audio_engine_start(&app->audio, activity->assetManager);
+}
+
+void on_pause(ANativeActivity *activity) {
+    AndroidApp *app = (AndroidApp *)activity->instance;
+    audio_engine_pause(&app->audio);
+}
+
+void on_destroy(ANativeActivity *activity) {
+    LOG("on_destroy");
+
+    AndroidApp *app = (AndroidApp *)activity->instance;
+    audio_engine_stop(&app->audio);
+    pthread_mutex_destroy(&app->audio.bank_mutex);
+    free((void *)app->blip.frames);
+    free(app);
+    activity->instance = NULL;
+}
+
 JNIEXPORT void ANativeActivity_onCreate(ANativeActivity *activity, void *savedState, size_t savedStateSize) {
     AndroidApp *app = (AndroidApp *)malloc(sizeof(AndroidApp));
     memset(app, 0, sizeof(AndroidApp));
+    mixer_init(&app->audio.mixer, 0);
+    pthread_mutex_init(&app->audio.bank_mutex, NULL);
+    spectrum_buffer_init(&app->audio.spectrum);
+    app->blip = make_blip(BLIP_SAMPLE_RATE);
 
     activity->callbacks->onNativeWindowCreated = on_window_init;
     activity->callbacks->onNativeWindowDestroyed = on_window_deinit;
     activity->callbacks->onInputQueueCreated = on_input_init;
     activity->callbacks->onInputQueueDestroyed = on_input_deinit;
+    activity->callbacks->onResume = on_resume;
+    activity->callbacks->onPause = on_pause;
+    activity->callbacks->onDestroy = on_destroy;
     activity->instance = app;
 }
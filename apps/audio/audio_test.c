@@ -0,0 +1,335 @@
+// Host test of the decoder ring and the data callback (output.h) against a
+// fake device that pulls one burst per period on a simulated clock, e.g.
+//
+//     make test
+//
+// The producer side follows audio_task: it keeps AUDIO_RING_BURSTS bursts
+// decoded ahead and sleeps until a callback posts, waking `latency` later.
+// Decoded frames are a ramp, so every output frame can be checked in order.
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "output.h"
+
+#define AUDIO_RING_FRAMES 8192
+#define AUDIO_RING_BURSTS 4
+#define AUDIO_CHUNK_FRAMES 256
+#define AUDIO_WAIT_NS 20000000 // audio_task's sem_timedwait
+
+static int failures;
+
+#define CHECK(cond)                                                            \
+    do {                                                                       \
+        if (!(cond)) {                                                         \
+            fprintf(stderr, "%s:%d: %s: %s\n", __FILE__, __LINE__, __func__, #cond); \
+            failures++;                                                        \
+        }                                                                      \
+    } while (0)
+
+// Left channel of decoded frame n; the right one is its negation. Both are
+// exact in float, so mixing a voice on top can be checked with ==.
+static float ramp(uint64_t n) { return (float)(n & 0xffff) * (1.0f / 65536.0f); }
+
+typedef struct {
+    uint32_t rate;
+    uint32_t burst;
+    int64_t latency_ns;  // producer wake-up after a callback posts
+    int64_t stall_at_ns; // producer sleeps through [stall_at, stall_at + stall)
+    int64_t stall_ns;
+    int64_t duration_ns;
+} FakeDevice;
+
+typedef struct {
+    uint32_t callbacks;
+    uint32_t underruns;
+    int64_t first_underrun_ns;
+    int64_t last_underrun_ns;
+    uint64_t frames; // ramp frames played
+    uint64_t silent; // frames zero-filled on underruns
+    uint32_t gaps;   // ramp frames out of order or changed
+} FakeResult;
+
+typedef struct {
+    AudioRing ring;
+    AudioRing tap;
+    Mixer mixer;
+    uint64_t decoded; // next ramp frame the producer writes
+} Pipeline;
+
+static void pipeline_init(Pipeline *pipeline, uint32_t rate) {
+    CHECK(audio_ring_init(&pipeline->ring, AUDIO_RING_FRAMES, 2));
+    CHECK(audio_ring_init(&pipeline->tap, AUDIO_RING_FRAMES, 2));
+    mixer_init(&pipeline->mixer, rate);
+    pipeline->decoded = 0;
+}
+
+static void pipeline_destroy(Pipeline *pipeline) {
+    audio_ring_destroy(&pipeline->ring);
+    audio_ring_destroy(&pipeline->tap);
+}
+
+// One producer pass: decode in chunks until the ring holds `target` frames.
+static void pipeline_fill(Pipeline *pipeline, uint32_t target) {
+    float chunk[AUDIO_CHUNK_FRAMES * 2];
+    while (audio_ring_available(&pipeline->ring) < target) {
+        uint32_t count = target - audio_ring_available(&pipeline->ring);
+        if (count > AUDIO_CHUNK_FRAMES) count = AUDIO_CHUNK_FRAMES;
+        for (uint32_t i = 0; i < count; i++) {
+            chunk[i * 2 + 0] = ramp(pipeline->decoded + i);
+            chunk[i * 2 + 1] = -ramp(pipeline->decoded + i);
+        }
+        pipeline->decoded += audio_ring_write(&pipeline->ring, chunk, count);
+    }
+}
+
+// Checks one callback's output: the `fill` frames the ring had continue the
+// ramp, the rest are silence, and the tap holds an exact copy. `voice` is
+// added to the left channel of the first `voice_frames` frames.
+static void check_output(FakeResult *result, AudioRing *tap, const float *out, uint32_t frames, uint32_t fill, float voice, uint32_t voice_frames) {
+    float copy[AUDIO_RING_FRAMES * 2];
+    CHECK(audio_ring_read(tap, copy, frames) == frames);
+    CHECK(memcmp(copy, out, frames * 2 * sizeof(float)) == 0);
+
+    for (uint32_t i = 0; i < frames; i++) {
+        float add = i < voice_frames ? voice : 0.0f;
+        float left = out[i * 2 + 0], right = out[i * 2 + 1];
+        if (i >= fill) {
+            if (left != add || right != 0.0f) result->gaps++;
+            result->silent++;
+            continue;
+        }
+
+        float expected = ramp(result->frames) + add;
+        if (expected > 1.0f) expected = 1.0f;
+        if (left != expected || right != -ramp(result->frames)) result->gaps++;
+        result->frames++;
+    }
+}
+
+// Runs the device for `duration_ns` of simulated time. The first callback comes
+// once the producer has primed the ring, as audio_task starts the stream.
+static FakeResult fake_device_run(const FakeDevice *device) {
+    Pipeline pipeline;
+    pipeline_init(&pipeline, device->rate);
+
+    uint32_t target = device->burst * AUDIO_RING_BURSTS;
+    int64_t period = (int64_t)device->burst * 1000000000 / device->rate;
+    int64_t next_callback = period;
+    int64_t next_wake = 0;
+    float out[AUDIO_RING_FRAMES * 2];
+    FakeResult result = {0};
+
+    while (next_callback < device->duration_ns) {
+        if (next_wake < next_callback) {
+            int64_t now = next_wake;
+            if (device->stall_ns > 0 && now >= device->stall_at_ns && now < device->stall_at_ns + device->stall_ns) {
+                next_wake = device->stall_at_ns + device->stall_ns;
+                continue;
+            }
+            pipeline_fill(&pipeline, target);
+            next_wake = now + AUDIO_WAIT_NS;
+            continue;
+        }
+
+        int64_t now = next_callback;
+        uint32_t fill;
+        bool underrun = audio_output_render(&pipeline.ring, &pipeline.mixer, &pipeline.tap, out, device->burst, &fill);
+        CHECK(fill <= target);
+        if (underrun) {
+            if (!result.underruns) result.first_underrun_ns = now;
+            result.last_underrun_ns = now;
+            result.underruns++;
+        }
+        result.callbacks++;
+        check_output(&result, &pipeline.tap, out, device->burst, fill, 0.0f, 0);
+
+        // the callback posts the semaphore; the producer runs `latency` later
+        if (now + device->latency_ns < next_wake) next_wake = now + device->latency_ns;
+        next_callback += period;
+    }
+
+    pipeline_destroy(&pipeline);
+    return result;
+}
+
+static void test_steady(void) {
+    uint32_t rates[] = {48000, 44100, 48000};
+    uint32_t bursts[] = {192, 441, 96};
+    for (int i = 0; i < 3; i++) {
+        FakeDevice device = {.rate = rates[i], .burst = bursts[i], .latency_ns = 2000000, .duration_ns = 10000000000LL};
+        FakeResult result = fake_device_run(&device);
+        CHECK(result.callbacks == (uint32_t)(device.duration_ns / ((int64_t)device.burst * 1000000000 / device.rate)) - 1);
+        CHECK(result.underruns == 0);
+        CHECK(result.gaps == 0);
+        CHECK(result.frames == (uint64_t)result.callbacks * device.burst);
+        CHECK(result.silent == 0);
+    }
+}
+
+// A producer waking up to three bursts late is still covered by the ring.
+static void test_late_wakeup(void) {
+    FakeDevice device = {.rate = 48000, .burst = 192, .latency_ns = 3 * 4000000 - 1, .duration_ns = 5000000000LL};
+    FakeResult result = fake_device_run(&device);
+    CHECK(result.underruns == 0);
+    CHECK(result.gaps == 0);
+}
+
+// A 40 ms decoder stall (`make stress`) drains the four bursts in the ring:
+// the callback plays silence for the rest, then picks the ramp up where it
+// stopped, nothing dropped or repeated.
+static void test_stall(void) {
+    FakeDevice device = {.rate = 48000, .burst = 192, .latency_ns = 1000000, .stall_at_ns = 1000000000LL, .stall_ns = 40000000, .duration_ns = 3000000000LL};
+    FakeResult result = fake_device_run(&device);
+
+    int64_t period = 4000000;
+    CHECK(result.underruns >= 40000000 / period - AUDIO_RING_BURSTS - 1);
+    CHECK(result.underruns <= 40000000 / period - AUDIO_RING_BURSTS + 1);
+    CHECK(result.first_underrun_ns > device.stall_at_ns);
+    CHECK(result.last_underrun_ns <= device.stall_at_ns + device.stall_ns + period);
+    CHECK(result.gaps == 0);
+    CHECK(result.silent > 0 && result.silent <= (uint64_t)result.underruns * device.burst);
+    CHECK(result.frames + result.silent == (uint64_t)result.callbacks * device.burst);
+}
+
+// A voice triggered between two callbacks is in the very next one, from its
+// first frame, and stops after exactly its length; the ring plays on under it.
+static void test_trigger(void) {
+    Pipeline pipeline;
+    pipeline_init(&pipeline, 48000);
+
+    float frames[480 * 2];
+    for (int i = 0; i < 480 * 2; i++) frames[i] = 0.25f;
+    Sound sound = {.frames = frames, .count = 480, .channels = 2, .rate = 48000};
+
+    uint32_t burst = 192;
+    float out[AUDIO_RING_FRAMES * 2];
+    FakeResult result = {0};
+    uint32_t fill;
+
+    for (int i = 0; i < 10; i++) {
+        pipeline_fill(&pipeline, burst * AUDIO_RING_BURSTS);
+        CHECK(!audio_output_render(&pipeline.ring, &pipeline.mixer, &pipeline.tap, out, burst, &fill));
+        check_output(&result, &pipeline.tap, out, burst, fill, 0.0f, 0);
+    }
+
+    // hard left, so only the left channel carries it
+    CHECK(mixer_play(&pipeline.mixer, &sound, 1.0f, -1.0f, false) >= 0);
+    uint32_t remaining = sound.count;
+    for (int i = 0; i < 10; i++) {
+        pipeline_fill(&pipeline, burst * AUDIO_RING_BURSTS);
+        CHECK(!audio_output_render(&pipeline.ring, &pipeline.mixer, &pipeline.tap, out, burst, &fill));
+        uint32_t voiced = remaining < burst ? remaining : burst;
+        check_output(&result, &pipeline.tap, out, burst, fill, 0.25f, voiced);
+        remaining -= voiced;
+    }
+    CHECK(result.gaps == 0);
+    CHECK(result.frames == 20 * burst);
+    CHECK(atomic_load(&pipeline.mixer.voices[0].state) == VOICE_FREE);
+
+    pipeline_destroy(&pipeline);
+}
+
+// Handles stay non-negative and keep stopping the right voice as the
+// generation counter passes 23 bits and wraps around 32.
+static void test_handles(void) {
+    static Mixer mixer;
+    mixer_init(&mixer, 48000);
+    float frames[64] = {0};
+    Sound sound = {.frames = frames, .count = 64, .channels = 1, .rate = 48000};
+    float out[64 * 2];
+
+    uint32_t starts[] = {0x7ffffd, 0xfffffd, 0xfffffffd};
+    for (int s = 0; s < 3; s++) {
+        atomic_store(&mixer.voices[0].generation, starts[s]);
+        for (int i = 0; i < 6; i++) {
+            int handle = mixer_play(&mixer, &sound, 1.0f, 0.0f, true);
+            CHECK(handle >= 0);
+            CHECK((handle & 0xff) == 0);
+
+            mixer_stop(&mixer, handle - 0x100); // a stale handle of the same voice
+            mixer_render(&mixer, out, 64);
+            CHECK(atomic_load(&mixer.voices[0].state) == VOICE_PLAYING);
+
+            mixer_stop(&mixer, handle);
+            mixer_render(&mixer, out, 64);
+            CHECK(atomic_load(&mixer.voices[0].state) == VOICE_FREE);
+        }
+    }
+}
+
+typedef struct {
+    AudioRing ring;
+    uint64_t frames;
+    uint32_t seed;
+} ThreadedRing;
+
+static uint32_t next_random(uint32_t *seed) {
+    *seed = *seed * 1664525 + 1013904223;
+    return *seed >> 8;
+}
+
+static void *producer_task(void *arg) {
+    ThreadedRing *threaded = (ThreadedRing *)arg;
+    float chunk[AUDIO_CHUNK_FRAMES * 2];
+    uint32_t seed = threaded->seed;
+
+    uint64_t written = 0;
+    while (written < threaded->frames) {
+        uint32_t count = 1 + next_random(&seed) % AUDIO_CHUNK_FRAMES;
+        if (count > threaded->frames - written) count = (uint32_t)(threaded->frames - written);
+        for (uint32_t i = 0; i < count; i++) {
+            chunk[i * 2 + 0] = ramp(written + i);
+            chunk[i * 2 + 1] = -ramp(written + i);
+        }
+        written += audio_ring_write(&threaded->ring, chunk, count);
+    }
+    return NULL;
+}
+
+// The ring between real threads, with both indices starting just below the
+// 32-bit wrap so it is crossed while the data is checked.
+static void test_threaded(void) {
+    ThreadedRing threaded = {.frames = 4000000, .seed = 1};
+    CHECK(audio_ring_init(&threaded.ring, 1024, 2));
+    atomic_store(&threaded.ring.write, UINT32_MAX - 100000);
+    atomic_store(&threaded.ring.read, UINT32_MAX - 100000);
+
+    pthread_t producer;
+    pthread_create(&producer, NULL, producer_task, &threaded);
+
+    float chunk[AUDIO_CHUNK_FRAMES * 2];
+    uint32_t seed = 2;
+    uint64_t read = 0;
+    uint32_t gaps = 0;
+    while (read < threaded.frames) {
+        uint32_t count = audio_ring_read(&threaded.ring, chunk, 1 + next_random(&seed) % AUDIO_CHUNK_FRAMES);
+        for (uint32_t i = 0; i < count; i++) {
+            if (chunk[i * 2 + 0] != ramp(read + i) || chunk[i * 2 + 1] != -ramp(read + i)) gaps++;
+        }
+        CHECK(audio_ring_available(&threaded.ring) <= threaded.ring.capacity);
+        read += count;
+    }
+    pthread_join(producer, NULL);
+
+    CHECK(gaps == 0);
+    CHECK(audio_ring_available(&threaded.ring) == 0);
+    audio_ring_destroy(&threaded.ring);
+}
+
+int main(void) {
+    test_steady();
+    test_late_wakeup();
+    test_stall();
+    test_trigger();
+    test_handles();
+    test_threaded();
+
+    if (failures) {
+        fprintf(stderr, "audio_test: %d checks failed\n", failures);
+        return 1;
+    }
+    printf("audio_test: ok\n");
+    return 0;
+}
@@ -0,0 +1,112 @@
+// Host benchmark of the analysis stage (analysis.h): the FFT alone, a full
+// analysis (window, FFT, bands and RMS) and a second of stereo fed through
+// analyzer_push(), with the FFT checked against a naive DFT first, e.g.
+//
+//     ./fftbench           # 48 kHz
+//     ./fftbench 44100     # another output rate
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "analysis.h"
+
+#define BENCH_RUNS 20000
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Largest difference between analyzer_fft() and a double precision DFT of the
+// same input, relative to the largest bin.
+static double fft_error(Analyzer *analyzer) {
+    const int n = ANALYSIS_SIZE;
+    static float input[ANALYSIS_SIZE];
+    srand(1);
+    for (int i = 0; i < n; i++) {
+        input[i] = (float)rand() / RAND_MAX * 2.0f - 1.0f;
+        analyzer->re[analyzer->reverse[i]] = input[i];
+        analyzer->im[analyzer->reverse[i]] = 0.0f;
+    }
+    analyzer_fft(analyzer);
+
+    double error = 0.0, peak = 0.0;
+    for (int k = 0; k < n; k++) {
+        double re = 0.0, im = 0.0;
+        for (int i = 0; i < n; i++) {
+            re += input[i] * cos(-2.0 * M_PI * k * i / n);
+            im += input[i] * sin(-2.0 * M_PI * k * i / n);
+        }
+        double d = hypot(analyzer->re[k] - re, analyzer->im[k] - im);
+        if (d > error) error = d;
+        if (hypot(re, im) > peak) peak = hypot(re, im);
+    }
+    return error / peak;
+}
+
+// Band a full scale sine of `hz` ends up in, -1 if none reads above 0.9.
+static int sine_band(Analyzer *analyzer, uint32_t rate, float hz) {
+    Spectrum spectrum;
+    for (int i = 0; i < ANALYSIS_SIZE; i++) analyzer->input[i] = sinf(2.0f * (float)M_PI * hz * i / rate);
+    analyzer_run(analyzer, &spectrum);
+
+    int band = -1;
+    for (int b = 0; b < ANALYSIS_BANDS; b++) {
+        if (spectrum.bands[b] > 0.9f && (band < 0 || spectrum.bands[b] > spectrum.bands[band])) band = b;
+    }
+    return band;
+}
+
+int main(int argc, char **argv) {
+    uint32_t rate = argc > 1 ? (uint32_t)atoi(argv[1]) : 48000;
+    if (rate < 8000) {
+        fprintf(stderr, "usage: %s [rate]\n", argv[0]);
+        return 1;
+    }
+
+#if defined(__ARM_NEON)
+    const char *simd = "neon";
+#elif defined(__SSE__)
+    const char *simd = "sse";
+#else
+    const char *simd = "scalar";
+#endif
+    static Analyzer analyzer;
+    analyzer_init(&analyzer, rate);
+    printf("analysis: %s, %d-point FFT, %d bands, %u Hz\n", simd, ANALYSIS_SIZE, ANALYSIS_BANDS, rate);
+
+    double error = fft_error(&analyzer);
+    printf("fft error vs dft: %.2e\n", error);
+    int low = sine_band(&analyzer, rate, 100.0f), high = sine_band(&analyzer, rate, 8000.0f);
+    printf("bands: 100 Hz -> %d, 8 kHz -> %d\n", low, high);
+
+    Spectrum spectrum;
+    for (int i = 0; i < ANALYSIS_SIZE; i++) analyzer.input[i] = sinf(i * 0.05f) * 0.5f;
+
+    double start = now();
+    for (int i = 0; i < BENCH_RUNS; i++) analyzer_fft(&analyzer);
+    double fft = (now() - start) / BENCH_RUNS;
+
+    start = now();
+    for (int i = 0; i < BENCH_RUNS; i++) analyzer_run(&analyzer, &spectrum);
+    double run = (now() - start) / BENCH_RUNS;
+
+    // one second of stereo through the tap path, 256 frames at a time as
+    // audio_task drains it
+    float *frames = (float *)malloc(rate * 2 * sizeof(float));
+    for (uint32_t i = 0; i < rate * 2; i++) frames[i] = sinf(i * 0.01f) * 0.5f;
+    int spectra = 0;
+    start = now();
+    for (uint32_t i = 0; i < rate; i += 256) spectra += analyzer_push(&analyzer, frames + i * 2, rate - i < 256 ? rate - i : 256, &spectrum);
+    double push = now() - start;
+    free(frames);
+
+    printf("fft: %.2f us | analysis: %.2f us | 1 s of audio: %.3f ms for %d spectra (%.3f%% of real time)\n", fft * 1e6, run * 1e6, push * 1e3, spectra, push * 100);
+
+    // a wrong transform or band layout makes the numbers above meaningless
+    bool ok = error < 1e-5 && low >= 0 && high > low;
+    if (!ok) fprintf(stderr, "fftbench: analysis results are wrong\n");
+    return ok ? 0 : 1;
+}
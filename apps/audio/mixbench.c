@@ -0,0 +1,89 @@
+// Host benchmark of the mixer: how many voices are mixed per millisecond of
+// CPU for same-rate stereo sources (mixed straight from the source) and for
+// sources that go through the resampler, e.g.
+//
+//     ./mixbench          # 48 kHz, 192-frame bursts
+//     ./mixbench 96       # another burst size
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "mixer.h"
+
+#define BENCH_RATE 48000
+#define BENCH_SECONDS 2
+#define BENCH_CALLBACKS 20000
+
+static double cpu_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static Sound make_sound(uint32_t channels, uint32_t rate) {
+    uint32_t count = rate * BENCH_SECONDS;
+    float *frames = (float *)malloc((size_t)count * channels * sizeof(float));
+    for (uint32_t i = 0; i < count * channels; i++) frames[i] = sinf(i * 0.01f) * 0.5f;
+    return (Sound){.frames = frames, .count = count, .channels = channels, .rate = rate};
+}
+
+// Average CPU seconds per callback of `burst` frames with `voices` looping.
+static double bench(const Sound *sound, int voices, uint32_t burst, float *out) {
+    static Mixer mixer;
+    mixer_init(&mixer, BENCH_RATE);
+    for (int i = 0; i < voices; i++) mixer_play(&mixer, sound, 0.1f, (i % 5) * 0.5f - 1.0f, true);
+
+    double start = cpu_now();
+    for (int i = 0; i < BENCH_CALLBACKS; i++) {
+        memset(out, 0, burst * 2 * sizeof(float));
+        mixer_render(&mixer, out, burst);
+        mixer_limit(out, burst);
+    }
+    return (cpu_now() - start) / BENCH_CALLBACKS;
+}
+
+int main(int argc, char **argv) {
+    uint32_t burst = argc > 1 ? (uint32_t)atoi(argv[1]) : 192;
+    if (burst == 0 || burst > 8192) {
+        fprintf(stderr, "usage: %s [burst frames]\n", argv[0]);
+        return 1;
+    }
+
+#if defined(__ARM_NEON)
+    const char *simd = "neon";
+#elif defined(__SSE__)
+    const char *simd = "sse";
+#else
+    const char *simd = "scalar";
+#endif
+    double period_us = burst * 1e6 / BENCH_RATE;
+    printf("mixer: %s, %u Hz, %u-frame bursts (%.0f us), %d callbacks per run\n", simd, BENCH_RATE, burst, period_us, BENCH_CALLBACKS);
+    printf("%-22s %6s %14s %10s %14s\n", "source", "voices", "us/callback", "voices/ms", "cpu/period %");
+
+    struct {
+        const char *name;
+        Sound sound;
+    } sources[] = {
+        {"stereo 48 kHz, direct", make_sound(2, 48000)},
+        {"stereo 44.1 kHz", make_sound(2, 44100)},
+        {"mono 22.05 kHz", make_sound(1, 22050)},
+    };
+    int voices[] = {1, 8, 32};
+
+    float *out = (float *)malloc(burst * 2 * sizeof(float));
+    float checksum = 0;
+    for (size_t s = 0; s < sizeof(sources) / sizeof(sources[0]); s++) {
+        for (size_t v = 0; v < sizeof(voices) / sizeof(voices[0]); v++) {
+            bench(&sources[s].sound, voices[v], burst, out); // warm up
+            double seconds = bench(&sources[s].sound, voices[v], burst, out);
+            checksum += out[0];
+
+            // voices/ms: voice-bursts mixed per millisecond of CPU
+            printf("%-22s %6d %14.2f %10.0f %14.2f\n", sources[s].name, voices[v], seconds * 1e6, voices[v] / (seconds * 1e3), seconds * 1e6 / period_us * 100);
+        }
+        free((void *)sources[s].sound.frames);
+    }
+    free(out);
+    return checksum != checksum;
+}
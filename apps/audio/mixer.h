@@ -0,0 +1,239 @@
+#pragma once
+
+#include <math.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+#define MIXER_VOICES 32
+#define MIXER_CHUNK_FRAMES 256
+
+// A handle is the voice index in the low 8 bits and the low 23 bits of the
+// voice's generation above it, so it never reaches the sign bit.
+#define MIXER_GENERATION_MASK 0x7fffff
+
+// Decoded PCM owned by the caller. It must stay alive while any voice plays it.
+typedef struct {
+    const float *frames;
+    uint32_t count;
+    uint32_t channels; // 1 or 2
+    uint32_t rate;
+} Sound;
+
+enum {
+    VOICE_FREE,
+    VOICE_CLAIMED,
+    VOICE_PLAYING,
+};
+
+typedef struct {
+    _Atomic int state;
+    _Atomic bool stop;
+    _Atomic uint32_t generation;
+
+    const Sound *sound;
+    bool loop;
+    float gain_left;
+    float gain_right;
+
+    // source position and step in 32.32 fixed point, so resampling never drifts
+    uint64_t position;
+    uint64_t step;
+} Voice;
+
+// Mixes up to MIXER_VOICES in-memory sounds into a stereo float stream at the
+// device rate. mixer_play() and mixer_stop() may be called from any thread;
+// mixer_render() is called from the audio callback and never blocks.
+typedef struct {
+    Voice voices[MIXER_VOICES];
+    _Atomic uint32_t rate; // output rate, 0 while there is no output stream
+    float scratch[MIXER_CHUNK_FRAMES * 2];
+} Mixer;
+
+static inline void mixer_init(Mixer *mixer, uint32_t rate) {
+    memset(mixer, 0, sizeof(*mixer));
+    atomic_init(&mixer->rate, rate);
+}
+
+// Sets the output rate once the stream is open. A rate of 0 rejects new voices.
+static inline void mixer_set_rate(Mixer *mixer, uint32_t rate) {
+    atomic_store(&mixer->rate, rate);
+}
+
+// Releases every voice. Only valid while mixer_render() is not running.
+static inline void mixer_clear(Mixer *mixer) {
+    for (int i = 0; i < MIXER_VOICES; i++) atomic_store(&mixer->voices[i].state, VOICE_FREE);
+}
+
+// Returns a non-negative handle for mixer_stop(), or -1 when every voice is
+// busy. pan goes from -1 (left) to +1 (right) with an equal power law.
+static inline int mixer_play(Mixer *mixer, const Sound *sound, float gain, float pan, bool loop) {
+    uint32_t rate = atomic_load(&mixer->rate);
+    if (!sound || sound->count == 0 || rate == 0) return -1;
+
+    for (int i = 0; i < MIXER_VOICES; i++) {
+        Voice *voice = &mixer->voices[i];
+
+        int expected = VOICE_FREE;
+        if (!atomic_compare_exchange_strong(&voice->state, &expected, VOICE_CLAIMED)) continue;
+
+        float angle = (pan + 1.0f) * (float)M_PI * 0.25f;
+        voice->sound = sound;
+        voice->loop = loop;
+        voice->gain_left = gain * cosf(angle);
+        voice->gain_right = gain * sinf(angle);
+        voice->position = 0;
+        voice->step = ((uint64_t)sound->rate << 32) / rate;
+        atomic_store(&voice->stop, false);
+
+        uint32_t generation = atomic_fetch_add(&voice->generation, 1) + 1;
+        atomic_store_explicit(&voice->state, VOICE_PLAYING, memory_order_release);
+        return (int)((generation & MIXER_GENERATION_MASK) << 8 | (uint32_t)i);
+    }
+
+    return -1;
+}
+
+static inline void mixer_stop(Mixer *mixer, int handle) {
+    if (handle < 0) return;
+
+    Voice *voice = &mixer->voices[handle & 0xff];
+    if ((atomic_load(&voice->generation) & MIXER_GENERATION_MASK) == ((uint32_t)handle >> 8)) atomic_store(&voice->stop, true);
+}
+
+// out[i] += in[i] * gain, with the left/right gains alternating per sample.
+static inline void mixer_accumulate(float *out, const float *in, float gain_left, float gain_right, uint32_t frames) {
+    uint32_t i = 0;
+#if defined(__ARM_NEON)
+    const float gains[4] = {gain_left, gain_right, gain_left, gain_right};
+    float32x4_t g = vld1q_f32(gains);
+    for (; i + 4 <= frames; i += 4) {
+        float32x4_t a = vld1q_f32(out + i * 2);
+        float32x4_t b = vld1q_f32(out + i * 2 + 4);
+        a = vmlaq_f32(a, vld1q_f32(in + i * 2), g);
+        b = vmlaq_f32(b, vld1q_f32(in + i * 2 + 4), g);
+        vst1q_f32(out + i * 2, a);
+        vst1q_f32(out + i * 2 + 4, b);
+    }
+#elif defined(__SSE__)
+    __m128 g = _mm_setr_ps(gain_left, gain_right, gain_left, gain_right);
+    for (; i + 4 <= frames; i += 4) {
+        __m128 a = _mm_loadu_ps(out + i * 2);
+        __m128 b = _mm_loadu_ps(out + i * 2 + 4);
+        a = _mm_add_ps(a, _mm_mul_ps(_mm_loadu_ps(in + i * 2), g));
+        b = _mm_add_ps(b, _mm_mul_ps(_mm_loadu_ps(in + i * 2 + 4), g));
+        _mm_storeu_ps(out + i * 2, a);
+        _mm_storeu_ps(out + i * 2 + 4, b);
+    }
+#endif
+    for (; i < frames; i++) {
+        out[i * 2 + 0] += in[i * 2 + 0] * gain_left;
+        out[i * 2 + 1] += in[i * 2 + 1] * gain_right;
+    }
+}
+
+// Clamps the mixed stream to [-1, 1].
+static inline void mixer_limit(float *out, uint32_t frames) {
+    uint32_t n = frames * 2;
+    uint32_t i = 0;
+#if defined(__ARM_NEON)
+    float32x4_t lo = vdupq_n_f32(-1.0f);
+    float32x4_t hi = vdupq_n_f32(+1.0f);
+    for (; i + 4 <= n; i += 4) vst1q_f32(out + i, vminq_f32(vmaxq_f32(vld1q_f32(out + i), lo), hi));
+#elif defined(__SSE__)
+    __m128 lo = _mm_set1_ps(-1.0f);
+    __m128 hi = _mm_set1_ps(+1.0f);
+    for (; i + 4 <= n; i += 4) _mm_storeu_ps(out + i, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(out + i), lo), hi));
+#endif
+    for (; i < n; i++) out[i] = out[i] < -1.0f ? -1.0f : out[i] > 1.0f ? 1.0f : out[i];
+}
+
+// Resamples up to `frames` stereo frames of the voice into `dst` with linear
+// interpolation. Returns fewer frames when a one-shot reaches its end.
+static inline uint32_t mixer_resample(Voice *voice, float *dst, uint32_t frames) {
+    const Sound *sound = voice->sound;
+    const uint64_t end = (uint64_t)sound->count << 32;
+
+    uint32_t i = 0;
+    for (; i < frames; i++) {
+        if (voice->position >= end) {
+            if (!voice->loop) break;
+            voice->position -= end;
+        }
+
+        uint32_t index = (uint32_t)(voice->position >> 32);
+        uint32_t next = index + 1;
+        if (next >= sound->count) next = voice->loop ? 0 : index;
+        float frac = (float)(voice->position & 0xffffffff) * (1.0f / 4294967296.0f);
+
+        if (sound->channels == 1) {
+            float a = sound->frames[index];
+            float s = a + (sound->frames[next] - a) * frac;
+            dst[i * 2 + 0] = s;
+            dst[i * 2 + 1] = s;
+        } else {
+            float l = sound->frames[index * 2 + 0];
+            float r = sound->frames[index * 2 + 1];
+            dst[i * 2 + 0] = l + (sound->frames[next * 2 + 0] - l) * frac;
+            dst[i * 2 + 1] = r + (sound->frames[next * 2 + 1] - r) * frac;
+        }
+
+        voice->position += voice->step;
+    }
+
+    return i;
+}
+
+// Renders one voice into `out`. Returns false when the voice has finished.
+static inline bool mixer_render_voice(Mixer *mixer, Voice *voice, float *out, uint32_t frames) {
+    const Sound *sound = voice->sound;
+    const uint64_t unit = (uint64_t)1 << 32;
+
+    uint32_t done = 0;
+    while (done < frames) {
+        uint32_t n = frames - done;
+
+        // same rate stereo on a whole frame: mix straight from the source
+        if (voice->step == unit && sound->channels == 2 && (voice->position & (unit - 1)) == 0) {
+            uint32_t index = (uint32_t)(voice->position >> 32);
+            if (index >= sound->count) {
+                if (!voice->loop) return false;
+                voice->position = 0;
+                index = 0;
+            }
+            if (n > sound->count - index) n = sound->count - index;
+
+            mixer_accumulate(out + done * 2, sound->frames + (size_t)index * 2, voice->gain_left, voice->gain_right, n);
+            voice->position += (uint64_t)n << 32;
+            done += n;
+            continue;
+        }
+
+        if (n > MIXER_CHUNK_FRAMES) n = MIXER_CHUNK_FRAMES;
+        uint32_t produced = mixer_resample(voice, mixer->scratch, n);
+        mixer_accumulate(out + done * 2, mixer->scratch, voice->gain_left, voice->gain_right, produced);
+        done += produced;
+        if (produced < n) return false;
+    }
+
+    return true;
+}
+
+// Adds every playing voice into the interleaved stereo buffer `out`.
+static inline void mixer_render(Mixer *mixer, float *out, uint32_t frames) {
+    for (int i = 0; i < MIXER_VOICES; i++) {
+        Voice *voice = &mixer->voices[i];
+        if (atomic_load_explicit(&voice->state, memory_order_acquire) != VOICE_PLAYING) continue;
+
+        if (atomic_load_explicit(&voice->stop, memory_order_relaxed) || !mixer_render_voice(mixer, voice, out, frames)) {
+            atomic_store_explicit(&voice->state, VOICE_FREE, memory_order_release);
+        }
+    }
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "mixer.h"
+#include "ring.h"
+
+// The work of one AAudio data callback, kept free of Android dependencies so
+// the host test (audio_test.c) drives exactly what the device does: `frames`
+// from the decoded ring, zero-filled when it runs short, every playing voice
+// mixed on top and limited, and a copy of the result pushed to `tap`. `fill`
+// receives the ring level seen on entry. Returns true on an underrun.
+static inline bool audio_output_render(AudioRing *ring, Mixer *mixer, AudioRing *tap, float *out, uint32_t frames, uint32_t *fill) {
+    *fill = audio_ring_available(ring);
+    uint32_t read = audio_ring_read(ring, out, frames);
+    if (read < frames) memset(out + read * ring->channels, 0, (frames - read) * ring->channels * sizeof(float));
+
+    mixer_render(mixer, out, frames);
+    mixer_limit(out, frames);
+    audio_ring_write(tap, out, frames);
+    return read < frames;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Single producer / single consumer ring of interleaved float frames. The
+// producer is the decoder thread and the consumer is the AAudio data callback,
+// so neither side ever takes a lock or allocates.
+typedef struct {
+    float *data;
+    uint32_t capacity; // in frames, power of two
+    uint32_t channels;
+
+    _Atomic uint32_t write;
+    _Atomic uint32_t read;
+} AudioRing;
+
+static inline bool audio_ring_init(AudioRing *ring, uint32_t frames, uint32_t channels) {
+    uint32_t capacity = 1;
+    while (capacity < frames) capacity <<= 1;
+
+    ring->data = (float *)calloc((size_t)capacity * channels, sizeof(float));
+    if (!ring->data) return false;
+
+    ring->capacity = capacity;
+    ring->channels = channels;
+    atomic_init(&ring->write, 0);
+    atomic_init(&ring->read, 0);
+    return true;
+}
+
+static inline void audio_ring_destroy(AudioRing *ring) {
+    free(ring->data);
+    ring->data = NULL;
+}
+
+// Frames ready to be read.
+static inline uint32_t audio_ring_available(AudioRing *ring) {
+    uint32_t write = atomic_load_explicit(&ring->write, memory_order_acquire);
+    uint32_t read = atomic_load_explicit(&ring->read, memory_order_acquire);
+    return write - read;
+}
+
+// Frames that can be written without overwriting unread data.
+static inline uint32_t audio_ring_space(AudioRing *ring) {
+    return ring->capacity - audio_ring_available(ring);
+}
+
+static inline uint32_t audio_ring_write(AudioRing *ring, const float *frames, uint32_t count) {
+    uint32_t write = atomic_load_explicit(&ring->write, memory_order_relaxed);
+    uint32_t read = atomic_load_explicit(&ring->read, memory_order_acquire);
+
+    uint32_t space = ring->capacity - (write - read);
+    if (count > space) count = space;
+
+    uint32_t offset = write & (ring->capacity - 1);
+    uint32_t first = ring->capacity - offset;
+    if (first > count) first = count;
+
+    memcpy(ring->data + (size_t)offset * ring->channels, frames, (size_t)first * ring->channels * sizeof(float));
+    memcpy(ring->data, frames + (size_t)first * ring->channels, (size_t)(count - first) * ring->channels * sizeof(float));
+
+    atomic_store_explicit(&ring->write, write + count, memory_order_release);
+    return count;
+}
+
+static inline uint32_t audio_ring_read(AudioRing *ring, float *frames, uint32_t count) {
+    uint32_t read = atomic_load_explicit(&ring->read, memory_order_relaxed);
+    uint32_t write = atomic_load_explicit(&ring->write, memory_order_acquire);
+
+    uint32_t available = write - read;
+    if (count > available) count = available;
+
+    uint32_t offset = read & (ring->capacity - 1);
+    uint32_t first = ring->capacity - offset;
+    if (first > count) first = count;
+
+    memcpy(frames, ring->data + (size_t)offset * ring->channels, (size_t)first * ring->channels * sizeof(float));
+    memcpy(frames + (size_t)first * ring->channels, ring->data, (size_t)(count - first) * ring->channels * sizeof(float));
+
+    atomic_store_explicit(&ring->read, read + count, memory_order_release);
+    return count;
+}
@@ -0,0 +1,106 @@
+#include "sound_bank.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// the host benchmark builds this file without the NDK
+#ifdef __ANDROID__
+#include <android/log.h>
+#define LOG(...) ((void)__android_log_print(ANDROID_LOG_INFO, "ENGINE", __VA_ARGS__))
+#else
+#define LOG(...) ((void)(fprintf(stderr, __VA_ARGS__), fputc('\n', stderr)))
+#endif
+
+typedef struct {
+    SoundBank *bank;
+    const SoundBankLoader *loader;
+    ma_decoder **decoders;
+    int count;
+    atomic_int next;
+} SoundBankJob;
+
+static int64_t sound_bank_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void *sound_bank_worker(void *arg) {
+    SoundBankJob *job = (SoundBankJob *)arg;
+
+    int i;
+    while ((i = atomic_fetch_add(&job->next, 1)) < job->count) {
+        Sound *sound = &job->bank->sounds[i];
+        ma_uint64 frames_read = 0;
+        ma_decoder_read_pcm_frames(job->decoders[i], (float *)sound->frames, sound->count, &frames_read);
+        sound->count = (uint32_t)frames_read;
+        job->loader->close(job->loader->context, job->decoders[i]);
+    }
+
+    return NULL;
+}
+
+void sound_bank_load(SoundBank *bank, const SoundBankLoader *loader, const char **paths, int count, uint32_t rate) {
+    int64_t load_time = sound_bank_now();
+    memset(bank, 0, sizeof(*bank));
+
+    ma_decoder *decoders[SOUND_BANK_MAX];
+    ma_decoder_config config = ma_decoder_config_init(ma_format_f32, 2, rate);
+
+    // first pass: open every asset to learn its length in output frames
+    size_t total = 0;
+    for (int i = 0; i < count && bank->count < SOUND_BANK_MAX; i++) {
+        ma_decoder *decoder = loader->open(loader->context, paths[i], &config);
+        if (!decoder) continue;
+
+        ma_uint64 length = 0;
+        if (ma_decoder_get_length_in_pcm_frames(decoder, &length) != MA_SUCCESS || length == 0 || length > (ma_uint64)rate * SOUND_BANK_MAX_SECONDS) {
+            LOG("%s: skipped, unknown length or longer than %d s", paths[i], SOUND_BANK_MAX_SECONDS);
+            loader->close(loader->context, decoder);
+            continue;
+        }
+
+        decoders[bank->count] = decoder;
+        bank->sounds[bank->count] = (Sound){.frames = NULL, .count = (uint32_t)length, .channels = 2, .rate = rate};
+        bank->count++;
+        total += length;
+    }
+    if (bank->count == 0) return;
+
+    bank->arena = (float *)malloc(total * 2 * sizeof(float));
+    if (!bank->arena) {
+        LOG("cannot allocate sound bank arena");
+        for (int i = 0; i < bank->count; i++) loader->close(loader->context, decoders[i]);
+        bank->count = 0;
+        return;
+    }
+
+    size_t offset = 0;
+    for (int i = 0; i < bank->count; i++) {
+        bank->sounds[i].frames = bank->arena + offset * 2;
+        offset += bank->sounds[i].count;
+    }
+
+    // second pass: decode straight into the arena, one asset per task
+    SoundBankJob job = {.bank = bank, .loader = loader, .decoders = decoders, .count = bank->count};
+    atomic_init(&job.next, 0);
+
+    pthread_t threads[SOUND_BANK_THREADS];
+    int nb_threads = 0;
+    for (int i = 1; i < SOUND_BANK_THREADS && i < bank->count; i++) {
+        if (pthread_create(&threads[nb_threads], NULL, sound_bank_worker, &job) == 0) nb_threads++;
+    }
+    sound_bank_worker(&job);
+    for (int i = 0; i < nb_threads; i++) pthread_join(threads[i], NULL);
+
+    LOG("sound bank: %d sounds | %zu KiB | %d threads | %.2f ms", bank->count, total * 2 * sizeof(float) / 1024, nb_threads + 1, (sound_bank_now() - load_time) / 1e6);
+}
+
+void sound_bank_free(SoundBank *bank) {
+    free(bank->arena);
+    memset(bank, 0, sizeof(*bank));
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <miniaudio/miniaudio.h>
+
+#include "mixer.h"
+
+#define SOUND_BANK_MAX 16
+#define SOUND_BANK_MAX_SECONDS 5
+#define SOUND_BANK_THREADS 4
+
+// Short effects decoded once into device-format PCM. All sounds share a single
+// arena allocation, so a bank is freed in one go and triggering is just a
+// mixer_play() on memory that is already in the output format.
+typedef struct {
+    float *arena;
+    Sound sounds[SOUND_BANK_MAX];
+    int count;
+} SoundBank;
+
+// Where the assets come from: the APK through AAssetManager on the device,
+// plain files in the host benchmark (soundbench.c). open() returns a decoder
+// initialised with `config`, or NULL; close() releases it and whatever backs it.
+// Both are called from the loading threads.
+typedef struct {
+    void *context;
+    ma_decoder *(*open)(void *context, const char *path, const ma_decoder_config *config);
+    void (*close)(void *context, ma_decoder *decoder);
+} SoundBankLoader;
+
+// Decodes every asset in `paths` to interleaved stereo float at `rate`, on up to
+// SOUND_BANK_THREADS threads. Missing or overlong assets are skipped.
+void sound_bank_load(SoundBank *bank, const SoundBankLoader *loader, const char **paths, int count, uint32_t rate);
+void sound_bank_free(SoundBank *bank);
@@ -0,0 +1,183 @@
+// Host benchmark of the sound bank: load time of the whole bank (open, size
+// and decode every effect into the arena) and the cost of triggering an effect
+// from it, against decoding the effect on every trigger as before the bank,
+// e.g.
+//
+//     ./soundbench                 # synthesized effects in a temp directory
+//     ./soundbench assets/*.wav    # the app's own effects
+//
+// A triggered voice is heard from the next data callback (see audio_test.c),
+// so on the device the rest of the trigger latency is one burst plus the
+// stream's buffer.
+
+#define MINIAUDIO_IMPLEMENTATION
+#include <miniaudio/miniaudio.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "mixer.h"
+#include "sound_bank.h"
+
+#define BENCH_RATE 48000
+#define BENCH_LOADS 10
+#define BENCH_TRIGGERS 100000
+#define BENCH_DECODES 50
+
+static int64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static int compare_int64(const void *a, const void *b) {
+    int64_t x = *(const int64_t *)a, y = *(const int64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static ma_decoder *file_decoder_open(void *context, const char *path, const ma_decoder_config *config) {
+    (void)context;
+    ma_decoder *decoder = (ma_decoder *)malloc(sizeof(ma_decoder));
+    if (!decoder) return NULL;
+    if (ma_decoder_init_file(path, config, decoder) != MA_SUCCESS) {
+        fprintf(stderr, "cannot open %s\n", path);
+        free(decoder);
+        return NULL;
+    }
+    return decoder;
+}
+
+static void file_decoder_close(void *context, ma_decoder *decoder) {
+    (void)context;
+    ma_decoder_uninit(decoder);
+    free(decoder);
+}
+
+static void put_u16(FILE *file, uint32_t value) {
+    fputc(value & 0xff, file);
+    fputc(value >> 8 & 0xff, file);
+}
+
+static void put_u32(FILE *file, uint32_t value) {
+    put_u16(file, value & 0xffff);
+    put_u16(file, value >> 16);
+}
+
+// A decaying tone as a 16-bit PCM WAV file.
+static bool write_effect(const char *path, uint32_t rate, uint32_t channels, float seconds, float frequency) {
+    FILE *file = fopen(path, "wb");
+    if (!file) return false;
+
+    uint32_t frames = (uint32_t)(rate * seconds);
+    uint32_t size = frames * channels * 2;
+    fwrite("RIFF", 1, 4, file);
+    put_u32(file, 36 + size);
+    fwrite("WAVEfmt ", 1, 8, file);
+    put_u32(file, 16);
+    put_u16(file, 1);
+    put_u16(file, channels);
+    put_u32(file, rate);
+    put_u32(file, rate * channels * 2);
+    put_u16(file, channels * 2);
+    put_u16(file, 16);
+    fwrite("data", 1, 4, file);
+    put_u32(file, size);
+    for (uint32_t i = 0; i < frames; i++) {
+        float t = (float)i / rate;
+        int16_t sample = (int16_t)(sinf(2.0f * (float)M_PI * frequency * t) * expf(-t * 8.0f) * 20000.0f);
+        for (uint32_t c = 0; c < channels; c++) put_u16(file, (uint16_t)sample);
+    }
+    return fclose(file) == 0;
+}
+
+int main(int argc, char **argv) {
+    const char *paths[SOUND_BANK_MAX];
+    char names[SOUND_BANK_MAX][64];
+    int count = 0;
+    char directory[] = "/tmp/soundbench.XXXXXX";
+    bool synthesized = argc < 2;
+
+    if (synthesized) {
+        if (!mkdtemp(directory)) {
+            perror("mkdtemp");
+            return 1;
+        }
+        // the mix of rates, layouts and lengths UI effects tend to come in
+        const uint32_t rates[] = {48000, 44100, 22050};
+        for (; count < 12; count++) {
+            snprintf(names[count], sizeof(names[count]), "%s/effect%d.wav", directory, count);
+            if (!write_effect(names[count], rates[count % 3], 1 + count % 2, 0.05f + count * 0.15f, 220.0f * (count + 1))) {
+                fprintf(stderr, "cannot write %s\n", names[count]);
+                return 1;
+            }
+            paths[count] = names[count];
+        }
+    } else {
+        for (int i = 1; i < argc && count < SOUND_BANK_MAX; i++) paths[count++] = argv[i];
+    }
+
+    SoundBankLoader loader = {.context = NULL, .open = file_decoder_open, .close = file_decoder_close};
+    SoundBank bank;
+
+    int64_t loads[BENCH_LOADS];
+    for (int i = 0; i < BENCH_LOADS; i++) {
+        int64_t start = now_ns();
+        sound_bank_load(&bank, &loader, paths, count, BENCH_RATE);
+        loads[i] = now_ns() - start;
+        if (i < BENCH_LOADS - 1) sound_bank_free(&bank);
+    }
+    if (bank.count == 0) {
+        fprintf(stderr, "no sounds loaded\n");
+        return 1;
+    }
+    qsort(loads, BENCH_LOADS, sizeof(loads[0]), compare_int64);
+
+    size_t total = 0;
+    for (int i = 0; i < bank.count; i++) total += bank.sounds[i].count;
+    printf("sound bank: %d sounds | %zu KiB at %d Hz | %d threads\n", bank.count, total * 2 * sizeof(float) / 1024, BENCH_RATE, SOUND_BANK_THREADS);
+    printf("load: first %.2f ms | median %.2f ms | min %.2f ms over %d loads\n", loads[BENCH_LOADS - 1] / 1e6, loads[BENCH_LOADS / 2] / 1e6, loads[0] / 1e6, BENCH_LOADS);
+
+    // trigger from the bank: one mixer_play() on memory already in the output
+    // format. Voices are released in between, untimed, as the callback would.
+    static Mixer mixer;
+    mixer_init(&mixer, BENCH_RATE);
+    static int64_t triggers[BENCH_TRIGGERS];
+    int played = 0;
+    for (int i = 0; i < BENCH_TRIGGERS; i++) {
+        if (i % MIXER_VOICES == 0) mixer_clear(&mixer);
+        int64_t start = now_ns();
+        played += mixer_play(&mixer, &bank.sounds[i % bank.count], 0.8f, 0.0f, false) >= 0;
+        triggers[i] = now_ns() - start;
+    }
+    qsort(triggers, BENCH_TRIGGERS, sizeof(triggers[0]), compare_int64);
+    printf("trigger from bank: median %lld ns | p99 %lld ns | max %lld ns (%d/%d played)\n", (long long)triggers[BENCH_TRIGGERS / 2], (long long)triggers[BENCH_TRIGGERS * 99 / 100], (long long)triggers[BENCH_TRIGGERS - 1], played, BENCH_TRIGGERS);
+
+    // decode on trigger: open, decode and close the effect every time
+    ma_decoder_config config = ma_decoder_config_init(ma_format_f32, 2, BENCH_RATE);
+    float *scratch = (float *)malloc((size_t)BENCH_RATE * SOUND_BANK_MAX_SECONDS * 2 * sizeof(float));
+    int64_t decodes[BENCH_DECODES];
+    for (int i = 0; i < BENCH_DECODES; i++) {
+        int64_t start = now_ns();
+        ma_decoder *decoder = file_decoder_open(NULL, paths[i % count], &config);
+        if (decoder) {
+            ma_uint64 frames_read = 0;
+            ma_decoder_read_pcm_frames(decoder, scratch, (ma_uint64)BENCH_RATE * SOUND_BANK_MAX_SECONDS, &frames_read);
+            file_decoder_close(NULL, decoder);
+        }
+        decodes[i] = now_ns() - start;
+    }
+    qsort(decodes, BENCH_DECODES, sizeof(decodes[0]), compare_int64);
+    printf("decode on trigger: median %.1f us | max %.1f us\n", decodes[BENCH_DECODES / 2] / 1e3, decodes[BENCH_DECODES - 1] / 1e3);
+
+    free(scratch);
+    sound_bank_free(&bank);
+    if (synthesized) {
+        for (int i = 0; i < count; i++) unlink(paths[i]);
+        rmdir(directory);
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// callback durations are bucketed in powers of two starting at 64 us, the
+// last bucket holds everything slower
+#define TELEMETRY_BUCKETS 8
+#define TELEMETRY_BUCKET_US 64
+
+// Glitch counters written by the audio callback and read by the decoder thread.
+// The callback is the only writer of each field apart from the reset done by
+// audio_telemetry_take(), so everything is a relaxed load/store or add.
+typedef struct {
+    _Atomic uint32_t callbacks;
+    _Atomic uint32_t underruns; // callbacks that found the ring short
+    _Atomic uint32_t histogram[TELEMETRY_BUCKETS];
+    _Atomic int64_t max_ns;
+    _Atomic uint32_t min_fill; // lowest ring level seen by a callback, in frames
+} AudioTelemetry;
+
+// A snapshot of one reporting interval.
+typedef struct {
+    uint32_t callbacks;
+    uint32_t underruns;
+    uint32_t histogram[TELEMETRY_BUCKETS];
+    int64_t max_ns;
+    uint32_t min_fill;
+} AudioTelemetryWindow;
+
+static inline void audio_telemetry_init(AudioTelemetry *telemetry) {
+    atomic_init(&telemetry->callbacks, 0);
+    atomic_init(&telemetry->underruns, 0);
+    for (int i = 0; i < TELEMETRY_BUCKETS; i++) atomic_init(&telemetry->histogram[i], 0);
+    atomic_init(&telemetry->max_ns, 0);
+    atomic_init(&telemetry->min_fill, UINT32_MAX);
+}
+
+// Records one callback. Safe on the real-time thread: no locks, no syscalls.
+static inline void audio_telemetry_callback(AudioTelemetry *telemetry, int64_t duration_ns, uint32_t fill, bool underrun) {
+    atomic_fetch_add_explicit(&telemetry->callbacks, 1, memory_order_relaxed);
+    if (underrun) atomic_fetch_add_explicit(&telemetry->underruns, 1, memory_order_relaxed);
+
+    int bucket = 0;
+    int64_t limit = TELEMETRY_BUCKET_US * 1000;
+    while (bucket < TELEMETRY_BUCKETS - 1 && duration_ns >= limit) {
+        bucket++;
+        limit <<= 1;
+    }
+    atomic_fetch_add_explicit(&telemetry->histogram[bucket], 1, memory_order_relaxed);
+
+    if (duration_ns > atomic_load_explicit(&telemetry->max_ns, memory_order_relaxed)) atomic_store_explicit(&telemetry->max_ns, duration_ns, memory_order_relaxed);
+    if (fill < atomic_load_explicit(&telemetry->min_fill, memory_order_relaxed)) atomic_store_explicit(&telemetry->min_fill, fill, memory_order_relaxed);
+}
+
+// Moves the counters gathered since the last call into `window`.
+static inline void audio_telemetry_take(AudioTelemetry *telemetry, AudioTelemetryWindow *window) {
+    window->callbacks = atomic_exchange_explicit(&telemetry->callbacks, 0, memory_order_relaxed);
+    window->underruns = atomic_exchange_explicit(&telemetry->underruns, 0, memory_order_relaxed);
+    for (int i = 0; i < TELEMETRY_BUCKETS; i++) window->histogram[i] = atomic_exchange_explicit(&telemetry->histogram[i], 0, memory_order_relaxed);
+    window->max_ns = atomic_exchange_explicit(&telemetry->max_ns, 0, memory_order_relaxed);
+    window->min_fill = atomic_exchange_explicit(&telemetry->min_fill, UINT32_MAX, memory_order_relaxed);
+}
+
+// Formats the histogram as "<64us:n <128us:n ... <4096us:n >=4096us:n" into
+// `buffer`.
+static inline void audio_telemetry_histogram(const AudioTelemetryWindow *window, char *buffer, size_t size) {
+    size_t used = 0;
+    uint32_t limit = TELEMETRY_BUCKET_US;
+    for (int i = 0; i < TELEMETRY_BUCKETS && used < size; i++) {
+        if (i < TELEMETRY_BUCKETS - 1) {
+            used += snprintf(buffer + used, size - used, "%s<%uus:%u", i ? " " : "", limit, window->histogram[i]);
+        } else {
+            used += snprintf(buffer + used, size - used, " >=%uus:%u", limit >> 1, window->histogram[i]);
+        }
+        limit <<= 1;
+    }
+}
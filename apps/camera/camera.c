@@ -14,20 +14,76 @@
 
 #include <assert.h>
 #include <pthread.h>
+#include <stdatomic.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <unistd.h>
 
+#include "capture_policy.h"
+#include "capture_trace.h"
+#include "encoder.h"
+#include "frame_pool.h"
+#include "preview.h"
+
 #define LOGI(...) ((void)__android_log_print(ANDROID_LOG_INFO, "ENGINE", __VA_ARGS__))
 #define LOGE(...) ((void)__android_log_print(ANDROID_LOG_ERROR, "ENGINE", __VA_ARGS__))
 #define LOGV(...) ((void)__android_log_print(ANDROID_LOG_VERBOSE, "ENGINE", __VA_ARGS__))
 
-typedef struct AndroidApp {
-    bool running;
-    pthread_t thread;
+// Up to CAMERA_MAX_CAMERAS devices capture concurrently, each through its own
+// reader and frame pool. Their images, workers and pixel rate come out of one
+// shared budget, capped per camera at the limits below.
+#define CAMERA_MAX_CAMERAS 2
+#define CAMERA_IMAGE_BUDGET 8
+#define CAMERA_WORKER_BUDGET 3
+#define CAMERA_PIXEL_RATE_BUDGET (1920LL * 1080 * CAMERA_FPS)
+
+// A reader never hands out more than its share of images at once. The workers
+// may hold one less, so there is always a slot to acquire (and drop) the next
+// image instead of stalling the camera.
+#define CAMERA_MAX_IMAGES 5
+#define CAMERA_WORKERS 2
+#define CAMERA_STATS_FRAMES 120
+#define CAMERA_CLOSE_TIMEOUT_MS 1000
+
+// The processing stream only needs enough pixels for analysis: 720p30 worth of
+// throughput, shaped like the preview.
+#define CAMERA_FPS 30
+#define CAMERA_MAX_PIXEL_RATE (1280LL * 720 * CAMERA_FPS)
+
+// Draw the preview with GLES from an external OES texture instead of handing
+// the activity window straight to the camera. It is budgeted at 1080p30.
+#define CAMERA_GPU_PREVIEW 1
+#define CAMERA_PREVIEW_PIXEL_RATE (1920LL * 1080 * CAMERA_FPS)
+
+// Also encode the first camera's processing stream to H.264: published to
+// CAMERA_STREAM_URL (e.g. "rtmp://192.168.1.187:1935/live/stream"), or recorded
+// to <external files>/capture.mp4 when it is empty. Frames share the reader's
+// images with the analysis workers, so the encoder only queues a couple.
+#define CAMERA_ENCODE 1
+#define CAMERA_STREAM_URL ""
+#define CAMERA_BIT_RATE (2 * 1000 * 1000)
+#define CAMERA_ENCODER_QUEUE 2
+
+typedef struct AndroidApp AndroidApp;
+
+// One open device and its capture pipeline. The first camera also feeds the
+// preview; the others only process.
+typedef struct {
+    AndroidApp *app;
+    const char *id;
+    ACameraMetadata *characteristics;
+
+    // guarded by app->mutex
+    bool session_active;
+    bool session_closed;
+
+    ACameraDevice_StateCallbacks camera_state_callbacks;
+    ACameraCaptureSession_stateCallbacks capture_session_callbacks;
+    ACameraCaptureSession_captureCallbacks capture_callbacks;
 
-    ACameraManager *camera_manager;
     ACameraDevice *camera_device;
     ACaptureRequest *capture_request;
     ACameraCaptureSession *camera_capture_session;
@@ -38,160 +94,606 @@ typedef struct AndroidApp {
     ACameraOutputTarget *process_output_target;
     ACaptureSessionOutput *process_session_output;
 
-    ANativeWindow *preview_window;
     ANativeWindow *process_window;
-} AndroidApp;
+
+    AImageReader *reader;
+    FramePool *frame_pool;
+    Encoder *encoder; // first camera only, when CAMERA_ENCODE
+    int max_images;
+    _Atomic int images; // acquired and not yet deleted
+    _Atomic uint64_t skipped; // deleted on arrival to keep a reader slot free
+    CaptureConfig process_config;
+    int32_t fps_range[2];
+
+    // per-frame capture events of this camera, exported with the others
+    CaptureTrace *trace;
+    clockid_t timestamp_clock; // clock the sensor timestamps are in
+} Camera;
+
+struct AndroidApp {
+    bool running;
+    pthread_t thread;
+
+    // camera_task sleeps on `cond` until the window goes away or a device or
+    // session reports a state change; `running` and the fields below (and the
+    // cameras' session flags) are guarded by `mutex`
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    int camera_error; // 0, or the last device error (ERROR_CAMERA_* or CAMERA_DISCONNECTED)
+
+    ACameraManager *camera_manager;
+    Camera cameras[CAMERA_MAX_CAMERAS];
+    int camera_count;
+
+    ANativeWindow *preview_window;
+
+    bool gpu_preview;
+    Preview *preview;
+    ANativeWindow *preview_output_window; // preview_window, or the GPU preview's reader
+
+    // written to <external files>/capture_trace.json when the session ends;
+    // pull it with `make trace`
+    const char *data_path;
+};
+
+int64_t camera_now(Camera *camera) {
+    struct timespec ts;
+    clock_gettime(camera->timestamp_clock, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// An acquired image is shared by the frame pool and the encoder; whoever lets
+// go of it last gives it back to the reader.
+typedef struct {
+    AImage *image;
+    _Atomic int references;
+} CameraImage;
+
+void release_image(void *context, const Frame *frame) {
+    Camera *camera = (Camera *)context;
+    CameraImage *shared = (CameraImage *)frame->image;
+
+    if (atomic_fetch_sub(&shared->references, 1) == 1) {
+        AImage_delete(shared->image);
+        free(shared);
+        atomic_fetch_sub(&camera->images, 1);
+    }
+}
 
 void onImageAvailable(void *context, AImageReader *reader) {
-    (void)context;
+    Camera *camera = (Camera *)context;
     int ret;
 
     AImage *image = NULL;
     ret = AImageReader_acquireNextImage(reader, &image);
-    assert(ret == AMEDIA_OK && image);
+    if (ret != AMEDIA_OK || !image) {
+        LOGE("camera %s cannot acquire image: %d", camera->id, ret);
+        return;
+    }
 
-    int32_t width, height, format;
-    AImage_getWidth(image, &width);
-    AImage_getHeight(image, &height);
-    AImage_getFormat(image, &format);
+    // the planes are mapped in place, the workers and the encoder read the
+    // camera buffer directly
+    CameraImage *shared = malloc(sizeof(CameraImage));
+    if (!shared) {
+        AImage_delete(image);
+        return;
+    }
+    shared->image = image;
+    atomic_init(&shared->references, 1);
+    Frame frame = {.image = shared};
+    int32_t y_pixel_stride = 0;
+    int y_length, u_length, v_length;
+    AImage_getWidth(image, &frame.width);
+    AImage_getHeight(image, &frame.height);
+    AImage_getTimestamp(image, &frame.timestamp);
+    AImage_getPlaneData(image, 0, (uint8_t **)&frame.y, &y_length);
+    AImage_getPlaneData(image, 1, (uint8_t **)&frame.u, &u_length);
+    AImage_getPlaneData(image, 2, (uint8_t **)&frame.v, &v_length);
+    AImage_getPlaneRowStride(image, 0, &frame.y_stride);
+    AImage_getPlaneRowStride(image, 1, &frame.uv_stride);
+    AImage_getPlanePixelStride(image, 0, &y_pixel_stride);
+    AImage_getPlanePixelStride(image, 1, &frame.uv_pixel_stride);
+    assert(y_pixel_stride == 1 && "YUV_420_888 luma is always tightly packed");
+
+    TraceEvent event = {.type = TRACE_IMAGE_ARRIVED, .sensor_timestamp = frame.timestamp, .time = camera_now(camera)};
+    capture_trace_record(camera->trace, &event);
+
+    // never hold every image: the next one must always be acquirable, so a
+    // frame neither consumer can take now goes straight back
+    if (atomic_fetch_add(&camera->images, 1) < camera->max_images - 1) {
+        atomic_fetch_add(&shared->references, 1);
+        if (!frame_pool_submit(camera->frame_pool, &frame)) atomic_fetch_sub(&shared->references, 1);
+
+        atomic_fetch_add(&shared->references, 1);
+        if (!camera->encoder || !encoder_submit(camera->encoder, &frame)) atomic_fetch_sub(&shared->references, 1);
+    } else {
+        atomic_fetch_add(&camera->skipped, 1);
+    }
+    release_image(camera, &frame);
 
-    LOGI("Captured image size: width=%d, height=%d, format=%d", width, height, format);
+    if (atomic_load(&camera->trace->images) % CAMERA_STATS_FRAMES == 0) {
+        FramePoolStats stats;
+        frame_pool_stats(camera->frame_pool, &stats);
+        LOGI("camera %s frames: %dx%d | %lu submitted | %lu dropped | %lu skipped | %lu processed | %.2f ms per frame | %d in flight | luma %.1f | motion %.2f", camera->id, frame.width, frame.height, (unsigned long)stats.submitted, (unsigned long)stats.dropped, (unsigned long)atomic_load(&camera->skipped), (unsigned long)stats.processed, stats.processed ? stats.process_ns / 1e6 / stats.processed : 0.0, stats.in_flight, stats.latest.mean_luma, stats.latest.motion);
 
-    AImage_delete(image);
+        if (camera->encoder) {
+            EncoderStats encoded;
+            encoder_stats(camera->encoder, &encoded);
+            LOGI("camera %s encoder: %lu encoded | %lu dropped | %lu mismatched | %d queued | %.2f ms per frame | %.0f kbit/s | error %d", camera->id, (unsigned long)encoded.encoded, (unsigned long)encoded.dropped, (unsigned long)encoded.mismatched, encoded.queued, encoded.encoded ? encoded.encode_ns / 1e6 / encoded.encoded : 0.0, encoded.encoded ? encoded.bytes * 8.0 * camera->process_config.fps / encoded.encoded / 1000 : 0.0, encoded.error);
+        }
+    }
 }
 
-void *camera_task(void *arg) {
-    int ret;
+int64_t metadata_i64(const ACameraMetadata *metadata, uint32_t tag) {
+    ACameraMetadata_const_entry entry = {0};
+    if (ACameraMetadata_getConstEntry(metadata, tag, &entry) != ACAMERA_OK || entry.count == 0) return 0;
+    switch (entry.type) {
+    case ACAMERA_TYPE_BYTE:
+        return entry.data.u8[0];
+    case ACAMERA_TYPE_INT32:
+        return entry.data.i32[0];
+    default:
+        return entry.data.i64[0];
+    }
+}
 
-    AndroidApp *app = (AndroidApp *)arg;
+CameraInfo camera_info(const ACameraMetadata *metadata, const char *id) {
+    CameraInfo info = {
+        .id = id,
+        .facing = (int32_t)metadata_i64(metadata, ACAMERA_LENS_FACING),
+        .hardware_level = (int32_t)metadata_i64(metadata, ACAMERA_INFO_SUPPORTED_HARDWARE_LEVEL),
+    };
+
+    ACameraMetadata_const_entry entry = {0};
+    if (ACameraMetadata_getConstEntry(metadata, ACAMERA_REQUEST_AVAILABLE_CAPABILITIES, &entry) == ACAMERA_OK) {
+        for (uint32_t i = 0; i < entry.count; i++) {
+            if (entry.data.u8[i] == ACAMERA_REQUEST_AVAILABLE_CAPABILITIES_LOGICAL_MULTI_CAMERA) info.logical = true;
+        }
+    }
+    if (info.logical && ACameraMetadata_getConstEntry(metadata, ACAMERA_LOGICAL_MULTI_CAMERA_PHYSICAL_IDS, &entry) == ACAMERA_OK) {
+        info.physical_ids = (const char *)entry.data.u8;
+        info.physical_ids_size = entry.count;
+    }
+    return info;
+}
 
-    app->camera_manager = ACameraManager_create();
-    assert(app->camera_manager && "cannot create camera manager");
+void on_capture_started(void *context, ACameraCaptureSession *session, const ACaptureRequest *request, int64_t timestamp) {
+    (void)session;
+    (void)request;
+    Camera *camera = (Camera *)context;
 
-    // 1. list all available cameras
-    ACameraIdList *cameraIdList = NULL;
-    ret = ACameraManager_getCameraIdList(app->camera_manager, &cameraIdList);
-    assert(ret == ACAMERA_OK && cameraIdList && "cannot get cameras ids list");
+    TraceEvent event = {.type = TRACE_CAPTURE_STARTED, .sensor_timestamp = timestamp, .time = camera_now(camera)};
+    capture_trace_record(camera->trace, &event);
+}
+
+void on_capture_completed(void *context, ACameraCaptureSession *session, ACaptureRequest *request, const ACameraMetadata *result) {
+    (void)session;
+    (void)request;
+    Camera *camera = (Camera *)context;
+
+    TraceEvent event = {
+        .type = TRACE_CAPTURE_COMPLETED,
+        .sensor_timestamp = metadata_i64(result, ACAMERA_SENSOR_TIMESTAMP),
+        .time = camera_now(camera),
+        .exposure = metadata_i64(result, ACAMERA_SENSOR_EXPOSURE_TIME),
+        .frame_duration = metadata_i64(result, ACAMERA_SENSOR_FRAME_DURATION),
+        .sensitivity = (int32_t)metadata_i64(result, ACAMERA_SENSOR_SENSITIVITY),
+        .frame_number = metadata_i64(result, ACAMERA_SYNC_FRAME_NUMBER),
+    };
+    capture_trace_record(camera->trace, &event);
+
+    CaptureTrace *trace = camera->trace;
+    uint64_t completed = atomic_load(&trace->completed);
+    if (completed % CAMERA_STATS_FRAMES == 0) {
+        uint64_t images = atomic_load(&trace->images);
+        LOGI("camera %s capture: exposure %.2f ms | frame %.2f ms | iso %d | sensor to result %.2f ms | sensor to image %.2f ms | %lu gaps | %lu failed | %lu lost", camera->id, event.exposure / 1e6, event.frame_duration / 1e6, event.sensitivity, atomic_load(&trace->result_latency) / 1e6 / completed, images ? atomic_load(&trace->image_latency) / 1e6 / images : 0.0, (unsigned long)atomic_load(&trace->gaps), (unsigned long)atomic_load(&trace->failed), (unsigned long)atomic_load(&trace->lost));
+    }
+}
+
+void on_capture_failed(void *context, ACameraCaptureSession *session, ACaptureRequest *request, ACameraCaptureFailure *failure) {
+    (void)session;
+    (void)request;
+    Camera *camera = (Camera *)context;
+
+    TraceEvent event = {.type = TRACE_CAPTURE_FAILED, .time = camera_now(camera), .frame_number = failure->frameNumber};
+    capture_trace_record(camera->trace, &event);
+}
 
-    // 2. open the first available camera
-    ACameraDevice_StateCallbacks camera_state_callbacks = {0};
-    ret = ACameraManager_openCamera(app->camera_manager, cameraIdList->cameraIds[0], &camera_state_callbacks, &app->camera_device);
-    assert(ret == ACAMERA_OK && app->camera_device && "Failed to open camera device");
+void on_capture_buffer_lost(void *context, ACameraCaptureSession *session, ACaptureRequest *request, ANativeWindow *window, int64_t frame_number) {
+    (void)session;
+    (void)request;
+    (void)window;
+    Camera *camera = (Camera *)context;
+
+    TraceEvent event = {.type = TRACE_BUFFER_LOST, .time = camera_now(camera), .frame_number = frame_number};
+    capture_trace_record(camera->trace, &event);
+}
+
+#define CAMERA_DISCONNECTED -1
+
+// Losing any camera stops all of them.
+void on_camera_disconnected(void *context, ACameraDevice *device) {
+    AndroidApp *app = ((Camera *)context)->app;
+    LOGE("camera %s disconnected", ACameraDevice_getId(device));
+
+    pthread_mutex_lock(&app->mutex);
+    app->camera_error = CAMERA_DISCONNECTED;
+    pthread_cond_broadcast(&app->cond);
+    pthread_mutex_unlock(&app->mutex);
+}
+
+void on_camera_error(void *context, ACameraDevice *device, int error) {
+    AndroidApp *app = ((Camera *)context)->app;
+    LOGE("camera %s error %d", ACameraDevice_getId(device), error);
+
+    pthread_mutex_lock(&app->mutex);
+    app->camera_error = error;
+    pthread_cond_broadcast(&app->cond);
+    pthread_mutex_unlock(&app->mutex);
+}
+
+void on_session_active(void *context, ACameraCaptureSession *session) {
+    (void)session;
+    Camera *camera = (Camera *)context;
+    AndroidApp *app = camera->app;
+    LOGI("camera %s capture session active", camera->id);
+
+    pthread_mutex_lock(&app->mutex);
+    camera->session_active = true;
+    pthread_cond_broadcast(&app->cond);
+    pthread_mutex_unlock(&app->mutex);
+}
+
+void on_session_ready(void *context, ACameraCaptureSession *session) {
+    (void)session;
+    Camera *camera = (Camera *)context;
+    AndroidApp *app = camera->app;
+    LOGI("camera %s capture session ready", camera->id);
+
+    pthread_mutex_lock(&app->mutex);
+    camera->session_active = false;
+    pthread_cond_broadcast(&app->cond);
+    pthread_mutex_unlock(&app->mutex);
+}
+
+void on_session_closed(void *context, ACameraCaptureSession *session) {
+    (void)session;
+    Camera *camera = (Camera *)context;
+    AndroidApp *app = camera->app;
+    LOGI("camera %s capture session closed", camera->id);
+
+    pthread_mutex_lock(&app->mutex);
+    camera->session_active = false;
+    camera->session_closed = true;
+    pthread_cond_broadcast(&app->cond);
+    pthread_mutex_unlock(&app->mutex);
+}
+
+// Builds the outputs, request and session of an open camera and starts the
+// repeating request. Only the first camera gets the preview output.
+void camera_start(Camera *camera, const CaptureBudget *budget, bool preview) {
+    AndroidApp *app = camera->app;
+    ACameraMetadata *metadata = camera->characteristics;
+    int ret;
 
     // 3. create output container
-    ret = ACaptureSessionOutputContainer_create(&app->output_container);
-    assert(ret == ACAMERA_OK && app->output_container && "cannot create output container");
+    ret = ACaptureSessionOutputContainer_create(&camera->output_container);
+    assert(ret == ACAMERA_OK && camera->output_container && "cannot create output container");
+
+    ACameraMetadata_const_entry entry = {0};
+    ret = ACameraMetadata_getConstEntry(metadata, ACAMERA_SCALER_AVAILABLE_STREAM_CONFIGURATIONS, &entry);
+    assert(ret == ACAMERA_OK && "cannot get entry");
+
+    ACameraMetadata_const_entry durations = {0};
+    ACameraMetadata_getConstEntry(metadata, ACAMERA_SCALER_AVAILABLE_MIN_FRAME_DURATIONS, &durations);
+
+    // sensor sizes are landscape, the preview window is portrait
+    int32_t window_w = ANativeWindow_getWidth(app->preview_window);
+    int32_t window_h = ANativeWindow_getHeight(app->preview_window);
+    // capture results and images carry sensor timestamps; latencies are only
+    // meaningful against the same clock
+    camera->timestamp_clock = metadata_i64(metadata, ACAMERA_SENSOR_INFO_TIMESTAMP_SOURCE) == ACAMERA_SENSOR_INFO_TIMESTAMP_SOURCE_REALTIME ? CLOCK_BOOTTIME : CLOCK_MONOTONIC;
+    capture_trace_init(camera->trace);
+
+    float aspect = window_w > 0 && window_h > 0 ? (float)(window_w > window_h ? window_w : window_h) / (window_w > window_h ? window_h : window_w) : 0.0f;
 
     // 4. create preview session output and add to container
-    {
-        ret = ACaptureSessionOutput_create(app->preview_window, &app->preview_session_output);
-        assert(ret == ACAMERA_OK && app->preview_session_output && "cannot create preview session output");
+    if (preview) {
+        app->preview_output_window = app->preview_window;
+
+        if (app->gpu_preview) {
+            ACameraMetadata_const_entry orientation = {0};
+            ACameraMetadata_getConstEntry(metadata, ACAMERA_SENSOR_ORIENTATION, &orientation);
+
+            CapturePolicy policy = {.format = AIMAGE_FORMAT_PRIVATE, .fps = CAMERA_FPS, .max_pixel_rate = CAMERA_PREVIEW_PIXEL_RATE, .aspect = aspect, .aspect_tolerance = 0.05f};
+            CaptureConfig config;
+            if (capture_policy_choose(&policy, entry.data.i32, entry.count, durations.count ? durations.data.i64 : NULL, durations.count, &config) &&
+                preview_create(&app->preview, app->preview_window, config.width, config.height, orientation.count ? orientation.data.i32[0] : 0, camera->timestamp_clock) == 0) {
+                app->preview_output_window = preview_window(app->preview);
+            } else {
+                LOGE("cannot create GPU preview, falling back to the window");
+            }
+        }
 
-        ret = ACaptureSessionOutputContainer_add(app->output_container, app->preview_session_output);
+        ret = ACaptureSessionOutput_create(app->preview_output_window, &camera->preview_session_output);
+        assert(ret == ACAMERA_OK && camera->preview_session_output && "cannot create preview session output");
+
+        ret = ACaptureSessionOutputContainer_add(camera->output_container, camera->preview_session_output);
         assert(ret == ACAMERA_OK && "cannot add preview session output to the output container");
     }
 
     // 5. create process session output and add to container
     {
-        ACameraMetadata *metadata = NULL;
-        ret = ACameraManager_getCameraCharacteristics(app->camera_manager, cameraIdList->cameraIds[0], &metadata);
-        assert(ret == ACAMERA_OK && metadata && "cannot get camera characteristics");
-
-        ACameraMetadata_const_entry entry = {0};
-        ret = ACameraMetadata_getConstEntry(metadata, ACAMERA_SCALER_AVAILABLE_STREAM_CONFIGURATIONS, &entry);
-        assert(ret == ACAMERA_OK && "cannot get entry");
-
-        int32_t w = 0;
-        int32_t h = 0;
-        int32_t f = AIMAGE_FORMAT_YUV_420_888;
-
-        for (uint32_t i = 0; i < entry.count; i += 4) {
-            int32_t in_f = entry.data.i32[i + 0]; // format
-            int32_t in_w = entry.data.i32[i + 1]; // width
-            int32_t in_h = entry.data.i32[i + 2]; // height
-            int32_t is_i = entry.data.i32[i + 3]; // is input
-
-            if (is_i == 0 && in_f == f) {
-                if (in_w * in_h > w * h) {
-                    w = in_w;
-                    h = in_h;
-                }
+        CapturePolicy policy = {
+            .format = AIMAGE_FORMAT_YUV_420_888,
+            .fps = CAMERA_FPS,
+            .max_pixel_rate = budget->max_pixel_rate,
+            .aspect = aspect,
+            .aspect_tolerance = 0.05f,
+        };
+
+        bool chosen = capture_policy_choose(&policy, entry.data.i32, entry.count, durations.count ? durations.data.i64 : NULL, durations.count, &camera->process_config);
+        assert(chosen && "No supported sizes found for the desired format");
+
+        ACameraMetadata_const_entry ranges = {0};
+        if (ACameraMetadata_getConstEntry(metadata, ACAMERA_CONTROL_AE_AVAILABLE_TARGET_FPS_RANGES, &ranges) != ACAMERA_OK || !capture_policy_fps_range(ranges.data.i32, ranges.count, camera->process_config.fps, camera->fps_range)) {
+            camera->fps_range[0] = camera->fps_range[1] = 0;
+        }
+
+        const CaptureConfig *config = &camera->process_config;
+        LOGI("camera %s process stream: %dx%d @ %d fps | min frame duration %.2f ms | %.1f Mpx/s (budget %.1f) | ae range [%d, %d] | %d images | %d workers", camera->id, config->width, config->height, config->fps, config->min_frame_duration / 1e6, config->pixel_rate / 1e6, policy.max_pixel_rate / 1e6, camera->fps_range[0], camera->fps_range[1], budget->max_images, budget->workers);
+
+        int32_t w = config->width;
+        int32_t h = config->height;
+        int32_t f = config->format;
+
+        camera->max_images = budget->max_images;
+        atomic_init(&camera->images, 0);
+        atomic_init(&camera->skipped, 0);
+        ret = frame_pool_create(&camera->frame_pool, budget->workers, budget->max_images - 1, release_image, camera);
+        assert(ret == 0 && camera->frame_pool && "cannot create frame pool");
+
+        if (preview && CAMERA_ENCODE) {
+            char url[512];
+            if (CAMERA_STREAM_URL[0]) {
+                snprintf(url, sizeof(url), "%s", CAMERA_STREAM_URL);
+            } else {
+                snprintf(url, sizeof(url), "%s/capture.mp4", app->data_path);
+            }
+
+            EncoderConfig encoder_config = {.url = url, .fps = config->fps, .bit_rate = CAMERA_BIT_RATE, .max_queued = CAMERA_ENCODER_QUEUE};
+            if ((ret = encoder_create(&camera->encoder, &encoder_config, release_image, camera)) < 0) {
+                LOGE("camera %s cannot create encoder: %d", camera->id, ret);
+            } else {
+                LOGI("camera %s encoding to %s", camera->id, url);
             }
         }
-        assert(w > 0 && h > 0 && "No supported sizes found for the desired format");
-        ACameraMetadata_free(metadata);
 
-        AImageReader *reader = NULL;
-        ret = AImageReader_new(w, h, f, 5, &reader);
-        assert(ret == AMEDIA_OK && reader && "cannot create an image reader");
+        ret = AImageReader_new(w, h, f, budget->max_images, &camera->reader);
+        assert(ret == AMEDIA_OK && camera->reader && "cannot create an image reader");
 
-        AImageReader_ImageListener ln = {.context = NULL, .onImageAvailable = onImageAvailable};
-        ret = AImageReader_setImageListener(reader, &ln);
+        AImageReader_ImageListener ln = {.context = camera, .onImageAvailable = onImageAvailable};
+        ret = AImageReader_setImageListener(camera->reader, &ln);
         assert(ret == AMEDIA_OK && "cannot create an image listener");
 
-        ret = AImageReader_getWindow(reader, &app->process_window);
-        assert(ret == AMEDIA_OK && reader && "cannot get native window from the image reader");
+        ret = AImageReader_getWindow(camera->reader, &camera->process_window);
+        assert(ret == AMEDIA_OK && camera->process_window && "cannot get native window from the image reader");
 
-        ret = ACaptureSessionOutput_create(app->process_window, &app->process_session_output);
-        assert(ret == ACAMERA_OK && app->process_session_output && "cannot create process session output");
+        ret = ACaptureSessionOutput_create(camera->process_window, &camera->process_session_output);
+        assert(ret == ACAMERA_OK && camera->process_session_output && "cannot create process session output");
 
-        ret = ACaptureSessionOutputContainer_add(app->output_container, app->process_session_output);
+        ret = ACaptureSessionOutputContainer_add(camera->output_container, camera->process_session_output);
         assert(ret == ACAMERA_OK && "cannot add process session output to the output container");
     }
 
     // 6. create capture request
-    ret = ACameraDevice_createCaptureRequest(app->camera_device, TEMPLATE_PREVIEW, &app->capture_request);
-    assert(ret == ACAMERA_OK && app->capture_request && "cannot create capture request");
+    ret = ACameraDevice_createCaptureRequest(camera->camera_device, TEMPLATE_PREVIEW, &camera->capture_request);
+    assert(ret == ACAMERA_OK && camera->capture_request && "cannot create capture request");
 
-    {
+    if (preview) {
         // 7. create output target for preview and add to capture request
-        ret = ACameraOutputTarget_create(app->preview_window, &app->preview_output_target);
-        assert(ret == ACAMERA_OK && app->preview_output_target && "cannot create preview output target");
+        ret = ACameraOutputTarget_create(app->preview_output_window, &camera->preview_output_target);
+        assert(ret == ACAMERA_OK && camera->preview_output_target && "cannot create preview output target");
 
-        ret = ACaptureRequest_addTarget(app->capture_request, app->preview_output_target);
+        ret = ACaptureRequest_addTarget(camera->capture_request, camera->preview_output_target);
         assert(ret == ACAMERA_OK && "cannot add preview target to capture request");
     }
 
     {
         // 8. Create output target for process and add to capture request
-        ret = ACameraOutputTarget_create(app->process_window, &app->process_output_target);
-        assert(ret == ACAMERA_OK && app->process_output_target && "cannot create process output target");
+        ret = ACameraOutputTarget_create(camera->process_window, &camera->process_output_target);
+        assert(ret == ACAMERA_OK && camera->process_output_target && "cannot create process output target");
 
-        ret = ACaptureRequest_addTarget(app->capture_request, app->process_output_target);
+        ret = ACaptureRequest_addTarget(camera->capture_request, camera->process_output_target);
         assert(ret == ACAMERA_OK && "cannot add process target to capture request");
     }
 
+    if (camera->fps_range[1] > 0) {
+        ret = ACaptureRequest_setEntry_i32(camera->capture_request, ACAMERA_CONTROL_AE_TARGET_FPS_RANGE, 2, camera->fps_range);
+        if (ret != ACAMERA_OK) LOGE("camera %s cannot set target fps range: %d", camera->id, ret);
+    }
+
     // 8. create capture session
-    const ACameraCaptureSession_stateCallbacks capture_session_callbacks = {0};
-    ret = ACameraDevice_createCaptureSession(app->camera_device, app->output_container, &capture_session_callbacks, &app->camera_capture_session);
-    assert(ret == ACAMERA_OK && app->camera_capture_session && "cannot create capture session");
+    camera->capture_session_callbacks = (ACameraCaptureSession_stateCallbacks){.context = camera, .onClosed = on_session_closed, .onReady = on_session_ready, .onActive = on_session_active};
+    ret = ACameraDevice_createCaptureSession(camera->camera_device, camera->output_container, &camera->capture_session_callbacks, &camera->camera_capture_session);
+    assert(ret == ACAMERA_OK && camera->camera_capture_session && "cannot create capture session");
 
     // 9. start capture session
-    ret = ACameraCaptureSession_setRepeatingRequest(app->camera_capture_session, NULL, 1, &app->capture_request, NULL);
+    camera->capture_callbacks = (ACameraCaptureSession_captureCallbacks){
+        .context = camera,
+        .onCaptureStarted = on_capture_started,
+        .onCaptureCompleted = on_capture_completed,
+        .onCaptureFailed = on_capture_failed,
+        .onCaptureBufferLost = on_capture_buffer_lost,
+    };
+    ret = ACameraCaptureSession_setRepeatingRequest(camera->camera_capture_session, &camera->capture_callbacks, 1, &camera->capture_request, NULL);
     assert(ret == ACAMERA_OK && "cannot start capture session");
+}
 
-    while (app->running) {
-        // nothing
-    }
+// Frees what camera_start built once its session has closed, then the device.
+void camera_release(Camera *camera) {
+    camera->camera_capture_session = NULL;
 
-    if (cameraIdList) ACameraManager_deleteCameraIdList(cameraIdList);
-    if (app->camera_capture_session) {
-        ACameraCaptureSession_stopRepeating(app->camera_capture_session);
-        ACameraCaptureSession_close(app->camera_capture_session);
+    if (camera->capture_request) ACaptureRequest_free(camera->capture_request);
+    if (camera->output_container) ACaptureSessionOutputContainer_free(camera->output_container);
+
+    if (camera->preview_output_target) ACameraOutputTarget_free(camera->preview_output_target);
+    if (camera->preview_session_output) ACaptureSessionOutput_free(camera->preview_session_output);
+
+    if (camera->process_output_target) ACameraOutputTarget_free(camera->process_output_target);
+    if (camera->process_session_output) ACaptureSessionOutput_free(camera->process_session_output);
+
+    if (camera->camera_device) ACameraDevice_close(camera->camera_device);
+    if (camera->characteristics) ACameraMetadata_free(camera->characteristics);
+}
+
+void *camera_task(void *arg) {
+    int ret;
+
+    AndroidApp *app = (AndroidApp *)arg;
+
+    pthread_mutex_lock(&app->mutex);
+    app->camera_error = 0;
+    pthread_mutex_unlock(&app->mutex);
+
+    app->camera_manager = ACameraManager_create();
+    assert(app->camera_manager && "cannot create camera manager");
+
+    // 1. list all available cameras and pick the ones to run together
+    ACameraIdList *cameraIdList = NULL;
+    ret = ACameraManager_getCameraIdList(app->camera_manager, &cameraIdList);
+    assert(ret == ACAMERA_OK && cameraIdList && cameraIdList->numCameras > 0 && "cannot get cameras ids list");
+
+    int camera_count = 0;
+    CameraInfo *infos = calloc(cameraIdList->numCameras, sizeof(CameraInfo));
+    ACameraMetadata **characteristics = calloc(cameraIdList->numCameras, sizeof(ACameraMetadata *));
+    for (int i = 0; i < cameraIdList->numCameras; i++) {
+        const char *id = cameraIdList->cameraIds[i];
+        ACameraMetadata *metadata = NULL;
+        if (ACameraManager_getCameraCharacteristics(app->camera_manager, id, &metadata) != ACAMERA_OK || !metadata) {
+            LOGE("cannot get characteristics of camera %s", id);
+            continue;
+        }
+
+        CameraInfo *info = &infos[camera_count];
+        *info = camera_info(metadata, id);
+        characteristics[camera_count++] = metadata;
+        LOGI("camera %s: facing %d | hardware level %d | %s", id, info->facing, info->hardware_level, info->logical ? "logical multi-camera" : "single");
     }
 
-    if (app->capture_request) ACaptureRequest_free(app->capture_request);
-    if (app->output_container) ACaptureSessionOutputContainer_free(app->output_container);
+    int selected[CAMERA_MAX_CAMERAS];
+    int selected_count = capture_policy_select_cameras(infos, camera_count, CAMERA_MAX_CAMERAS, selected);
+
+    // 2. open the selected cameras; the device may refuse to run them together
+    // (ACAMERA_ERROR_MAX_CAMERA_IN_USE), so carry on with the ones that opened
+    app->camera_count = 0;
+    for (int i = 0; i < selected_count; i++) {
+        Camera *camera = &app->cameras[app->camera_count];
+        CaptureTrace *trace = camera->trace;
+        *camera = (Camera){.app = app, .id = infos[selected[i]].id, .trace = trace};
+
+        camera->camera_state_callbacks = (ACameraDevice_StateCallbacks){.context = camera, .onDisconnected = on_camera_disconnected, .onError = on_camera_error};
+        ret = ACameraManager_openCamera(app->camera_manager, camera->id, &camera->camera_state_callbacks, &camera->camera_device);
+        if (ret != ACAMERA_OK || !camera->camera_device) {
+            LOGE("cannot open camera %s: %d", camera->id, ret);
+            continue;
+        }
 
-    if (app->preview_output_target) ACameraOutputTarget_free(app->preview_output_target);
-    if (app->preview_session_output) ACaptureSessionOutput_free(app->preview_session_output);
+        camera->characteristics = characteristics[selected[i]];
+        characteristics[selected[i]] = NULL;
+        app->camera_count++;
+    }
+    for (int i = 0; i < camera_count; i++) {
+        if (characteristics[i]) ACameraMetadata_free(characteristics[i]);
+    }
+    free(characteristics);
+    free(infos);
+    assert(app->camera_count > 0 && "Failed to open camera device");
+
+    // every open camera gets an even share of the buffers
+    CaptureBudget total = {.max_images = CAMERA_IMAGE_BUDGET, .workers = CAMERA_WORKER_BUDGET, .max_pixel_rate = CAMERA_PIXEL_RATE_BUDGET};
+    CaptureBudget stream_max = {.max_images = CAMERA_MAX_IMAGES, .workers = CAMERA_WORKERS, .max_pixel_rate = CAMERA_MAX_PIXEL_RATE};
+    CaptureBudget share;
+    int streams = capture_policy_share_budget(&total, &stream_max, app->camera_count, &share);
+    assert(streams > 0 && "the capture budget cannot carry a single camera");
+    while (app->camera_count > streams) camera_release(&app->cameras[--app->camera_count]);
+
+    for (int i = 0; i < app->camera_count; i++) camera_start(&app->cameras[i], &share, i == 0);
+
+    // frames are delivered on the camera's own threads; this one just sleeps
+    // until the window goes away or a device is lost
+    pthread_mutex_lock(&app->mutex);
+    while (app->running && app->camera_error == 0) pthread_cond_wait(&app->cond, &app->mutex);
+    if (app->camera_error != 0) LOGE("stopping capture after camera error %d", app->camera_error);
+    pthread_mutex_unlock(&app->mutex);
+
+    for (int i = 0; i < app->camera_count; i++) {
+        Camera *camera = &app->cameras[i];
+        if (!camera->camera_capture_session) continue;
+
+        // only an active session has a repeating request to stop; one that
+        // never started or went idle after an error goes straight to close,
+        // which cancels whatever is left
+        pthread_mutex_lock(&app->mutex);
+        bool active = camera->session_active;
+        pthread_mutex_unlock(&app->mutex);
+        if (active) ACameraCaptureSession_stopRepeating(camera->camera_capture_session);
+        ACameraCaptureSession_close(camera->camera_capture_session);
+    }
 
-    if (app->process_output_target) ACameraOutputTarget_free(app->process_output_target);
-    if (app->process_session_output) ACaptureSessionOutput_free(app->process_session_output);
+    // the outputs must not be freed while a session is still draining
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += CAMERA_CLOSE_TIMEOUT_MS / 1000;
+    deadline.tv_nsec += (CAMERA_CLOSE_TIMEOUT_MS % 1000) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
 
-    if (app->camera_device) ACameraDevice_close(app->camera_device);
+    pthread_mutex_lock(&app->mutex);
+    for (int i = 0; i < app->camera_count; i++) {
+        Camera *camera = &app->cameras[i];
+        while (camera->camera_capture_session && !camera->session_closed) {
+            if (pthread_cond_timedwait(&app->cond, &app->mutex, &deadline) != 0) {
+                LOGE("camera %s capture session did not close within %d ms", camera->id, CAMERA_CLOSE_TIMEOUT_MS);
+                break;
+            }
+        }
+    }
+    pthread_mutex_unlock(&app->mutex);
+
+    for (int i = 0; i < app->camera_count; i++) camera_release(&app->cameras[i]);
+
+    // every image goes back to its reader before it is deleted
+    preview_destroy(&app->preview);
+    CaptureTrace *traces[CAMERA_MAX_CAMERAS];
+    const char *names[CAMERA_MAX_CAMERAS];
+    for (int i = 0; i < app->camera_count; i++) {
+        Camera *camera = &app->cameras[i];
+        frame_pool_destroy(&camera->frame_pool);
+        encoder_destroy(&camera->encoder);
+        if (camera->reader) {
+            AImageReader_delete(camera->reader);
+            camera->reader = NULL;
+        }
+        traces[i] = camera->trace;
+        names[i] = camera->id;
+    }
     if (app->camera_manager) ACameraManager_delete(app->camera_manager);
 
+    char path[512];
+    snprintf(path, sizeof(path), "%s/capture_trace.json", app->data_path);
+    if ((ret = capture_trace_export(traces, names, app->camera_count, path)) < 0) {
+        LOGE("cannot write %s: %d", path, ret);
+    } else {
+        LOGI("capture trace: %s", path);
+    }
+
+    // the camera ids point into the list
+    ACameraManager_deleteCameraIdList(cameraIdList);
+    app->camera_count = 0;
+
     return NULL;
 }
 
@@ -201,7 +703,10 @@ void on_window_init(ANativeActivity *activity, ANativeWindow *window) {
     AndroidApp *app = (AndroidApp *)activity->instance;
 
     app->preview_window = window;
+
+    pthread_mutex_lock(&app->mutex);
     app->running = true;
+    pthread_mutex_unlock(&app->mutex);
 
     pthread_create(&app->thread, NULL, camera_task, app);
 }
@@ -212,7 +717,10 @@ void on_window_deinit(ANativeActivity *activity, ANativeWindow *window) {
 
     AndroidApp *app = (AndroidApp *)activity->instance;
 
+    pthread_mutex_lock(&app->mutex);
     app->running = false;
+    pthread_cond_broadcast(&app->cond);
+    pthread_mutex_unlock(&app->mutex);
 
     pthread_join(app->thread, NULL);
 
@@ -225,6 +733,19 @@ JNIEXPORT void ANativeActivity_onCreate(ANativeActivity *activity, void *savedSt
 
     AndroidApp *app = malloc(sizeof(AndroidApp));
     memset(app, 0, sizeof(AndroidApp));
+    app->gpu_preview = CAMERA_GPU_PREVIEW;
+    app->data_path = activity->externalDataPath ? activity->externalDataPath : activity->internalDataPath;
+    for (int i = 0; i < CAMERA_MAX_CAMERAS; i++) {
+        app->cameras[i].trace = malloc(sizeof(CaptureTrace));
+        capture_trace_init(app->cameras[i].trace);
+    }
+
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&app->cond, &attr);
+    pthread_condattr_destroy(&attr);
+    pthread_mutex_init(&app->mutex, NULL);
 
     activity->callbacks->onNativeWindowCreated = on_window_init;
     activity->callbacks->onNativeWindowDestroyed = on_window_deinit;
@@ -0,0 +1,162 @@
+#include "capture_policy.h"
+
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+static int64_t capture_min_duration(const int64_t *durations, uint32_t count, int32_t format, int32_t width, int32_t height) {
+    for (uint32_t i = 0; i + 4 <= count; i += 4) {
+        if (durations[i + 0] == format && durations[i + 1] == width && durations[i + 2] == height) return durations[i + 3];
+    }
+    return 0;
+}
+
+static bool capture_matches_aspect(const CapturePolicy *policy, int32_t width, int32_t height) {
+    if (policy->aspect <= 0.0f) return true;
+    float aspect = (float)width / height;
+    return fabsf(aspect - policy->aspect) <= policy->aspect * policy->aspect_tolerance;
+}
+
+bool capture_policy_choose(const CapturePolicy *policy, const int32_t *configs, uint32_t configs_count, const int64_t *durations, uint32_t durations_count, CaptureConfig *config) {
+    // tiers from best to worst: in budget with the right shape, in budget with
+    // any shape, reaches fps over budget (lowest rate wins), anything (fastest wins)
+    CaptureConfig best[4] = {0};
+
+    for (uint32_t i = 0; i + 4 <= configs_count; i += 4) {
+        int32_t format = configs[i + 0];
+        int32_t width = configs[i + 1];
+        int32_t height = configs[i + 2];
+        int32_t is_input = configs[i + 3];
+        if (is_input || format != policy->format || width <= 0 || height <= 0) continue;
+
+        CaptureConfig candidate = {.format = format, .width = width, .height = height};
+        candidate.min_frame_duration = capture_min_duration(durations, durations_count, format, width, height);
+
+        int32_t max_fps = candidate.min_frame_duration > 0 ? (int32_t)(1000000000LL / candidate.min_frame_duration) : policy->fps;
+        candidate.fps = max_fps < policy->fps ? max_fps : policy->fps;
+        candidate.pixel_rate = (int64_t)width * height * candidate.fps;
+
+        int64_t area = (int64_t)width * height;
+        bool fast = candidate.fps >= policy->fps;
+        bool in_budget = fast && candidate.pixel_rate <= policy->max_pixel_rate;
+
+        if (in_budget && capture_matches_aspect(policy, width, height)) {
+            if (area > (int64_t)best[0].width * best[0].height) best[0] = candidate;
+        } else if (in_budget) {
+            if (area > (int64_t)best[1].width * best[1].height) best[1] = candidate;
+        } else if (fast) {
+            if (best[2].width == 0 || candidate.pixel_rate < best[2].pixel_rate) best[2] = candidate;
+        } else {
+            if (best[3].width == 0 || candidate.fps > best[3].fps || (candidate.fps == best[3].fps && area < (int64_t)best[3].width * best[3].height)) best[3] = candidate;
+        }
+    }
+
+    for (int tier = 0; tier < 4; tier++) {
+        if (best[tier].width > 0) {
+            *config = best[tier];
+            return true;
+        }
+    }
+    return false;
+}
+
+bool capture_policy_fps_range(const int32_t *ranges, uint32_t ranges_count, int32_t fps, int32_t range[2]) {
+    bool found = false;
+
+    for (uint32_t i = 0; i + 2 <= ranges_count; i += 2) {
+        int32_t low = ranges[i + 0];
+        int32_t high = ranges[i + 1];
+
+        if (!found) {
+            range[0] = low;
+            range[1] = high;
+            found = true;
+            continue;
+        }
+
+        // closest maximum first, then the highest minimum (narrowest range),
+        // so exposure cannot stretch frames below the wanted rate
+        int32_t distance = high > fps ? high - fps : fps - high;
+        int32_t best_distance = range[1] > fps ? range[1] - fps : fps - range[1];
+        if (distance < best_distance || (distance == best_distance && low > range[0])) {
+            range[0] = low;
+            range[1] = high;
+        }
+    }
+
+    return found;
+}
+
+// ACAMERA_LENS_FACING_*, in the order they are filled
+static const int32_t capture_facings[] = {1 /* BACK */, 0 /* FRONT */, 2 /* EXTERNAL */};
+// ACAMERA_INFO_SUPPORTED_HARDWARE_LEVEL_*, least capable first
+static const int32_t capture_levels[] = {2 /* LEGACY */, 4 /* EXTERNAL */, 0 /* LIMITED */, 1 /* FULL */, 3 /* LEVEL_3 */};
+
+static int capture_level_rank(int32_t level) {
+    for (int i = 0; i < (int)(sizeof(capture_levels) / sizeof(capture_levels[0])); i++) {
+        if (capture_levels[i] == level) return i;
+    }
+    return -1;
+}
+
+static bool capture_better_camera(const CameraInfo *a, const CameraInfo *b) {
+    if (a->logical != b->logical) return a->logical;
+    return capture_level_rank(a->hardware_level) > capture_level_rank(b->hardware_level);
+}
+
+static bool capture_is_member(const CameraInfo *logical, const char *id) {
+    const char *end = logical->physical_ids + logical->physical_ids_size;
+    for (const char *physical = logical->physical_ids; physical && physical < end; physical += strnlen(physical, end - physical) + 1) {
+        if (strncmp(physical, id, end - physical) == 0) return true;
+    }
+    return false;
+}
+
+static bool capture_can_select(const CameraInfo *cameras, const int *selected, int chosen, int candidate) {
+    const CameraInfo *camera = &cameras[candidate];
+    for (int i = 0; i < chosen; i++) {
+        const CameraInfo *other = &cameras[selected[i]];
+        if (selected[i] == candidate || capture_is_member(other, camera->id) || capture_is_member(camera, other->id)) return false;
+    }
+    return true;
+}
+
+// The best selectable camera facing `facing`, or of any facing when it is -1.
+static int capture_best_camera(const CameraInfo *cameras, int count, const int *selected, int chosen, int32_t facing) {
+    int best = -1;
+    for (int i = 0; i < count; i++) {
+        if (facing >= 0 && cameras[i].facing != facing) continue;
+        if (!capture_can_select(cameras, selected, chosen, i)) continue;
+        if (best < 0 || capture_better_camera(&cameras[i], &cameras[best])) best = i;
+    }
+    return best;
+}
+
+int capture_policy_select_cameras(const CameraInfo *cameras, int count, int max, int *selected) {
+    int chosen = 0;
+
+    for (int i = 0; i < (int)(sizeof(capture_facings) / sizeof(capture_facings[0])) && chosen < max; i++) {
+        int best = capture_best_camera(cameras, count, selected, chosen, capture_facings[i]);
+        if (best >= 0) selected[chosen++] = best;
+    }
+    while (chosen < max) {
+        int best = capture_best_camera(cameras, count, selected, chosen, -1);
+        if (best < 0) break;
+        selected[chosen++] = best;
+    }
+
+    return chosen;
+}
+
+int capture_policy_share_budget(const CaptureBudget *total, const CaptureBudget *stream_max, int streams, CaptureBudget *share) {
+    while (streams > 0 && (total->max_images / streams < 2 || total->workers / streams < 1)) streams--;
+    if (streams == 0) return 0;
+
+    int32_t images = total->max_images / streams;
+    int32_t workers = total->workers / streams;
+    int64_t pixel_rate = total->max_pixel_rate / streams;
+    share->max_images = images < stream_max->max_images ? images : stream_max->max_images;
+    share->workers = workers < stream_max->workers ? workers : stream_max->workers;
+    share->max_pixel_rate = pixel_rate < stream_max->max_pixel_rate ? pixel_rate : stream_max->max_pixel_rate;
+    return streams;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Pure selection logic over raw camera characteristics, kept free of NDK calls
+// so it can be exercised on the host with captured metadata arrays.
+
+// What the pipeline needs from a stream. Sizes are picked by throughput, not
+// area: the largest size of the right shape whose pixel rate at `fps` stays
+// within `max_pixel_rate`.
+typedef struct {
+    int32_t format;
+    int32_t fps;            // wanted frame rate
+    int64_t max_pixel_rate; // pixels per second the consumer can take
+    float aspect;           // width / height, 0 for any
+    float aspect_tolerance; // relative, e.g. 0.02
+} CapturePolicy;
+
+typedef struct {
+    int32_t format;
+    int32_t width;
+    int32_t height;
+    int64_t min_frame_duration; // ns, 0 when the camera does not report one
+    int32_t fps;                // rate the stream will run at
+    int64_t pixel_rate;         // width * height * fps
+} CaptureConfig;
+
+// `configs` is ACAMERA_SCALER_AVAILABLE_STREAM_CONFIGURATIONS (format, width,
+// height, is_input) and `durations` ACAMERA_SCALER_AVAILABLE_MIN_FRAME_DURATIONS
+// (format, width, height, ns), both as flat arrays of `*_count` values.
+//
+// Falls back, in order, to ignoring the aspect ratio and then to the lowest
+// pixel rate that still reaches `fps`, and finally to the fastest size. Returns
+// false only when the format is not offered at all.
+bool capture_policy_choose(const CapturePolicy *policy, const int32_t *configs, uint32_t configs_count, const int64_t *durations, uint32_t durations_count, CaptureConfig *config);
+
+// Picks from ACAMERA_CONTROL_AE_AVAILABLE_TARGET_FPS_RANGES (min, max pairs)
+// the fixed or narrowest range topping out at `fps`, else the range with the
+// closest maximum. Returns false when `ranges` is empty.
+bool capture_policy_fps_range(const int32_t *ranges, uint32_t ranges_count, int32_t fps, int32_t range[2]);
+
+// One entry of ACameraManager_getCameraIdList with the characteristics camera
+// selection looks at. Values are as in NdkCameraMetadataTags.h.
+typedef struct {
+    const char *id;
+    int32_t facing;            // ACAMERA_LENS_FACING_*
+    int32_t hardware_level;    // ACAMERA_INFO_SUPPORTED_HARDWARE_LEVEL_*
+    bool logical;              // has the LOGICAL_MULTI_CAMERA capability
+    const char *physical_ids;  // ACAMERA_LOGICAL_MULTI_CAMERA_PHYSICAL_IDS, NUL separated
+    uint32_t physical_ids_size;
+} CameraInfo;
+
+// Picks up to `max` cameras to open at the same time and writes their indices
+// to `selected`, best first: the best camera of each facing (back, front, then
+// external), then any others. Logical multi-cameras win over single ones, then
+// the higher hardware level. A camera is skipped when it is a physical member
+// of one already picked (or the other way round), which would open the same
+// sensor twice. Returns the number picked.
+int capture_policy_select_cameras(const CameraInfo *cameras, int count, int max, int *selected);
+
+// Buffers and threads shared by every open camera, so a second camera splits
+// the memory and CPU of the first instead of doubling them.
+typedef struct {
+    int32_t max_images;     // AImageReader slots
+    int32_t workers;        // frame pool threads
+    int64_t max_pixel_rate; // processing throughput, pixels per second
+} CaptureBudget;
+
+// Splits `total` evenly over `streams`, each share capped at `stream_max`. A
+// stream needs at least two images (one in the workers, one to acquire) and a
+// worker; returns how many streams the budget carries, at most `streams`.
+int capture_policy_share_budget(const CaptureBudget *total, const CaptureBudget *stream_max, int streams, CaptureBudget *share);
@@ -0,0 +1,314 @@
+// Host test of capture_policy.c: stream selection over metadata arrays shaped
+// like a phone's ACAMERA_SCALER_* and ACAMERA_CONTROL_* entries, camera
+// selection over a camera id list and the split of camera.c's capture budget,
+// e.g.
+//
+//     make test
+
+#include <stdio.h>
+
+#include "capture_policy.h"
+
+#define FORMAT_YUV 0x23   // AIMAGE_FORMAT_YUV_420_888
+#define FORMAT_JPEG 0x100 // AIMAGE_FORMAT_JPEG
+#define FPS_15 66666666LL
+#define FPS_24 41666666LL
+#define FPS_30 33333333LL
+#define FPS_60 16666666LL
+#define RATE_1080P30 (1920LL * 1080 * 30)
+#define RATE_720P30 (1280LL * 720 * 30)
+#define FACING_FRONT 0 // ACAMERA_LENS_FACING_*
+#define FACING_BACK 1
+#define FACING_EXTERNAL 2
+#define LEVEL_LIMITED 0 // ACAMERA_INFO_SUPPORTED_HARDWARE_LEVEL_*
+#define LEVEL_FULL 1
+#define LEVEL_LEGACY 2
+#define LEVEL_3 3
+
+static int failures;
+
+#define CHECK(cond)                                                            \
+    do {                                                                       \
+        if (!(cond)) {                                                         \
+            fprintf(stderr, "%s:%d: %s: %s\n", __FILE__, __LINE__, __func__, #cond); \
+            failures++;                                                        \
+        }                                                                      \
+    } while (0)
+
+#define COUNT(array) (uint32_t)(sizeof(array) / sizeof(array[0]))
+
+// A typical back camera: a full-resolution 4:3 sensor that only reaches 15 fps,
+// 16:9 and 4:3 video sizes at 30 fps and a small preview size at 60.
+static const int32_t configs[] = {
+    FORMAT_YUV, 4032, 3024, 0,
+    FORMAT_YUV, 1920, 1080, 0,
+    FORMAT_YUV, 1440, 1080, 0,
+    FORMAT_YUV, 1280, 720, 0,
+    FORMAT_YUV, 640, 480, 0,
+    FORMAT_YUV, 4096, 4096, 1, // reprocessing input, never an output
+    FORMAT_JPEG, 4032, 3024, 0,
+};
+
+static const int64_t durations[] = {
+    FORMAT_YUV, 4032, 3024, FPS_15,
+    FORMAT_YUV, 1920, 1080, FPS_30,
+    FORMAT_YUV, 1440, 1080, FPS_30,
+    FORMAT_YUV, 1280, 720, FPS_30,
+    FORMAT_YUV, 640, 480, FPS_60,
+    FORMAT_JPEG, 4032, 3024, FPS_15,
+};
+
+static bool choose(const CapturePolicy *policy, CaptureConfig *config) {
+    return capture_policy_choose(policy, configs, COUNT(configs), durations, COUNT(durations), config);
+}
+
+// Tier 1: the largest size of the wanted shape within the pixel-rate budget.
+static void test_choose_in_budget(void) {
+    CaptureConfig config;
+    CapturePolicy policy = {.format = FORMAT_YUV, .fps = 30, .max_pixel_rate = RATE_1080P30, .aspect = 16.0f / 9.0f, .aspect_tolerance = 0.02f};
+    CHECK(choose(&policy, &config));
+    CHECK(config.width == 1920 && config.height == 1080);
+    CHECK(config.fps == 30);
+    CHECK(config.min_frame_duration == FPS_30);
+    CHECK(config.pixel_rate == RATE_1080P30);
+
+    // a 4:3 consumer takes 1440x1080 over the larger 1920x1080
+    policy.aspect = 4.0f / 3.0f;
+    CHECK(choose(&policy, &config));
+    CHECK(config.width == 1440 && config.height == 1080);
+
+    // a smaller budget steps down within the shape
+    policy.aspect = 16.0f / 9.0f;
+    policy.max_pixel_rate = 1280LL * 720 * 30;
+    CHECK(choose(&policy, &config));
+    CHECK(config.width == 1280 && config.height == 720);
+
+    // the 4032x3024 sensor size is too slow however large the budget
+    policy.aspect = 0.0f;
+    policy.max_pixel_rate = INT64_MAX;
+    CHECK(choose(&policy, &config));
+    CHECK(config.width == 1920 && config.height == 1080);
+}
+
+// Tier 2: no size of the wanted shape fits, the largest of any shape does.
+static void test_choose_any_aspect(void) {
+    CaptureConfig config;
+    CapturePolicy policy = {.format = FORMAT_YUV, .fps = 30, .max_pixel_rate = RATE_1080P30, .aspect = 21.0f / 9.0f, .aspect_tolerance = 0.02f};
+    CHECK(choose(&policy, &config));
+    CHECK(config.width == 1920 && config.height == 1080);
+
+    // 4:3 in budget only at 640x480, which beats the larger 16:9 sizes
+    policy.aspect = 4.0f / 3.0f;
+    policy.max_pixel_rate = 1280LL * 720 * 30;
+    CHECK(choose(&policy, &config));
+    CHECK(config.width == 640 && config.height == 480);
+}
+
+// Tier 3: nothing reaching the frame rate fits the budget, so the lowest pixel
+// rate that still reaches it wins.
+static void test_choose_over_budget(void) {
+    CaptureConfig config;
+    CapturePolicy policy = {.format = FORMAT_YUV, .fps = 30, .max_pixel_rate = 1000, .aspect = 16.0f / 9.0f, .aspect_tolerance = 0.02f};
+    CHECK(choose(&policy, &config));
+    CHECK(config.width == 640 && config.height == 480);
+    CHECK(config.fps == 30);
+    CHECK(config.pixel_rate == 640LL * 480 * 30);
+}
+
+// Tier 4: no size reaches the frame rate; the fastest wins, the smallest of
+// those on a tie.
+static void test_choose_too_slow(void) {
+    static const int32_t slow_configs[] = {
+        FORMAT_YUV, 4032, 3024, 0,
+        FORMAT_YUV, 1920, 1080, 0,
+        FORMAT_YUV, 1280, 720, 0,
+    };
+    static const int64_t slow_durations[] = {
+        FORMAT_YUV, 4032, 3024, FPS_15,
+        FORMAT_YUV, 1920, 1080, FPS_24,
+        FORMAT_YUV, 1280, 720, FPS_24,
+    };
+
+    CaptureConfig config;
+    CapturePolicy policy = {.format = FORMAT_YUV, .fps = 30, .max_pixel_rate = RATE_1080P30};
+    CHECK(capture_policy_choose(&policy, slow_configs, COUNT(slow_configs), slow_durations, COUNT(slow_durations), &config));
+    CHECK(config.width == 1280 && config.height == 720);
+    CHECK(config.fps == 24);
+    CHECK(config.min_frame_duration == FPS_24);
+}
+
+// Without durations every size is assumed to reach the wanted rate.
+static void test_choose_no_durations(void) {
+    CaptureConfig config;
+    CapturePolicy policy = {.format = FORMAT_YUV, .fps = 30, .max_pixel_rate = INT64_MAX};
+    CHECK(capture_policy_choose(&policy, configs, COUNT(configs), NULL, 0, &config));
+    CHECK(config.width == 4032 && config.height == 3024);
+    CHECK(config.fps == 30);
+    CHECK(config.min_frame_duration == 0);
+}
+
+static void test_choose_missing_format(void) {
+    CaptureConfig config;
+    CapturePolicy policy = {.format = 0x20 /* RAW16 */, .fps = 30, .max_pixel_rate = INT64_MAX};
+    CHECK(!choose(&policy, &config));
+    CHECK(!capture_policy_choose(&policy, NULL, 0, NULL, 0, &config));
+}
+
+static void test_fps_range(void) {
+    static const int32_t ranges[] = {15, 30, 7, 30, 30, 30, 24, 24, 60, 60};
+    int32_t range[2];
+
+    // the fixed range wins over wider ones with the same maximum
+    CHECK(capture_policy_fps_range(ranges, COUNT(ranges), 30, range));
+    CHECK(range[0] == 30 && range[1] == 30);
+
+    CHECK(capture_policy_fps_range(ranges, COUNT(ranges), 24, range));
+    CHECK(range[0] == 24 && range[1] == 24);
+
+    CHECK(capture_policy_fps_range(ranges, COUNT(ranges), 60, range));
+    CHECK(range[0] == 60 && range[1] == 60);
+
+    // no range tops out at 25: the closest maximum
+    CHECK(capture_policy_fps_range(ranges, COUNT(ranges), 25, range));
+    CHECK(range[0] == 24 && range[1] == 24);
+
+    // the narrowest of several ranges with the same maximum
+    static const int32_t variable[] = {7, 30, 15, 30, 10, 30};
+    CHECK(capture_policy_fps_range(variable, COUNT(variable), 30, range));
+    CHECK(range[0] == 15 && range[1] == 30);
+
+    // a single range is taken whatever it is
+    static const int32_t single[] = {15, 15};
+    CHECK(capture_policy_fps_range(single, COUNT(single), 30, range));
+    CHECK(range[0] == 15 && range[1] == 15);
+
+    CHECK(!capture_policy_fps_range(NULL, 0, 30, range));
+}
+
+// A phone with a logical back camera over two physical ones, which are also
+// listed on their own, and a front camera.
+static const CameraInfo phone[] = {
+    {.id = "0", .facing = FACING_BACK, .hardware_level = LEVEL_FULL, .logical = true, .physical_ids = "2\0" "3", .physical_ids_size = 4},
+    {.id = "1", .facing = FACING_FRONT, .hardware_level = LEVEL_LIMITED},
+    {.id = "2", .facing = FACING_BACK, .hardware_level = LEVEL_3},
+    {.id = "3", .facing = FACING_BACK, .hardware_level = LEVEL_FULL},
+};
+
+static void test_select_cameras(void) {
+    int selected[4];
+
+    // the logical back camera over its faster member, then the front one
+    CHECK(capture_policy_select_cameras(phone, COUNT(phone), 2, selected) == 2);
+    CHECK(selected[0] == 0 && selected[1] == 1);
+
+    // room for more, but the rest are members of camera 0
+    CHECK(capture_policy_select_cameras(phone, COUNT(phone), 4, selected) == 2);
+
+    CHECK(capture_policy_select_cameras(phone, COUNT(phone), 1, selected) == 1);
+    CHECK(selected[0] == 0);
+
+    // without logical cameras the higher hardware level wins within a facing
+    static const CameraInfo singles[] = {
+        {.id = "0", .facing = FACING_BACK, .hardware_level = LEVEL_LEGACY},
+        {.id = "1", .facing = FACING_BACK, .hardware_level = LEVEL_FULL},
+        {.id = "2", .facing = FACING_BACK, .hardware_level = LEVEL_LIMITED},
+    };
+    CHECK(capture_policy_select_cameras(singles, COUNT(singles), 3, selected) == 3);
+    CHECK(selected[0] == 1 && selected[1] == 2 && selected[2] == 0);
+
+    // a logical camera over one already picked opens the same sensor
+    static const CameraInfo external[] = {
+        {.id = "4", .facing = FACING_EXTERNAL, .hardware_level = LEVEL_3, .logical = true, .physical_ids = "5", .physical_ids_size = 2},
+        {.id = "5", .facing = FACING_BACK, .hardware_level = LEVEL_3},
+    };
+    CHECK(capture_policy_select_cameras(external, COUNT(external), 2, selected) == 1);
+    CHECK(selected[0] == 1);
+}
+
+static void test_select_one_camera(void) {
+    static const CameraInfo only[] = {{.id = "0", .facing = FACING_EXTERNAL, .hardware_level = LEVEL_LEGACY}};
+    int selected[2] = {-1, -1};
+    CHECK(capture_policy_select_cameras(only, COUNT(only), 2, selected) == 1);
+    CHECK(selected[0] == 0 && selected[1] == -1);
+}
+
+static void test_select_no_camera(void) {
+    int selected[2] = {-1, -1};
+    CHECK(capture_policy_select_cameras(NULL, 0, 2, selected) == 0);
+    CHECK(capture_policy_select_cameras(phone, COUNT(phone), 0, selected) == 0);
+    CHECK(selected[0] == -1);
+}
+
+// camera.c's budget: 8 images, 3 workers and 1080p30 over every camera, each
+// camera capped at 5 images, 2 workers and 720p30.
+static const CaptureBudget total = {.max_images = 8, .workers = 3, .max_pixel_rate = RATE_1080P30};
+static const CaptureBudget stream_max = {.max_images = 5, .workers = 2, .max_pixel_rate = RATE_720P30};
+
+static void test_share_budget(void) {
+    CaptureBudget share;
+
+    // two cameras: even halves, the pixel rate still capped at 720p30
+    CHECK(capture_policy_share_budget(&total, &stream_max, 2, &share) == 2);
+    CHECK(share.max_images == 4);
+    CHECK(share.workers == 1);
+    CHECK(share.max_pixel_rate == RATE_720P30);
+
+    // three cameras: two images and a worker each, a third of the pixel rate
+    CHECK(capture_policy_share_budget(&total, &stream_max, 3, &share) == 3);
+    CHECK(share.max_images == 2);
+    CHECK(share.workers == 1);
+    CHECK(share.max_pixel_rate == RATE_1080P30 / 3);
+
+    // a fourth camera would get no worker
+    CHECK(capture_policy_share_budget(&total, &stream_max, 4, &share) == 3);
+    CHECK(share.max_images == 2 && share.workers == 1);
+
+    // too few images for two streams
+    CaptureBudget small = {.max_images = 3, .workers = 3, .max_pixel_rate = RATE_1080P30};
+    CHECK(capture_policy_share_budget(&small, &stream_max, 2, &share) == 1);
+    CHECK(share.max_images == 3 && share.workers == 2);
+}
+
+static void test_share_one_camera(void) {
+    // the whole budget is over every cap
+    CaptureBudget share;
+    CHECK(capture_policy_share_budget(&total, &stream_max, 1, &share) == 1);
+    CHECK(share.max_images == 5);
+    CHECK(share.workers == 2);
+    CHECK(share.max_pixel_rate == RATE_720P30);
+}
+
+static void test_share_no_camera(void) {
+    CaptureBudget share = {0};
+    CHECK(capture_policy_share_budget(&total, &stream_max, 0, &share) == 0);
+    CHECK(share.max_images == 0);
+
+    // a budget that cannot carry a single stream
+    CaptureBudget starved = {.max_images = 1, .workers = 3, .max_pixel_rate = RATE_1080P30};
+    CHECK(capture_policy_share_budget(&starved, &stream_max, 2, &share) == 0);
+    starved = (CaptureBudget){.max_images = 8, .workers = 0, .max_pixel_rate = RATE_1080P30};
+    CHECK(capture_policy_share_budget(&starved, &stream_max, 1, &share) == 0);
+}
+
+int main(void) {
+    test_choose_in_budget();
+    test_choose_any_aspect();
+    test_choose_over_budget();
+    test_choose_too_slow();
+    test_choose_no_durations();
+    test_choose_missing_format();
+    test_fps_range();
+    test_select_cameras();
+    test_select_one_camera();
+    test_select_no_camera();
+    test_share_budget();
+    test_share_one_camera();
+    test_share_no_camera();
+
+    if (failures) {
+        fprintf(stderr, "capture_policy_test: %d checks failed\n", failures);
+        return 1;
+    }
+    printf("capture_policy_test: ok\n");
+    return 0;
+}
@@ -0,0 +1,130 @@
+#include "capture_trace.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+static const char *trace_names[] = {
+    [TRACE_CAPTURE_STARTED] = "started",
+    [TRACE_CAPTURE_COMPLETED] = "result",
+    [TRACE_CAPTURE_FAILED] = "failed",
+    [TRACE_BUFFER_LOST] = "buffer lost",
+    [TRACE_IMAGE_ARRIVED] = "image",
+    [TRACE_FRAME_GAP] = "gap",
+};
+
+void capture_trace_init(CaptureTrace *trace) {
+    for (int i = 0; i < CAPTURE_TRACE_RECORDS; i++) atomic_init(&trace->records[i].sequence, 0);
+    atomic_init(&trace->head, 0);
+    atomic_init(&trace->completed, 0);
+    atomic_init(&trace->images, 0);
+    atomic_init(&trace->failed, 0);
+    atomic_init(&trace->lost, 0);
+    atomic_init(&trace->gaps, 0);
+    atomic_init(&trace->result_latency, 0);
+    atomic_init(&trace->image_latency, 0);
+    atomic_init(&trace->last_sensor_timestamp, 0);
+}
+
+static void capture_trace_store(CaptureTrace *trace, const TraceEvent *event) {
+    uint64_t ticket = atomic_fetch_add_explicit(&trace->head, 1, memory_order_relaxed);
+    TraceRecord *record = &trace->records[ticket & (CAPTURE_TRACE_RECORDS - 1)];
+
+    atomic_store_explicit(&record->sequence, 2 * ticket + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    record->event = *event;
+    atomic_store_explicit(&record->sequence, 2 * ticket + 2, memory_order_release);
+}
+
+void capture_trace_record(CaptureTrace *trace, const TraceEvent *event) {
+    capture_trace_store(trace, event);
+
+    switch (event->type) {
+    case TRACE_CAPTURE_COMPLETED: {
+        atomic_fetch_add_explicit(&trace->completed, 1, memory_order_relaxed);
+        atomic_fetch_add_explicit(&trace->result_latency, event->time - event->sensor_timestamp, memory_order_relaxed);
+
+        // a result more than half a frame late means the sensor skipped frames
+        int64_t last = atomic_exchange_explicit(&trace->last_sensor_timestamp, event->sensor_timestamp, memory_order_relaxed);
+        int64_t delta = event->sensor_timestamp - last;
+        if (last > 0 && event->frame_duration > 0 && delta * 2 > event->frame_duration * 3) {
+            int64_t missing = (delta + event->frame_duration / 2) / event->frame_duration - 1;
+            TraceEvent gap = {.type = TRACE_FRAME_GAP, .sensor_timestamp = last, .time = event->sensor_timestamp, .frame_number = missing};
+            capture_trace_store(trace, &gap);
+            atomic_fetch_add_explicit(&trace->gaps, (uint64_t)missing, memory_order_relaxed);
+        }
+        break;
+    }
+    case TRACE_IMAGE_ARRIVED:
+        atomic_fetch_add_explicit(&trace->images, 1, memory_order_relaxed);
+        atomic_fetch_add_explicit(&trace->image_latency, event->time - event->sensor_timestamp, memory_order_relaxed);
+        break;
+    case TRACE_CAPTURE_FAILED:
+        atomic_fetch_add_explicit(&trace->failed, 1, memory_order_relaxed);
+        break;
+    case TRACE_BUFFER_LOST:
+        atomic_fetch_add_explicit(&trace->lost, 1, memory_order_relaxed);
+        break;
+    default:
+        break;
+    }
+}
+
+// Copies the record written for `ticket`, or returns false when it is being
+// written or has already been overwritten.
+static bool capture_trace_load(CaptureTrace *trace, uint64_t ticket, TraceEvent *event) {
+    TraceRecord *record = &trace->records[ticket & (CAPTURE_TRACE_RECORDS - 1)];
+
+    uint64_t before = atomic_load_explicit(&record->sequence, memory_order_acquire);
+    if (before != 2 * ticket + 2) return false;
+    *event = record->event;
+    atomic_thread_fence(memory_order_acquire);
+    return atomic_load_explicit(&record->sequence, memory_order_relaxed) == before;
+}
+
+static void capture_trace_write(FILE *file, CaptureTrace *trace, const char *label, int pid, bool comma) {
+    uint64_t head = atomic_load_explicit(&trace->head, memory_order_acquire);
+    uint64_t first = head > CAPTURE_TRACE_RECORDS ? head - CAPTURE_TRACE_RECORDS : 0;
+
+    fprintf(file, "%s{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": %d, \"args\": {\"name\": \"camera %s\"}}", comma ? ",\n" : "", pid, label);
+
+    // one track per event kind; spans run from the sensor timestamp to arrival
+    for (uint64_t ticket = first; ticket < head; ticket++) {
+        TraceEvent e;
+        if (!capture_trace_load(trace, ticket, &e)) continue;
+
+        const char *name = trace_names[e.type];
+        double ts = e.sensor_timestamp / 1e3;
+        double dur = (e.time - e.sensor_timestamp) / 1e3;
+        fprintf(file, ",\n");
+
+        switch (e.type) {
+        case TRACE_CAPTURE_COMPLETED:
+            fprintf(file, "{\"name\": \"exposure\", \"ph\": \"X\", \"pid\": %d, \"tid\": 1, \"ts\": %.3f, \"dur\": %.3f, \"args\": {\"frame_duration_ms\": %.3f, \"iso\": %d}},\n", pid, ts, e.exposure / 1e3, e.frame_duration / 1e6, e.sensitivity);
+            fprintf(file, "{\"name\": \"%s\", \"ph\": \"X\", \"pid\": %d, \"tid\": 2, \"ts\": %.3f, \"dur\": %.3f, \"args\": {\"frame\": %ld}}", name, pid, ts, dur, (long)e.frame_number);
+            break;
+        case TRACE_IMAGE_ARRIVED:
+            fprintf(file, "{\"name\": \"%s\", \"ph\": \"X\", \"pid\": %d, \"tid\": 3, \"ts\": %.3f, \"dur\": %.3f}", name, pid, ts, dur);
+            break;
+        case TRACE_FRAME_GAP:
+            fprintf(file, "{\"name\": \"%s\", \"ph\": \"X\", \"pid\": %d, \"tid\": 4, \"ts\": %.3f, \"dur\": %.3f, \"args\": {\"missing\": %ld}}", name, pid, ts, dur, (long)e.frame_number);
+            break;
+        default:
+            fprintf(file, "{\"name\": \"%s\", \"ph\": \"i\", \"s\": \"t\", \"pid\": %d, \"tid\": 4, \"ts\": %.3f, \"args\": {\"frame\": %ld}}", name, pid, (e.sensor_timestamp ? e.sensor_timestamp : e.time) / 1e3, (long)e.frame_number);
+            break;
+        }
+    }
+}
+
+int capture_trace_export(CaptureTrace *const *traces, const char *const *names, int count, const char *path) {
+    FILE *file = fopen(path, "w");
+    if (!file) return -errno;
+
+    fprintf(file, "{\"traceEvents\": [\n");
+    for (int i = 0; i < count; i++) capture_trace_write(file, traces[i], names[i], i + 1, i > 0);
+    fprintf(file, "\n]}\n");
+
+    int ret = ferror(file) ? -EIO : 0;
+    fclose(file);
+    return ret;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// Flight recorder for per-frame capture events. Camera callbacks and image
+// listeners run on different threads, so writers claim a slot with a single
+// atomic increment and publish it with a per-slot sequence number (a seqlock);
+// nobody ever waits. The ring keeps the newest CAPTURE_TRACE_RECORDS events and
+// is written out as a Chrome/Perfetto JSON trace for offline analysis.
+#define CAPTURE_TRACE_RECORDS 4096 // power of two
+
+typedef enum {
+    TRACE_CAPTURE_STARTED,
+    TRACE_CAPTURE_COMPLETED,
+    TRACE_CAPTURE_FAILED,
+    TRACE_BUFFER_LOST,
+    TRACE_IMAGE_ARRIVED,
+    TRACE_FRAME_GAP,
+} TraceType;
+
+typedef struct {
+    TraceType type;
+    int64_t sensor_timestamp; // ACAMERA_SENSOR_TIMESTAMP / AImage_getTimestamp, start of exposure
+    int64_t time;             // when the event reached the app, same clock as the sensor timestamp
+    int64_t exposure;         // ns, completed results only
+    int64_t frame_duration;   // ns, completed results only
+    int32_t sensitivity;      // ISO, completed results only
+    int64_t frame_number;     // or the number of missing frames for TRACE_FRAME_GAP
+} TraceEvent;
+
+typedef struct {
+    _Atomic uint64_t sequence; // 2 * ticket + 1 while writing, 2 * ticket + 2 once written
+    TraceEvent event;
+} TraceRecord;
+
+typedef struct {
+    TraceRecord records[CAPTURE_TRACE_RECORDS];
+    _Atomic uint64_t head;
+
+    // running totals for the periodic log
+    _Atomic uint64_t completed;
+    _Atomic uint64_t images;
+    _Atomic uint64_t failed;
+    _Atomic uint64_t lost;
+    _Atomic uint64_t gaps;
+    _Atomic int64_t result_latency; // sum over completed, ns
+    _Atomic int64_t image_latency;  // sum over images, ns
+    _Atomic int64_t last_sensor_timestamp;
+} CaptureTrace;
+
+void capture_trace_init(CaptureTrace *trace);
+// Lock-free; safe from any number of threads. Also updates the totals and
+// records a TRACE_FRAME_GAP when completed results skip sensor frames.
+void capture_trace_record(CaptureTrace *trace, const TraceEvent *event);
+// Writes the retained events of `count` traces as {"traceEvents": [...]} with
+// microsecond times, one process per trace labelled with `names`. Records
+// overwritten while exporting are skipped. Returns 0 or -errno.
+int capture_trace_export(CaptureTrace *const *traces, const char *const *names, int count, const char *path);
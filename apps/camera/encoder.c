@@ -0,0 +1,343 @@
+#include "encoder.h"
+
+#include <libavcodec/avcodec.h>
+#include <libavformat/avformat.h>
+#include <libavutil/opt.h>
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// What the AVBuffer of a wrapped frame owns.
+typedef struct {
+    Encoder *encoder;
+    Frame frame;
+} EncoderBuffer;
+
+struct Encoder {
+    FrameRelease release;
+    void *context;
+    char *url;
+    int32_t fps;
+    int64_t bit_rate;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    bool closing;
+    pthread_t thread;
+    bool started;
+
+    // waiting frames, a ring of max_queued slots
+    Frame *frames;
+    int max_queued;
+    int head;
+    int queued;
+
+    // owned by the encoding thread
+    AVCodecContext *codec;
+    AVFormatContext *format;
+    AVStream *stream;
+    AVFrame *picture;
+    AVPacket *packet;
+    int64_t first_timestamp;
+    bool header_written;
+
+    uint64_t submitted;
+    uint64_t dropped;
+    uint64_t encoded;
+    uint64_t mismatched;
+    uint64_t packets;
+    uint64_t bytes;
+    int64_t encode_ns;
+    int error;
+};
+
+static int64_t encoder_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// YUV_420_888 is planar or semi-planar depending on the device; both map onto
+// a pixel format libx264 takes without conversion.
+static enum AVPixelFormat encoder_pixel_format(const Frame *frame) {
+    if (frame->uv_pixel_stride == 1) return AV_PIX_FMT_YUV420P;
+    if (frame->uv_pixel_stride == 2 && frame->v == frame->u + 1) return AV_PIX_FMT_NV12;
+    if (frame->uv_pixel_stride == 2 && frame->u == frame->v + 1) return AV_PIX_FMT_NV21;
+    return AV_PIX_FMT_NONE;
+}
+
+static int encoder_open(Encoder *encoder, const Frame *frame) {
+    int ret;
+
+    enum AVPixelFormat pix_fmt = encoder_pixel_format(frame);
+    if (pix_fmt == AV_PIX_FMT_NONE) return AVERROR(EINVAL);
+
+    // not any H.264 encoder: the options below are libx264's, and the others an
+    // Android FFmpeg build may carry (h264_mediacodec) take no borrowed planes
+    const AVCodec *codec = avcodec_find_encoder_by_name("libx264");
+    if (!codec) return AVERROR_ENCODER_NOT_FOUND;
+
+    encoder->codec = avcodec_alloc_context3(codec);
+    if (!encoder->codec) return AVERROR(ENOMEM);
+
+    // timestamps are the sensor's, in microseconds; camera YUV is full range
+    AVCodecContext *c = encoder->codec;
+    c->width = frame->width;
+    c->height = frame->height;
+    c->pix_fmt = pix_fmt;
+    c->color_range = AVCOL_RANGE_JPEG;
+    c->time_base = (AVRational){1, 1000000};
+    c->framerate = (AVRational){encoder->fps, 1};
+    c->bit_rate = encoder->bit_rate;
+    c->gop_size = encoder->fps;
+    c->max_b_frames = 0;
+    av_opt_set(c->priv_data, "preset", "veryfast", 0);
+    av_opt_set(c->priv_data, "tune", "zerolatency", 0);
+
+    bool rtmp = strncmp(encoder->url, "rtmp://", 7) == 0;
+    if ((ret = avformat_alloc_output_context2(&encoder->format, NULL, rtmp ? "flv" : NULL, encoder->url)) < 0) return ret;
+    if (encoder->format->oformat->flags & AVFMT_GLOBALHEADER) c->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
+
+    if ((ret = avcodec_open2(c, codec, NULL)) < 0) return ret;
+
+    encoder->stream = avformat_new_stream(encoder->format, NULL);
+    if (!encoder->stream) return AVERROR(ENOMEM);
+    encoder->stream->time_base = c->time_base;
+    if ((ret = avcodec_parameters_from_context(encoder->stream->codecpar, c)) < 0) return ret;
+
+    if (!(encoder->format->oformat->flags & AVFMT_NOFILE) && (ret = avio_open(&encoder->format->pb, encoder->url, AVIO_FLAG_WRITE)) < 0) return ret;
+    if ((ret = avformat_write_header(encoder->format, NULL)) < 0) return ret;
+    encoder->header_written = true;
+
+    encoder->first_timestamp = frame->timestamp;
+    return 0;
+}
+
+static void encoder_free_buffer(void *opaque, uint8_t *data) {
+    (void)data;
+    EncoderBuffer *buffer = opaque;
+    buffer->encoder->release(buffer->encoder->context, &buffer->frame);
+    free(buffer);
+}
+
+// Points the picture at the frame's planes; the frame is released when the
+// last reference to the picture goes away.
+static int encoder_wrap(Encoder *encoder, const Frame *frame) {
+    AVFrame *picture = encoder->picture;
+
+    EncoderBuffer *buffer = malloc(sizeof(EncoderBuffer));
+    if (!buffer) return AVERROR(ENOMEM);
+    buffer->encoder = encoder;
+    buffer->frame = *frame;
+
+    picture->buf[0] = av_buffer_create((uint8_t *)frame->y, frame->y_stride * frame->height, encoder_free_buffer, buffer, AV_BUFFER_FLAG_READONLY);
+    if (!picture->buf[0]) {
+        free(buffer);
+        return AVERROR(ENOMEM);
+    }
+
+    picture->format = encoder->codec->pix_fmt;
+    picture->width = frame->width;
+    picture->height = frame->height;
+    picture->color_range = AVCOL_RANGE_JPEG;
+    picture->pts = (frame->timestamp - encoder->first_timestamp) / 1000;
+    picture->data[0] = (uint8_t *)frame->y;
+    picture->linesize[0] = frame->y_stride;
+    switch (encoder->codec->pix_fmt) {
+    case AV_PIX_FMT_NV12:
+        picture->data[1] = (uint8_t *)frame->u;
+        picture->linesize[1] = frame->uv_stride;
+        break;
+    case AV_PIX_FMT_NV21:
+        picture->data[1] = (uint8_t *)frame->v;
+        picture->linesize[1] = frame->uv_stride;
+        break;
+    default:
+        picture->data[1] = (uint8_t *)frame->u;
+        picture->data[2] = (uint8_t *)frame->v;
+        picture->linesize[1] = picture->linesize[2] = frame->uv_stride;
+        break;
+    }
+    return 0;
+}
+
+// Encodes `frame`, or drains the codec when it is NULL, and writes out every
+// packet that comes back. The frame is released on every path. Returns 0, 1
+// when the frame was released unencoded for not matching the layout the codec
+// was opened with, or an AVERROR.
+static int encoder_encode(Encoder *encoder, const Frame *frame) {
+    int ret;
+
+    if (frame) {
+        if (!encoder->codec && (ret = encoder_open(encoder, frame)) < 0) {
+            encoder->release(encoder->context, frame);
+            return ret;
+        }
+        // the layout of the first frame is the one the codec was opened with
+        if (frame->width != encoder->codec->width || frame->height != encoder->codec->height || encoder_pixel_format(frame) != encoder->codec->pix_fmt) {
+            encoder->release(encoder->context, frame);
+            return 1;
+        }
+        if ((ret = encoder_wrap(encoder, frame)) < 0) {
+            encoder->release(encoder->context, frame);
+            return ret;
+        }
+    }
+
+    ret = avcodec_send_frame(encoder->codec, frame ? encoder->picture : NULL);
+    av_frame_unref(encoder->picture);
+    if (ret < 0) return ret;
+
+    while ((ret = avcodec_receive_packet(encoder->codec, encoder->packet)) >= 0) {
+        av_packet_rescale_ts(encoder->packet, encoder->codec->time_base, encoder->stream->time_base);
+        encoder->packet->stream_index = encoder->stream->index;
+
+        pthread_mutex_lock(&encoder->mutex);
+        encoder->packets++;
+        encoder->bytes += encoder->packet->size;
+        pthread_mutex_unlock(&encoder->mutex);
+
+        if ((ret = av_interleaved_write_frame(encoder->format, encoder->packet)) < 0) return ret;
+    }
+    return ret == AVERROR(EAGAIN) || ret == AVERROR_EOF ? 0 : ret;
+}
+
+static void *encoder_thread(void *arg) {
+    Encoder *encoder = arg;
+
+    pthread_mutex_lock(&encoder->mutex);
+    for (;;) {
+        while (!encoder->closing && encoder->queued == 0) pthread_cond_wait(&encoder->cond, &encoder->mutex);
+        if (encoder->queued == 0) break;
+
+        Frame frame = encoder->frames[encoder->head];
+        encoder->head = (encoder->head + 1) % encoder->max_queued;
+        int error = encoder->error;
+        pthread_mutex_unlock(&encoder->mutex);
+
+        int64_t start = encoder_now();
+        int ret = 0;
+        if (error) {
+            encoder->release(encoder->context, &frame);
+        } else {
+            ret = encoder_encode(encoder, &frame);
+        }
+
+        pthread_mutex_lock(&encoder->mutex);
+        // the slot stays taken until the frame is handed back
+        encoder->queued--;
+        if (!error && ret == 0) {
+            encoder->encoded++;
+            encoder->encode_ns += encoder_now() - start;
+        } else if (ret == 1) {
+            encoder->mismatched++;
+        }
+        if (ret < 0 && !encoder->error) encoder->error = ret;
+    }
+    int error = encoder->error;
+    pthread_mutex_unlock(&encoder->mutex);
+
+    if (encoder->header_written && !error) {
+        int ret = encoder_encode(encoder, NULL);
+        pthread_mutex_lock(&encoder->mutex);
+        if (ret < 0 && !encoder->error) encoder->error = ret;
+        pthread_mutex_unlock(&encoder->mutex);
+    }
+    if (encoder->header_written) av_write_trailer(encoder->format);
+
+    return NULL;
+}
+
+int encoder_create(Encoder **out, const EncoderConfig *config, FrameRelease release, void *context) {
+    if (config->max_queued < 1 || config->fps < 1) return -EINVAL;
+
+    Encoder *encoder = calloc(1, sizeof(Encoder));
+    if (!encoder) return -ENOMEM;
+
+    encoder->release = release;
+    encoder->context = context;
+    encoder->url = strdup(config->url);
+    encoder->fps = config->fps;
+    encoder->bit_rate = config->bit_rate;
+    encoder->max_queued = config->max_queued;
+    encoder->frames = calloc(config->max_queued, sizeof(Frame));
+    encoder->picture = av_frame_alloc();
+    encoder->packet = av_packet_alloc();
+    pthread_mutex_init(&encoder->mutex, NULL);
+    pthread_cond_init(&encoder->cond, NULL);
+
+    if (!encoder->url || !encoder->frames || !encoder->picture || !encoder->packet) {
+        encoder_destroy(&encoder);
+        return -ENOMEM;
+    }
+
+    if (pthread_create(&encoder->thread, NULL, encoder_thread, encoder) != 0) {
+        encoder_destroy(&encoder);
+        return -EAGAIN;
+    }
+    encoder->started = true;
+
+    *out = encoder;
+    return 0;
+}
+
+bool encoder_submit(Encoder *encoder, const Frame *frame) {
+    pthread_mutex_lock(&encoder->mutex);
+    encoder->submitted++;
+
+    if (encoder->closing || encoder->queued >= encoder->max_queued) {
+        encoder->dropped++;
+        pthread_mutex_unlock(&encoder->mutex);
+        return false;
+    }
+
+    int tail = (encoder->head + encoder->queued) % encoder->max_queued;
+    encoder->frames[tail] = *frame;
+    encoder->queued++;
+
+    pthread_cond_signal(&encoder->cond);
+    pthread_mutex_unlock(&encoder->mutex);
+    return true;
+}
+
+void encoder_stats(Encoder *encoder, EncoderStats *stats) {
+    pthread_mutex_lock(&encoder->mutex);
+    stats->submitted = encoder->submitted;
+    stats->dropped = encoder->dropped;
+    stats->encoded = encoder->encoded;
+    stats->mismatched = encoder->mismatched;
+    stats->packets = encoder->packets;
+    stats->bytes = encoder->bytes;
+    stats->encode_ns = encoder->encode_ns;
+    stats->queued = encoder->queued;
+    stats->error = encoder->error;
+    pthread_mutex_unlock(&encoder->mutex);
+}
+
+void encoder_destroy(Encoder **pencoder) {
+    Encoder *encoder = *pencoder;
+    if (!encoder) return;
+
+    pthread_mutex_lock(&encoder->mutex);
+    encoder->closing = true;
+    pthread_cond_broadcast(&encoder->cond);
+    pthread_mutex_unlock(&encoder->mutex);
+
+    if (encoder->started) pthread_join(encoder->thread, NULL);
+
+    if (encoder->format && encoder->format->pb) avio_closep(&encoder->format->pb);
+    avformat_free_context(encoder->format);
+    avcodec_free_context(&encoder->codec);
+    av_packet_free(&encoder->packet);
+    av_frame_free(&encoder->picture);
+
+    pthread_cond_destroy(&encoder->cond);
+    pthread_mutex_destroy(&encoder->mutex);
+    free(encoder->frames);
+    free(encoder->url);
+    free(encoder);
+    *pencoder = NULL;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "frame_pool.h"
+
+// H.264 encoder and muxer (libx264 through libavcodec, MP4 or FLV over RTMP)
+// for borrowed YUV_420_888 frames. Each frame is wrapped as an AVFrame whose
+// buffer points straight at the producer's planes; libx264 copies the picture
+// into its own lookahead inside avcodec_send_frame, and the buffer's free
+// callback hands the frame to `release` right after. One thread encodes and
+// writes; at most `max_queued` frames are waiting or being encoded, past that
+// frames are refused so the producer can give them back at once.
+typedef struct Encoder Encoder;
+
+typedef struct {
+    const char *url; // file path (container from the extension) or rtmp://
+    int32_t fps;
+    int64_t bit_rate;
+    int max_queued;
+} EncoderConfig;
+
+typedef struct {
+    uint64_t submitted;
+    uint64_t dropped; // refused because max_queued frames were already held
+    uint64_t encoded;
+    uint64_t mismatched; // released unencoded: size or chroma layout differs from the first frame
+    uint64_t packets;
+    uint64_t bytes;
+    int64_t encode_ns; // total time in the encoder and muxer
+    int queued;
+    int error; // first AVERROR, after which frames are released unencoded
+} EncoderStats;
+
+// The codec and the output are opened on the first frame, when the size and
+// the chroma layout are known; without libx264 in the FFmpeg build that fails
+// with AVERROR_ENCODER_NOT_FOUND in the stats' error. Returns 0 or -errno.
+int encoder_create(Encoder **encoder, const EncoderConfig *config, FrameRelease release, void *context);
+// Queues a frame for encoding. Returns false, without taking the frame, when
+// max_queued frames are already held.
+bool encoder_submit(Encoder *encoder, const Frame *frame);
+void encoder_stats(Encoder *encoder, EncoderStats *stats);
+// Encodes the queued frames, flushes the codec, writes the trailer and joins
+// the thread.
+void encoder_destroy(Encoder **encoder);
@@ -0,0 +1,247 @@
+#include "frame_pool.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define FRAME_POOL_MAX_WORKERS 8
+
+typedef struct {
+    Frame frame;
+    uint64_t sequence;
+} FrameJob;
+
+typedef struct {
+    FramePool *pool;
+    uint8_t *thumbnail;
+    size_t thumbnail_size;
+} FrameWorker;
+
+struct FramePool {
+    FrameRelease release;
+    void *context;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    bool closing;
+
+    // queued jobs, a ring of max_in_flight slots
+    FrameJob *jobs;
+    int max_in_flight;
+    int head;
+    int queued;
+    int in_flight; // queued + being processed
+
+    pthread_t threads[FRAME_POOL_MAX_WORKERS];
+    FrameWorker workers[FRAME_POOL_MAX_WORKERS];
+    int nb_workers;
+
+    // thumbnail of the newest processed frame, swapped with the worker's buffer
+    // so motion is always measured against the previous frame in capture order
+    uint8_t *previous;
+    size_t previous_size;
+    int32_t previous_width;
+    int32_t previous_height;
+    uint64_t previous_sequence;
+
+    uint64_t submitted;
+    uint64_t dropped;
+    uint64_t processed;
+    int64_t process_ns;
+    FrameResult latest;
+};
+
+static int64_t frame_pool_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// One pass over the luma plane: histogram every pixel and box filter 8x8 tiles
+// into the thumbnail. Chroma is not touched.
+static void frame_analyze_luma(const Frame *frame, FrameResult *result, uint8_t *thumbnail, int32_t thumb_width, int32_t thumb_height) {
+    uint32_t sums[4096 / FRAME_THUMBNAIL_SCALE];
+    uint64_t total = 0;
+
+    memset(result->histogram, 0, sizeof(result->histogram));
+
+    for (int32_t ty = 0; ty < thumb_height; ty++) {
+        memset(sums, 0, thumb_width * sizeof(uint32_t));
+
+        for (int32_t dy = 0; dy < FRAME_THUMBNAIL_SCALE; dy++) {
+            const uint8_t *row = frame->y + (size_t)(ty * FRAME_THUMBNAIL_SCALE + dy) * frame->y_stride;
+            for (int32_t tx = 0; tx < thumb_width; tx++) {
+                const uint8_t *p = row + tx * FRAME_THUMBNAIL_SCALE;
+                uint32_t sum = 0;
+                for (int32_t dx = 0; dx < FRAME_THUMBNAIL_SCALE; dx++) {
+                    result->histogram[p[dx]]++;
+                    sum += p[dx];
+                }
+                sums[tx] += sum;
+            }
+        }
+
+        for (int32_t tx = 0; tx < thumb_width; tx++) {
+            thumbnail[ty * thumb_width + tx] = (uint8_t)(sums[tx] / (FRAME_THUMBNAIL_SCALE * FRAME_THUMBNAIL_SCALE));
+            total += sums[tx];
+        }
+    }
+
+    uint64_t pixels = (uint64_t)thumb_width * thumb_height * FRAME_THUMBNAIL_SCALE * FRAME_THUMBNAIL_SCALE;
+    result->mean_luma = pixels ? (float)total / pixels : 0.0f;
+}
+
+static float frame_motion(const uint8_t *a, const uint8_t *b, size_t size) {
+    uint64_t diff = 0;
+    for (size_t i = 0; i < size; i++) diff += a[i] > b[i] ? a[i] - b[i] : b[i] - a[i];
+    return size ? (float)diff / size : 0.0f;
+}
+
+static void *frame_pool_worker(void *arg) {
+    FrameWorker *worker = arg;
+    FramePool *pool = worker->pool;
+
+    pthread_mutex_lock(&pool->mutex);
+    for (;;) {
+        while (!pool->closing && pool->queued == 0) pthread_cond_wait(&pool->cond, &pool->mutex);
+        if (pool->queued == 0) break;
+
+        FrameJob job = pool->jobs[pool->head];
+        pool->head = (pool->head + 1) % pool->max_in_flight;
+        pool->queued--;
+        pthread_mutex_unlock(&pool->mutex);
+
+        int64_t start = frame_pool_now();
+        const Frame *frame = &job.frame;
+
+        // only whole tiles, so a thumbnail row never reads past the plane
+        int32_t thumb_width = frame->width / FRAME_THUMBNAIL_SCALE;
+        int32_t thumb_height = frame->height / FRAME_THUMBNAIL_SCALE;
+        if (thumb_width > 4096 / FRAME_THUMBNAIL_SCALE) thumb_width = 4096 / FRAME_THUMBNAIL_SCALE;
+        size_t thumb_size = (size_t)thumb_width * thumb_height;
+        if (thumb_size > worker->thumbnail_size) {
+            free(worker->thumbnail);
+            worker->thumbnail = malloc(thumb_size);
+            worker->thumbnail_size = worker->thumbnail ? thumb_size : 0;
+        }
+
+        FrameResult result = {.sequence = job.sequence, .timestamp = frame->timestamp};
+        if (worker->thumbnail) frame_analyze_luma(frame, &result, worker->thumbnail, thumb_width, thumb_height);
+
+        // the planes are no longer needed: hand the buffer back right away
+        pool->release(pool->context, frame);
+
+        pthread_mutex_lock(&pool->mutex);
+        if (worker->thumbnail && job.sequence > pool->previous_sequence) {
+            if (pool->previous && pool->previous_width == thumb_width && pool->previous_height == thumb_height) {
+                result.motion = frame_motion(worker->thumbnail, pool->previous, thumb_size);
+            }
+
+            uint8_t *previous = pool->previous;
+            size_t previous_size = pool->previous_size;
+            pool->previous = worker->thumbnail;
+            pool->previous_size = worker->thumbnail_size;
+            pool->previous_width = thumb_width;
+            pool->previous_height = thumb_height;
+            pool->previous_sequence = job.sequence;
+            worker->thumbnail = previous;
+            worker->thumbnail_size = previous_size;
+        }
+
+        result.process_ns = frame_pool_now() - start;
+        if (result.sequence >= pool->latest.sequence) pool->latest = result;
+        pool->processed++;
+        pool->process_ns += result.process_ns;
+        pool->in_flight--;
+    }
+    pthread_mutex_unlock(&pool->mutex);
+
+    return NULL;
+}
+
+int frame_pool_create(FramePool **out, int workers, int max_in_flight, FrameRelease release, void *context) {
+    if (workers < 1) workers = 1;
+    if (workers > FRAME_POOL_MAX_WORKERS) workers = FRAME_POOL_MAX_WORKERS;
+    if (max_in_flight < 1) return -EINVAL;
+
+    FramePool *pool = calloc(1, sizeof(FramePool));
+    if (!pool) return -ENOMEM;
+
+    pool->release = release;
+    pool->context = context;
+    pool->max_in_flight = max_in_flight;
+    pool->jobs = calloc(max_in_flight, sizeof(FrameJob));
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->cond, NULL);
+
+    if (!pool->jobs) {
+        frame_pool_destroy(&pool);
+        return -ENOMEM;
+    }
+
+    for (int i = 0; i < workers; i++) {
+        pool->workers[i].pool = pool;
+        if (pthread_create(&pool->threads[i], NULL, frame_pool_worker, &pool->workers[i]) != 0) {
+            frame_pool_destroy(&pool);
+            return -EAGAIN;
+        }
+        pool->nb_workers++;
+    }
+
+    *out = pool;
+    return 0;
+}
+
+bool frame_pool_submit(FramePool *pool, const Frame *frame) {
+    pthread_mutex_lock(&pool->mutex);
+    pool->submitted++;
+
+    if (pool->closing || pool->in_flight >= pool->max_in_flight) {
+        pool->dropped++;
+        pthread_mutex_unlock(&pool->mutex);
+        return false;
+    }
+
+    int tail = (pool->head + pool->queued) % pool->max_in_flight;
+    pool->jobs[tail].frame = *frame;
+    pool->jobs[tail].sequence = pool->submitted;
+    pool->queued++;
+    pool->in_flight++;
+
+    pthread_cond_signal(&pool->cond);
+    pthread_mutex_unlock(&pool->mutex);
+    return true;
+}
+
+void frame_pool_stats(FramePool *pool, FramePoolStats *stats) {
+    pthread_mutex_lock(&pool->mutex);
+    stats->submitted = pool->submitted;
+    stats->dropped = pool->dropped;
+    stats->processed = pool->processed;
+    stats->process_ns = pool->process_ns;
+    stats->in_flight = pool->in_flight;
+    stats->latest = pool->latest;
+    pthread_mutex_unlock(&pool->mutex);
+}
+
+void frame_pool_destroy(FramePool **ppool) {
+    FramePool *pool = *ppool;
+    if (!pool) return;
+
+    pthread_mutex_lock(&pool->mutex);
+    pool->closing = true;
+    pthread_cond_broadcast(&pool->cond);
+    pthread_mutex_unlock(&pool->mutex);
+
+    for (int i = 0; i < pool->nb_workers; i++) pthread_join(pool->threads[i], NULL);
+    for (int i = 0; i < FRAME_POOL_MAX_WORKERS; i++) free(pool->workers[i].thumbnail);
+
+    pthread_cond_destroy(&pool->cond);
+    pthread_mutex_destroy(&pool->mutex);
+    free(pool->previous);
+    free(pool->jobs);
+    free(pool);
+    *ppool = NULL;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Worker pool that analyses YUV_420_888 frames in place. Frames are borrowed:
+// the planes point straight into the producer's buffers (AImage_getPlaneData)
+// and `release` hands each one back as soon as the workers are done reading
+// it, so at most `max_in_flight` buffers are ever held.
+typedef struct FramePool FramePool;
+
+#define FRAME_THUMBNAIL_SCALE 8 // luma thumbnail is 1/8 of the frame in each direction
+
+typedef struct {
+    const uint8_t *y;
+    const uint8_t *u;
+    const uint8_t *v;
+    int32_t y_stride;
+    int32_t uv_stride;
+    int32_t uv_pixel_stride;
+    int32_t width;
+    int32_t height;
+    int64_t timestamp;
+    void *image; // producer's handle, given back to `release`
+} Frame;
+
+typedef struct {
+    uint64_t sequence;
+    int64_t timestamp;
+    uint32_t histogram[256]; // luma
+    float mean_luma;
+    float motion; // mean absolute thumbnail difference to the previous frame, 0..255
+    int64_t process_ns;
+} FrameResult;
+
+typedef struct {
+    uint64_t submitted;
+    uint64_t dropped; // refused because max_in_flight frames were already held
+    uint64_t processed;
+    int64_t process_ns; // total worker time
+    int in_flight;
+    FrameResult latest;
+} FramePoolStats;
+
+typedef void (*FrameRelease)(void *context, const Frame *frame);
+
+int frame_pool_create(FramePool **pool, int workers, int max_in_flight, FrameRelease release, void *context);
+// Queues a frame for analysis. Returns false, without taking the frame, when
+// max_in_flight frames are already queued or being processed.
+bool frame_pool_submit(FramePool *pool, const Frame *frame);
+void frame_pool_stats(FramePool *pool, FramePoolStats *stats);
+// Finishes the queued frames, releases them and joins the workers.
+void frame_pool_destroy(FramePool **pool);
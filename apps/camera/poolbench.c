@@ -0,0 +1,145 @@
+// Host benchmark of the frame pool on synthetic YUV_420_888 frames: a luma
+// plane and interleaved chroma (pixel stride 2) with padded rows, as
+// AImageReader hands them out, with one image more than the pool may hold as
+// camera.c sets up the reader. The producer submits as fast as the pool takes
+// frames, retrying where the camera would drop one, so the rate is the pool's
+// ceiling rather than a sensor's frame rate, e.g.
+//
+//     ./poolbench             # 720p, 1080p and 4K on 1 to 4 workers
+//     ./poolbench 1920 1080   # one size
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "frame_pool.h"
+
+#define BENCH_BUFFERS 5 // camera.c's CAMERA_MAX_IMAGES
+#define BENCH_FRAMES 600
+#define BENCH_STRIDE_ALIGN 64
+
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    bool busy[BENCH_BUFFERS];
+} Buffers;
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void release_buffer(void *context, const Frame *frame) {
+    Buffers *buffers = (Buffers *)context;
+    pthread_mutex_lock(&buffers->mutex);
+    buffers->busy[(intptr_t)frame->image] = false;
+    pthread_cond_signal(&buffers->cond);
+    pthread_mutex_unlock(&buffers->mutex);
+}
+
+// A moving diagonal gradient in luma, flat chroma.
+static uint8_t *make_planes(int32_t width, int32_t height, int32_t stride, int shift) {
+    size_t luma = (size_t)stride * height;
+    uint8_t *data = (uint8_t *)malloc(luma + (size_t)stride * (height / 2));
+    if (!data) return NULL;
+    for (int32_t y = 0; y < height; y++) {
+        for (int32_t x = 0; x < width; x++) data[(size_t)y * stride + x] = (uint8_t)(x + y + shift * 16);
+    }
+    memset(data + luma, 128, (size_t)stride * (height / 2));
+    return data;
+}
+
+// Runs BENCH_FRAMES frames through `workers` threads. Returns frames per second,
+// or 0 when the results are wrong.
+static double bench(int32_t width, int32_t height, int workers, double *process_ms) {
+    int32_t stride = (width + BENCH_STRIDE_ALIGN - 1) / BENCH_STRIDE_ALIGN * BENCH_STRIDE_ALIGN;
+    uint8_t *planes[BENCH_BUFFERS];
+    for (int i = 0; i < BENCH_BUFFERS; i++) {
+        if (!(planes[i] = make_planes(width, height, stride, i))) return 0;
+    }
+
+    Buffers buffers = {0};
+    pthread_mutex_init(&buffers.mutex, NULL);
+    pthread_cond_init(&buffers.cond, NULL);
+
+    FramePool *pool;
+    if (frame_pool_create(&pool, workers, BENCH_BUFFERS - 1, release_buffer, &buffers) < 0) return 0;
+
+    double start = now();
+    for (int n = 0; n < BENCH_FRAMES; n++) {
+        int i = n % BENCH_BUFFERS;
+        pthread_mutex_lock(&buffers.mutex);
+        while (buffers.busy[i]) pthread_cond_wait(&buffers.cond, &buffers.mutex);
+        buffers.busy[i] = true;
+        pthread_mutex_unlock(&buffers.mutex);
+
+        size_t luma = (size_t)stride * height;
+        Frame frame = {
+            .y = planes[i],
+            .u = planes[i] + luma,
+            .v = planes[i] + luma + 1,
+            .y_stride = stride,
+            .uv_stride = stride,
+            .uv_pixel_stride = 2,
+            .width = width,
+            .height = height,
+            .timestamp = n * 33333333LL,
+            .image = (void *)(intptr_t)i,
+        };
+        while (!frame_pool_submit(pool, &frame)) sched_yield();
+    }
+
+    FramePoolStats stats;
+    for (frame_pool_stats(pool, &stats); stats.in_flight > 0; frame_pool_stats(pool, &stats)) {
+        nanosleep(&(struct timespec){.tv_nsec = 100000}, NULL);
+    }
+    double elapsed = now() - start;
+    frame_pool_destroy(&pool);
+
+    // the last frame: every tiled pixel counted, the gradient moved
+    uint64_t counted = 0;
+    for (int i = 0; i < 256; i++) counted += stats.latest.histogram[i];
+    bool ok = stats.processed == BENCH_FRAMES && counted == (uint64_t)(width / 8 * 8) * (height / 8 * 8) && stats.latest.motion > 0.0f;
+
+    for (int i = 0; i < BENCH_BUFFERS; i++) free(planes[i]);
+    pthread_cond_destroy(&buffers.cond);
+    pthread_mutex_destroy(&buffers.mutex);
+
+    *process_ms = stats.process_ns / 1e6 / stats.processed;
+    return ok ? BENCH_FRAMES / elapsed : 0;
+}
+
+int main(int argc, char **argv) {
+    int32_t sizes[][2] = {{1280, 720}, {1920, 1080}, {3840, 2160}};
+    int nb_sizes = 3;
+    if (argc > 2) {
+        sizes[0][0] = atoi(argv[1]);
+        sizes[0][1] = atoi(argv[2]);
+        nb_sizes = 1;
+        if (sizes[0][0] < 8 || sizes[0][1] < 8 || sizes[0][0] > 4096) {
+            fprintf(stderr, "usage: %s [width height]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    printf("frame pool: %d frames, %d images, %d held by the pool\n", BENCH_FRAMES, BENCH_BUFFERS, BENCH_BUFFERS - 1);
+    printf("%11s %8s %10s %14s\n", "size", "workers", "fps", "ms/frame");
+    for (int s = 0; s < nb_sizes; s++) {
+        for (int workers = 1; workers <= 4; workers++) {
+            double process_ms = 0;
+            double fps = bench(sizes[s][0], sizes[s][1], workers, &process_ms);
+            if (fps == 0) {
+                fprintf(stderr, "poolbench: %dx%d on %d workers gave wrong results\n", sizes[s][0], sizes[s][1], workers);
+                return 1;
+            }
+            char size[16];
+            snprintf(size, sizeof(size), "%dx%d", sizes[s][0], sizes[s][1]);
+            printf("%11s %8d %10.0f %14.2f\n", size, workers, fps, process_ms);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,446 @@
+#include "preview.h"
+
+#define EGL_EGLEXT_PROTOTYPES
+#define GL_GLEXT_PROTOTYPES
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GLES3/gl3.h>
+#include <GLES2/gl2ext.h>
+
+#include <android/hardware_buffer.h>
+#include <android/log.h>
+#include <media/NdkImageReader.h>
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define LOGI(...) ((void)__android_log_print(ANDROID_LOG_INFO, "ENGINE", __VA_ARGS__))
+#define LOGE(...) ((void)__android_log_print(ANDROID_LOG_ERROR, "ENGINE", __VA_ARGS__))
+
+// The reader cycles through a fixed set of buffers; one EGLImage is made per
+// buffer and reused, so steady state streaming creates no EGL objects. Should
+// the reader hand out a new buffer with the cache full, only the least recently
+// drawn entry is replaced.
+#define PREVIEW_MAX_IMAGES 4
+#define PREVIEW_STATS_FRAMES 120
+
+typedef struct {
+    AHardwareBuffer *buffer;
+    EGLImageKHR image;
+    uint64_t used; // Preview.draws when last drawn
+} PreviewImage;
+
+typedef struct {
+    uint64_t frames;
+    uint64_t skipped; // delivered by the camera but superseded before drawing
+    int64_t latency_ns;
+    int64_t latency_max_ns;
+    int64_t bind_ns;
+    int64_t draw_ns;
+    int64_t last_timestamp;
+    int64_t interval_ns;
+} PreviewStats;
+
+struct Preview {
+    ANativeWindow *display;
+    AImageReader *reader;
+    ANativeWindow *window;
+    int32_t width;
+    int32_t height;
+    int32_t orientation;
+    clockid_t timestamp_clock;
+
+    pthread_t thread;
+    bool started;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    bool closing;
+    int pending; // images announced by the reader and not yet drawn
+
+    EGLDisplay egl_display;
+    EGLSurface egl_surface;
+    EGLContext egl_context;
+    GLuint program;
+    GLuint texture;
+    GLuint VAO;
+    GLuint VBO;
+
+    PreviewImage images[PREVIEW_MAX_IMAGES + 1];
+    uint64_t draws;
+    AImage *shown; // kept until the next frame is drawn, the GPU may still be reading it
+
+    PreviewStats stats;
+};
+
+static const char *vertex_shader_source = "#version 300 es\n"
+                                          "layout(location = 0) in vec2 position;\n"
+                                          "layout(location = 1) in vec2 texCoord;\n"
+                                          "uniform mat2 rotation;\n"
+                                          "out vec2 TexCoord;\n"
+                                          "void main() {\n"
+                                          "    gl_Position = vec4(position, 0.0, 1.0);\n"
+                                          "    TexCoord = rotation * (texCoord - 0.5) + 0.5;\n"
+                                          "}\n";
+
+static const char *fragment_shader_source = "#version 300 es\n"
+                                            "#extension GL_OES_EGL_image_external_essl3 : require\n"
+                                            "precision mediump float;\n"
+                                            "in vec2 TexCoord;\n"
+                                            "out vec4 FragColor;\n"
+                                            "uniform samplerExternalOES camera;\n"
+                                            "void main() {\n"
+                                            "    FragColor = texture(camera, TexCoord);\n"
+                                            "}\n";
+
+static int64_t preview_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// Now on the clock of the sensor timestamps.
+static int64_t preview_sensor_now(Preview *preview) {
+    struct timespec ts;
+    clock_gettime(preview->timestamp_clock, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void preview_on_image(void *context, AImageReader *reader) {
+    (void)reader;
+    Preview *preview = context;
+
+    pthread_mutex_lock(&preview->mutex);
+    preview->pending++;
+    pthread_cond_signal(&preview->cond);
+    pthread_mutex_unlock(&preview->mutex);
+}
+
+static GLuint preview_compile(GLenum type, const char *source) {
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+
+    GLint status;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if (status == GL_FALSE) {
+        char buffer[512];
+        glGetShaderInfoLog(shader, sizeof(buffer), NULL, buffer);
+        LOGE("preview shader compilation: %s", buffer);
+    }
+    return shader;
+}
+
+static void preview_destroy_gl(Preview *preview) {
+    if (preview->egl_display == EGL_NO_DISPLAY) return;
+
+    for (int i = 0; i < PREVIEW_MAX_IMAGES + 1; i++) {
+        PreviewImage *image = &preview->images[i];
+        if (image->image != EGL_NO_IMAGE_KHR) eglDestroyImageKHR(preview->egl_display, image->image);
+        if (image->buffer) AHardwareBuffer_release(image->buffer);
+        memset(image, 0, sizeof(*image));
+    }
+
+    if (preview->egl_context != EGL_NO_CONTEXT) {
+        glDeleteTextures(1, &preview->texture);
+        glDeleteBuffers(1, &preview->VBO);
+        glDeleteVertexArrays(1, &preview->VAO);
+        glDeleteProgram(preview->program);
+    }
+
+    eglMakeCurrent(preview->egl_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (preview->egl_surface != EGL_NO_SURFACE) eglDestroySurface(preview->egl_display, preview->egl_surface);
+    if (preview->egl_context != EGL_NO_CONTEXT) eglDestroyContext(preview->egl_display, preview->egl_context);
+    eglTerminate(preview->egl_display);
+
+    preview->egl_display = EGL_NO_DISPLAY;
+    preview->egl_surface = EGL_NO_SURFACE;
+    preview->egl_context = EGL_NO_CONTEXT;
+}
+
+static bool preview_init_gl(Preview *preview) {
+    preview->egl_display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (preview->egl_display == EGL_NO_DISPLAY || !eglInitialize(preview->egl_display, NULL, NULL)) {
+        LOGE("preview: cannot initialize EGL");
+        preview->egl_display = EGL_NO_DISPLAY;
+        return false;
+    }
+
+    EGLint attributes[] = {EGL_SURFACE_TYPE, EGL_WINDOW_BIT, EGL_BLUE_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_RED_SIZE, 8, EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT, EGL_NONE};
+    EGLConfig egl_config;
+    EGLint num_configs;
+    if (!eglChooseConfig(preview->egl_display, attributes, &egl_config, 1, &num_configs) || num_configs == 0) {
+        LOGE("preview: cannot choose EGL config");
+        return false;
+    }
+
+    EGLint context_attributes[] = {EGL_CONTEXT_CLIENT_VERSION, 3, EGL_NONE};
+    preview->egl_context = eglCreateContext(preview->egl_display, egl_config, EGL_NO_CONTEXT, context_attributes);
+    preview->egl_surface = eglCreateWindowSurface(preview->egl_display, egl_config, preview->display, NULL);
+    if (preview->egl_context == EGL_NO_CONTEXT || preview->egl_surface == EGL_NO_SURFACE || !eglMakeCurrent(preview->egl_display, preview->egl_surface, preview->egl_surface, preview->egl_context)) {
+        LOGE("preview: cannot create EGL surface or context");
+        return false;
+    }
+
+    GLint surface_width = ANativeWindow_getWidth(preview->display);
+    GLint surface_height = ANativeWindow_getHeight(preview->display);
+    glViewport(0, 0, surface_width, surface_height);
+
+    // fill the surface and crop the camera image, accounting for the sensor
+    // being mounted at `orientation` degrees to the display
+    bool sideways = preview->orientation == 90 || preview->orientation == 270;
+    float image_aspect = sideways ? (float)preview->height / preview->width : (float)preview->width / preview->height;
+    float surface_aspect = (float)surface_width / surface_height;
+    float sx = surface_aspect < image_aspect ? surface_aspect / image_aspect : 1.0f;
+    float sy = surface_aspect < image_aspect ? 1.0f : image_aspect / surface_aspect;
+
+    // clang-format off
+    GLfloat vertices[] = {
+        -1.0f, +1.0f, 0.5f - sx * 0.5f, 0.5f - sy * 0.5f,
+        -1.0f, -1.0f, 0.5f - sx * 0.5f, 0.5f + sy * 0.5f,
+        +1.0f, +1.0f, 0.5f + sx * 0.5f, 0.5f - sy * 0.5f,
+        +1.0f, -1.0f, 0.5f + sx * 0.5f, 0.5f + sy * 0.5f,
+    };
+    // clang-format on
+
+    glGenVertexArrays(1, &preview->VAO);
+    glBindVertexArray(preview->VAO);
+
+    glGenBuffers(1, &preview->VBO);
+    glBindBuffer(GL_ARRAY_BUFFER, preview->VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(GLfloat), (void *)0);
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(GLfloat), (void *)(2 * sizeof(GLfloat)));
+
+    GLuint vertex_shader = preview_compile(GL_VERTEX_SHADER, vertex_shader_source);
+    GLuint fragment_shader = preview_compile(GL_FRAGMENT_SHADER, fragment_shader_source);
+
+    preview->program = glCreateProgram();
+    glAttachShader(preview->program, vertex_shader);
+    glAttachShader(preview->program, fragment_shader);
+    glLinkProgram(preview->program);
+    glDeleteShader(vertex_shader);
+    glDeleteShader(fragment_shader);
+
+    GLint status;
+    glGetProgramiv(preview->program, GL_LINK_STATUS, &status);
+    if (status == GL_FALSE) {
+        char buffer[512];
+        glGetProgramInfoLog(preview->program, sizeof(buffer), NULL, buffer);
+        LOGE("preview shader program linking: %s", buffer);
+        return false;
+    }
+
+    // maps centred display coordinates to image coordinates, turning the image
+    // clockwise by the sensor orientation (column major)
+    GLfloat rotation[4] = {1.0f, 0.0f, 0.0f, 1.0f};
+    if (preview->orientation == 90) memcpy(rotation, (GLfloat[4]){0.0f, -1.0f, 1.0f, 0.0f}, sizeof(rotation));
+    if (preview->orientation == 180) memcpy(rotation, (GLfloat[4]){-1.0f, 0.0f, 0.0f, -1.0f}, sizeof(rotation));
+    if (preview->orientation == 270) memcpy(rotation, (GLfloat[4]){0.0f, 1.0f, -1.0f, 0.0f}, sizeof(rotation));
+
+    glUseProgram(preview->program);
+    glUniform1i(glGetUniformLocation(preview->program, "camera"), 0);
+    glUniformMatrix2fv(glGetUniformLocation(preview->program, "rotation"), 1, GL_FALSE, rotation);
+
+    glGenTextures(1, &preview->texture);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_EXTERNAL_OES, preview->texture);
+    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    return true;
+}
+
+// Returns the EGLImage wrapping `buffer`, creating it on first sight.
+static EGLImageKHR preview_image(Preview *preview, AHardwareBuffer *buffer) {
+    preview->draws++;
+
+    PreviewImage *slot = NULL;
+    for (int i = 0; i < PREVIEW_MAX_IMAGES + 1; i++) {
+        PreviewImage *cached = &preview->images[i];
+        if (cached->buffer == buffer) {
+            cached->used = preview->draws;
+            return cached->image;
+        }
+        if (!slot || (slot->buffer && (!cached->buffer || cached->used < slot->used))) slot = cached;
+    }
+
+    // a buffer the reader has not handed out before with every entry taken:
+    // replace the least recently drawn one, never the image still on screen
+    if (slot->buffer) {
+        eglDestroyImageKHR(preview->egl_display, slot->image);
+        AHardwareBuffer_release(slot->buffer);
+        memset(slot, 0, sizeof(PreviewImage));
+    }
+
+    EGLint attributes[] = {EGL_IMAGE_PRESERVED_KHR, EGL_TRUE, EGL_NONE};
+    EGLClientBuffer client_buffer = eglGetNativeClientBufferANDROID(buffer);
+    EGLImageKHR image = eglCreateImageKHR(preview->egl_display, EGL_NO_CONTEXT, EGL_NATIVE_BUFFER_ANDROID, client_buffer, attributes);
+    if (image == EGL_NO_IMAGE_KHR) {
+        LOGE("preview: cannot create EGLImage: 0x%x", eglGetError());
+        return EGL_NO_IMAGE_KHR;
+    }
+
+    // hold a reference so the pointer stays a valid cache key
+    AHardwareBuffer_acquire(buffer);
+    slot->buffer = buffer;
+    slot->image = image;
+    slot->used = preview->draws;
+    return image;
+}
+
+static void preview_draw(Preview *preview, AImage *image) {
+    int64_t start = preview_now();
+
+    AHardwareBuffer *buffer = NULL;
+    if (AImage_getHardwareBuffer(image, &buffer) != AMEDIA_OK || !buffer) {
+        AImage_delete(image);
+        return;
+    }
+
+    EGLImageKHR egl_image = preview_image(preview, buffer);
+    if (egl_image == EGL_NO_IMAGE_KHR) {
+        AImage_delete(image);
+        return;
+    }
+    glEGLImageTargetTexture2DOES(GL_TEXTURE_EXTERNAL_OES, (GLeglImageOES)egl_image);
+    int64_t bound = preview_now();
+
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    if (!eglSwapBuffers(preview->egl_display, preview->egl_surface)) LOGE("preview: eglSwapBuffers: 0x%x", eglGetError());
+    int64_t drawn = preview_now();
+
+    // the previous image is no longer sampled once this frame was queued
+    if (preview->shown) AImage_delete(preview->shown);
+    preview->shown = image;
+
+    int64_t timestamp = 0;
+    AImage_getTimestamp(image, &timestamp);
+
+    PreviewStats *stats = &preview->stats;
+    int64_t latency = preview_sensor_now(preview) - timestamp;
+    stats->frames++;
+    stats->latency_ns += latency;
+    if (latency > stats->latency_max_ns) stats->latency_max_ns = latency;
+    stats->bind_ns += bound - start;
+    stats->draw_ns += drawn - bound;
+    if (stats->last_timestamp) stats->interval_ns += timestamp - stats->last_timestamp;
+    stats->last_timestamp = timestamp;
+
+    if (stats->frames == PREVIEW_STATS_FRAMES) {
+        double frames = (double)stats->frames;
+        LOGI("preview: %.1f fps | sensor to swap %.2f ms (max %.2f) | bind %.3f ms | draw+swap %.2f ms | %lu skipped", stats->interval_ns ? 1e9 * (frames - 1) / stats->interval_ns : 0.0, stats->latency_ns / 1e6 / frames, stats->latency_max_ns / 1e6, stats->bind_ns / 1e6 / frames, stats->draw_ns / 1e6 / frames, (unsigned long)stats->skipped);
+        memset(stats, 0, sizeof(*stats));
+        stats->last_timestamp = timestamp;
+    }
+}
+
+static void *preview_task(void *arg) {
+    Preview *preview = arg;
+
+    // without GL the images are still drained so the camera never stalls
+    bool ready = preview_init_gl(preview);
+    if (!ready) preview_destroy_gl(preview);
+
+    pthread_mutex_lock(&preview->mutex);
+    for (;;) {
+        while (!preview->closing && preview->pending == 0) pthread_cond_wait(&preview->cond, &preview->mutex);
+        if (preview->closing) break;
+
+        // draw only the newest image, older ones are dropped by the reader
+        int pending = preview->pending;
+        preview->pending = 0;
+        pthread_mutex_unlock(&preview->mutex);
+
+        AImage *image = NULL;
+        if (AImageReader_acquireLatestImage(preview->reader, &image) == AMEDIA_OK && image) {
+            preview->stats.skipped += pending - 1;
+            if (ready) {
+                preview_draw(preview, image);
+            } else {
+                AImage_delete(image);
+            }
+        }
+
+        pthread_mutex_lock(&preview->mutex);
+    }
+    pthread_mutex_unlock(&preview->mutex);
+
+    if (preview->shown) AImage_delete(preview->shown);
+    preview->shown = NULL;
+    preview_destroy_gl(preview);
+    return NULL;
+}
+
+int preview_create(Preview **out, ANativeWindow *display, int32_t width, int32_t height, int32_t orientation, clockid_t timestamp_clock) {
+    int ret;
+
+    Preview *preview = calloc(1, sizeof(Preview));
+    if (!preview) return -ENOMEM;
+
+    preview->display = display;
+    preview->width = width;
+    preview->height = height;
+    preview->orientation = orientation;
+    preview->timestamp_clock = timestamp_clock;
+    preview->egl_display = EGL_NO_DISPLAY;
+    preview->egl_surface = EGL_NO_SURFACE;
+    preview->egl_context = EGL_NO_CONTEXT;
+    pthread_mutex_init(&preview->mutex, NULL);
+    pthread_cond_init(&preview->cond, NULL);
+
+    // one more image than the consumer holds (drawn + being acquired) so the
+    // camera always has a buffer to fill
+    ret = AImageReader_newWithUsage(width, height, AIMAGE_FORMAT_PRIVATE, AHARDWAREBUFFER_USAGE_GPU_SAMPLED_IMAGE, PREVIEW_MAX_IMAGES, &preview->reader);
+    if (ret != AMEDIA_OK) {
+        LOGE("preview: cannot create image reader: %d", ret);
+        preview_destroy(&preview);
+        return -EINVAL;
+    }
+
+    AImageReader_ImageListener listener = {.context = preview, .onImageAvailable = preview_on_image};
+    AImageReader_setImageListener(preview->reader, &listener);
+    AImageReader_getWindow(preview->reader, &preview->window);
+
+    if (pthread_create(&preview->thread, NULL, preview_task, preview) != 0) {
+        preview_destroy(&preview);
+        return -EAGAIN;
+    }
+    preview->started = true;
+
+    LOGI("preview: GPU path %dx%d | orientation %d | %d buffers", width, height, orientation, PREVIEW_MAX_IMAGES);
+
+    *out = preview;
+    return 0;
+}
+
+ANativeWindow *preview_window(Preview *preview) {
+    return preview->window;
+}
+
+void preview_destroy(Preview **ppreview) {
+    Preview *preview = *ppreview;
+    if (!preview) return;
+
+    if (preview->started) {
+        pthread_mutex_lock(&preview->mutex);
+        preview->closing = true;
+        pthread_cond_signal(&preview->cond);
+        pthread_mutex_unlock(&preview->mutex);
+        pthread_join(preview->thread, NULL);
+    }
+
+    if (preview->reader) AImageReader_delete(preview->reader);
+    pthread_cond_destroy(&preview->cond);
+    pthread_mutex_destroy(&preview->mutex);
+    free(preview);
+    *ppreview = NULL;
+}
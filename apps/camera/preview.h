@@ -0,0 +1,20 @@
+#pragma once
+
+#include <android/native_window.h>
+
+#include <stdint.h>
+#include <time.h>
+
+// GPU camera preview. The camera renders into a private AImageReader whose
+// AHardwareBuffers are bound as external OES textures through EGLImages, and a
+// render thread draws the newest one into `display` with GLES, so the preview
+// can be composited or run through shaders without the CPU touching a pixel.
+typedef struct Preview Preview;
+
+// `orientation` is ACAMERA_SENSOR_ORIENTATION in degrees and `timestamp_clock`
+// the clock of the sensor timestamps (see ACAMERA_SENSOR_INFO_TIMESTAMP_SOURCE),
+// which latencies are measured against.
+int preview_create(Preview **preview, ANativeWindow *display, int32_t width, int32_t height, int32_t orientation, clockid_t timestamp_clock);
+// The surface to add to the capture session and request.
+ANativeWindow *preview_window(Preview *preview);
+void preview_destroy(Preview **preview);
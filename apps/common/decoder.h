@@ -0,0 +1,40 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <libavcodec/avcodec.h>
+#include <libavutil/cpu.h>
+#ifdef __cplusplus
+}
+#endif
+
+#define DECODER_MAX_THREADS 16
+
+// Picks the decoder threading from the core count and the number of frames of
+// extra delay the caller can tolerate. Frame threading keeps one frame in flight
+// per thread, so it is only used when the latency budget covers it; a budget of
+// zero selects the low latency mode (slice threads only). Call it after
+// avcodec_parameters_to_context(): AV_CODEC_FLAG_LOW_DELAY makes the decoder
+// ignore the reorder delay of the stream and output B-frames out of order, so
+// it is only set for streams that declare none (has_b_frames == 0).
+static inline void decoder_configure(AVCodecContext *codec_context, const AVCodec *codec, int latency_frames) {
+    int cores = av_cpu_count();
+    if (cores < 1) cores = 1;
+    if (cores > DECODER_MAX_THREADS) cores = DECODER_MAX_THREADS;
+
+    if (latency_frames > 0 && (codec->capabilities & AV_CODEC_CAP_FRAME_THREADS)) {
+        int threads = latency_frames + 1;
+        codec_context->thread_type = FF_THREAD_FRAME;
+        codec_context->thread_count = threads < cores ? threads : cores;
+    } else {
+        codec_context->thread_type = FF_THREAD_SLICE;
+        codec_context->thread_count = (codec->capabilities & AV_CODEC_CAP_SLICE_THREADS) ? cores : 1;
+        if (codec_context->has_b_frames == 0) codec_context->flags |= AV_CODEC_FLAG_LOW_DELAY;
+    }
+}
+
+static inline const char *decoder_thread_type_name(const AVCodecContext *codec_context) {
+    if (codec_context->thread_count <= 1) return "none";
+    return codec_context->thread_type == FF_THREAD_FRAME ? "frame" : "slice";
+}
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <math.h>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+// Column-major 4x4 matrices laid out as GLSL expects them, so a Mat4 is
+// uploaded with glUniformMatrix4fv(location, 1, GL_FALSE, m.m). Everything is
+// computed on the CPU once per draw; shaders only see the final matrices.
+
+typedef struct {
+    float x, y, z;
+} Vec3;
+
+typedef struct {
+    float x, y, z, w;
+} Quat;
+
+typedef struct {
+    float m[16] __attribute__((aligned(16)));
+} Mat4;
+
+static inline Vec3 vec3(float x, float y, float z) {
+    Vec3 v = {x, y, z};
+    return v;
+}
+
+static inline Vec3 vec3_sub(Vec3 a, Vec3 b) { return vec3(a.x - b.x, a.y - b.y, a.z - b.z); }
+
+static inline float vec3_dot(Vec3 a, Vec3 b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+static inline Vec3 vec3_cross(Vec3 a, Vec3 b) { return vec3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x); }
+
+static inline Vec3 vec3_normalize(Vec3 v) {
+    float length = sqrtf(vec3_dot(v, v));
+    if (length == 0.0f) return v;
+    return vec3(v.x / length, v.y / length, v.z / length);
+}
+
+static inline Mat4 mat4_identity(void) {
+    Mat4 r = {{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1}};
+    return r;
+}
+
+// a * b: every column of the result is a combination of the columns of `a`
+// weighted by one column of `b`, four multiply-adds per column.
+static inline Mat4 mat4_mul(const Mat4 *a, const Mat4 *b) {
+    Mat4 r;
+#if defined(__ARM_NEON)
+    float32x4_t a0 = vld1q_f32(a->m + 0), a1 = vld1q_f32(a->m + 4);
+    float32x4_t a2 = vld1q_f32(a->m + 8), a3 = vld1q_f32(a->m + 12);
+    for (int i = 0; i < 4; i++) {
+        float32x4_t c = vmulq_n_f32(a0, b->m[4 * i + 0]);
+        c = vmlaq_n_f32(c, a1, b->m[4 * i + 1]);
+        c = vmlaq_n_f32(c, a2, b->m[4 * i + 2]);
+        c = vmlaq_n_f32(c, a3, b->m[4 * i + 3]);
+        vst1q_f32(r.m + 4 * i, c);
+    }
+#elif defined(__SSE__)
+    __m128 a0 = _mm_load_ps(a->m + 0), a1 = _mm_load_ps(a->m + 4);
+    __m128 a2 = _mm_load_ps(a->m + 8), a3 = _mm_load_ps(a->m + 12);
+    for (int i = 0; i < 4; i++) {
+        __m128 c = _mm_mul_ps(a0, _mm_set1_ps(b->m[4 * i + 0]));
+        c = _mm_add_ps(c, _mm_mul_ps(a1, _mm_set1_ps(b->m[4 * i + 1])));
+        c = _mm_add_ps(c, _mm_mul_ps(a2, _mm_set1_ps(b->m[4 * i + 2])));
+        c = _mm_add_ps(c, _mm_mul_ps(a3, _mm_set1_ps(b->m[4 * i + 3])));
+        _mm_store_ps(r.m + 4 * i, c);
+    }
+#else
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            r.m[4 * i + j] = a->m[0 + j] * b->m[4 * i + 0] + a->m[4 + j] * b->m[4 * i + 1] + a->m[8 + j] * b->m[4 * i + 2] + a->m[12 + j] * b->m[4 * i + 3];
+        }
+    }
+#endif
+    return r;
+}
+
+static inline Mat4 mat4_translate(Vec3 t) {
+    Mat4 r = mat4_identity();
+    r.m[12] = t.x;
+    r.m[13] = t.y;
+    r.m[14] = t.z;
+    return r;
+}
+
+static inline Mat4 mat4_scale(Vec3 s) {
+    Mat4 r = mat4_identity();
+    r.m[0] = s.x;
+    r.m[5] = s.y;
+    r.m[10] = s.z;
+    return r;
+}
+
+// Right-handed rotation of `angle` radians around a unit `axis`.
+static inline Quat quat_axis_angle(Vec3 axis, float angle) {
+    float s = sinf(angle * 0.5f);
+    Quat q = {axis.x * s, axis.y * s, axis.z * s, cosf(angle * 0.5f)};
+    return q;
+}
+
+// a * b applies b first, then a, like the matrices.
+static inline Quat quat_mul(Quat a, Quat b) {
+    Quat q = {
+        a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+        a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+        a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+        a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z,
+    };
+    return q;
+}
+
+static inline Quat quat_normalize(Quat q) {
+    float length = sqrtf(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+    Quat r = {q.x / length, q.y / length, q.z / length, q.w / length};
+    return r;
+}
+
+// Rotation, scale and translation in one go, T * R * S without the products.
+static inline Mat4 mat4_transform(Vec3 t, Quat q, Vec3 s) {
+    float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+    // clang-format off
+    Mat4 r = {{
+        (1 - 2 * (yy + zz)) * s.x, 2 * (xy + wz) * s.x, 2 * (xz - wy) * s.x, 0,
+        2 * (xy - wz) * s.y, (1 - 2 * (xx + zz)) * s.y, 2 * (yz + wx) * s.y, 0,
+        2 * (xz + wy) * s.z, 2 * (yz - wx) * s.z, (1 - 2 * (xx + yy)) * s.z, 0,
+        t.x, t.y, t.z, 1,
+    }};
+    // clang-format on
+    return r;
+}
+
+static inline Mat4 mat4_from_quat(Quat q) { return mat4_transform(vec3(0, 0, 0), q, vec3(1, 1, 1)); }
+
+// OpenGL clip space (z in -w..w), `fovy` in radians.
+static inline Mat4 mat4_perspective(float fovy, float aspect, float near, float far) {
+    float f = 1.0f / tanf(fovy * 0.5f);
+    Mat4 r = {{0}};
+    r.m[0] = f / aspect;
+    r.m[5] = f;
+    r.m[10] = (far + near) / (near - far);
+    r.m[11] = -1.0f;
+    r.m[14] = 2.0f * far * near / (near - far);
+    return r;
+}
+
+static inline Mat4 mat4_look_at(Vec3 eye, Vec3 center, Vec3 up) {
+    Vec3 f = vec3_normalize(vec3_sub(center, eye));
+    Vec3 s = vec3_normalize(vec3_cross(f, up));
+    Vec3 u = vec3_cross(s, f);
+
+    // clang-format off
+    Mat4 r = {{
+        s.x, u.x, -f.x, 0,
+        s.y, u.y, -f.y, 0,
+        s.z, u.z, -f.z, 0,
+        -vec3_dot(s, eye), -vec3_dot(u, eye), vec3_dot(f, eye), 1,
+    }};
+    // clang-format on
+    return r;
+}
+
+// A perspective camera looking from `eye` at `target`, +y up.
+typedef struct {
+    Vec3 eye;
+    Vec3 target;
+    float fovy;
+    float near;
+    float far;
+} Camera;
+
+static inline Mat4 camera_view_projection(const Camera *camera, float aspect) {
+    Mat4 projection = mat4_perspective(camera->fovy, aspect, camera->near, camera->far);
+    Mat4 view = mat4_look_at(camera->eye, camera->target, vec3(0, 1, 0));
+    return mat4_mul(&projection, &view);
+}
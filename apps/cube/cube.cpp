@@ -9,6 +9,7 @@
 #include <string.h>
 #include <time.h>
 
+#include "../common/vecmath.h"
 #include "cube.h"
 
 #define LOG(...) ((void)__android_log_print(ANDROID_LOG_INFO, "ENGINE", __VA_ARGS__))
@@ -20,38 +21,13 @@ static const char *vertex_shader_source = R"(#version 300 es
     layout(location = 0) in vec3 position;
     layout(location = 1) in vec3 color;
 
-    uniform float time;
+    uniform highp mat4 mvp;
 
     out vec3 Color;
 
     void main() {
-        float c = cos(time);
-        float s = sin(time);
-
-        mat4 rotationX = mat4(
-            1.0, 0.0, 0.0, 0.0,
-            0.0, c, -s, 0.0,
-            0.0, s, c, 0.0,
-            0.0, 0.0, 0.0, 1.0
-        );
-
-        mat4 rotationY = mat4(
-            c, 0.0, s, 0.0,
-            0.0, 1.0, 0.0, 0.0,
-            -s, 0.0, c, 0.0,
-            0.0, 0.0, 0.0, 1.0
-        );
-
-        mat4 rotationZ = mat4(
-            c, -s, 0.0, 0.0,
-            s, c, 0.0, 0.0,
-            0.0, 0.0, 1.0, 0.0,
-            0.0, 0.0, 0.0, 1.0
-        );
-
         Color = color;
-        gl_Position = rotationZ * rotationX * vec4(position, 1.0);
-
+        gl_Position = mvp * vec4(position, 1.0);
     }
 )";
 
@@ -173,10 +149,25 @@ void *run_main(void *arg) {
     GLuint cube = make_cube();
     GLuint program = make_program();
 
+    EGLint width, height;
+    eglQuerySurface(egl_display, egl_surface, EGL_WIDTH, &width);
+    eglQuerySurface(egl_display, egl_surface, EGL_HEIGHT, &height);
+
+    Camera camera = {vec3(0.0f, 0.0f, 1.5f), vec3(0.0f, 0.0f, 0.0f), 45.0f * (float)M_PI / 180.0f, 0.1f, 100.0f};
+    Mat4 view_projection = camera_view_projection(&camera, (float)width / height);
+    GLint mvp_location = glGetUniformLocation(program, "mvp");
+
     while (app->running) {
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
         glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-        glUniform1f(glGetUniformLocation(program, "time"), glfwGetTime());
+
+        // negated: the shader's rotation matrices, written row by row into
+        // column-major mat4 constructors, turned the other way
+        float time = glfwGetTime();
+        Quat rotation = quat_mul(quat_axis_angle(vec3(0.0f, 0.0f, 1.0f), -time), quat_axis_angle(vec3(1.0f, 0.0f, 0.0f), -time));
+        Mat4 model = mat4_from_quat(rotation);
+        Mat4 mvp = mat4_mul(&view_projection, &model);
+        glUniformMatrix4fv(mvp_location, 1, GL_FALSE, mvp.m);
         glUniform1i(glGetUniformLocation(program, "object"), 1);
         render_cube(cube);
         eglSwapBuffers(egl_display, egl_surface);
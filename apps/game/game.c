@@ -19,6 +19,8 @@
 
 #include <unistd.h>
 
+#include "../common/vecmath.h"
+
 #define LOGI(...) ((void)__android_log_print(ANDROID_LOG_INFO, "ENGINE", __VA_ARGS__))
 #define LOGE(...) ((void)__android_log_print(ANDROID_LOG_ERROR, "ENGINE", __VA_ARGS__))
 #define LOGV(...) ((void)__android_log_print(ANDROID_LOG_VERBOSE, "ENGINE", __VA_ARGS__))
@@ -168,6 +170,14 @@ void *render_task(void *arg) {
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
 
+    EGLint width, height;
+    eglQuerySurface(app.egl_display, app.egl_surface, EGL_WIDTH, &width);
+    eglQuerySurface(app.egl_display, app.egl_surface, EGL_HEIGHT, &height);
+
+    Camera camera = {vec3(0.0f, 0.0f, 2.0f), vec3(0.0f, 0.0f, 0.0f), 45.0f * (float)M_PI / 180.0f, 0.1f, 100.0f};
+    Mat4 view_projection = camera_view_projection(&camera, (float)width / height);
+    GLint mvp_location = glGetUniformLocation(program, "mvp");
+
     int angleX = 0;
     int angleY = 0;
     int angleZ = 0;
@@ -196,10 +206,18 @@ void *render_task(void *arg) {
         angleY += 0;
         angleZ += 2;
 
+        // Z * Y * X with every angle negated, the motion shaders.glsl had: its
+        // matrices were written row by row into column-major mat4 constructors,
+        // which made each of them the inverse, negative angle rotation
+        float radians = -(float)M_PI / 180.0f;
+        Quat rotation = quat_axis_angle(vec3(0.0f, 0.0f, 1.0f), angleZ * radians);
+        rotation = quat_mul(rotation, quat_axis_angle(vec3(0.0f, 1.0f, 0.0f), angleY * radians));
+        rotation = quat_mul(rotation, quat_axis_angle(vec3(1.0f, 0.0f, 0.0f), angleX * radians));
+        Mat4 model = mat4_from_quat(rotation);
+        Mat4 mvp = mat4_mul(&view_projection, &model);
+
         glUseProgram(program);
-        glUniform1i(glGetUniformLocation(program, "angleX"), angleX);
-        glUniform1i(glGetUniformLocation(program, "angleY"), angleY);
-        glUniform1i(glGetUniformLocation(program, "angleZ"), angleZ);
+        glUniformMatrix4fv(mvp_location, 1, GL_FALSE, mvp.m);
 
         glBindVertexArray(VAO);
         glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
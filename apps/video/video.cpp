@@ -16,6 +16,8 @@ extern "C" {
 
 #include <pthread.h>
 
+#include "../common/decoder.h"
+
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
@@ -181,11 +183,13 @@ void *run_main(void *arg) {
         exit(1);
     }
 
-    av_opt_set_int(codec_context, "threads", 16, 0);
+    // live stream: no frame threading, so each packet comes out as soon as it is decoded
+    decoder_configure(codec_context, vcodec, 0);
     if ((ret = avcodec_open2(codec_context, vcodec, NULL)) < 0) {
         LOG("[ERROR]: avcodec_open2: %s", av_err2str(ret));
         exit(1);
     }
+    LOG("Decoder: %s | threads %d (%s)", vcodec->name, codec_context->thread_count, decoder_thread_type_name(codec_context));
 
     AVPacket *pkt = av_packet_alloc();
     if (!pkt) {